@@ -0,0 +1,457 @@
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define AFF3CT_BENCH_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define AFF3CT_BENCH_TSC
+#endif
+#include <cli.hpp>
+#include <mipp.h>
+#include <streampu.hpp>
+
+#include "Factory/Module/Quantizer/Quantizer.hpp"
+#include "Factory/Tools/Codec/BCH/Codec_BCH.hpp"
+#include "Factory/Tools/Codec/LDPC/Codec_LDPC.hpp"
+#include "Factory/Tools/Codec/Polar/Codec_polar.hpp"
+#include "Factory/Tools/Codec/Polar_MK/Codec_polar_MK.hpp"
+#include "Factory/Tools/Codec/RA/Codec_RA.hpp"
+#include "Factory/Tools/Codec/RS/Codec_RS.hpp"
+#include "Factory/Tools/Codec/RSC/Codec_RSC.hpp"
+#include "Factory/Tools/Codec/RSC_DB/Codec_RSC_DB.hpp"
+#include "Factory/Tools/Codec/Repetition/Codec_repetition.hpp"
+#include "Factory/Tools/Codec/Turbo/Codec_turbo.hpp"
+#include "Factory/Tools/Codec/Turbo_DB/Codec_turbo_DB.hpp"
+#include "Factory/Tools/Codec/Turbo_product/Codec_turbo_product.hpp"
+#include "Factory/Tools/Codec/Uncoded/Codec_uncoded.hpp"
+#include "Tools/Display/rang_format/rang_format.h"
+#include "Tools/Documentation/documentation.h"
+#include "Tools/Noise/Sigma.hpp"
+#include "Tools/general_utils.h"
+#include "Tools/types.h"
+#include "Tools/version.h"
+
+using namespace aff3ct;
+
+/*
+ * Decoder throughput benchmark: the decoders are built through the codec factories (the decoder parameters are given
+ * on the command line as in the simulator), the LLRs are generated once at a fixed SNR and the decoding task is run
+ * alone over a matrix of frame sizes, precisions, SIMD strategies and inter frame levels. Each configuration gives
+ * one CSV line (information throughput, latency percentiles and cycles per information bit).
+ */
+
+struct Bench_params
+{
+    std::string cde_type;
+    std::vector<std::pair<int, int>> sizes; // (K, N) couples
+    std::vector<int> precs;
+    std::vector<std::string> simds; // "NO" = the default strategy of the decoder
+    std::vector<int> n_frames;
+    float ebn0 = 2.f;
+    float min_time = 1.f; // minimum benchmark time per configuration (in seconds)
+    int n_buffers = 8;    // number of LLR buffers, the decoder is fed in round robin
+    int seed = 0;
+    std::string out_path;
+    std::vector<std::string> cdc_args; // arguments forwarded to the codec factory
+};
+
+struct Bench_result
+{
+    int n_frames = 0;
+    size_t n_calls = 0;
+    double fer = 0.;
+    double mbps = 0.;
+    double lat_p50 = 0.; // latency of a decoding call (in us)
+    double lat_p90 = 0.;
+    double lat_p99 = 0.;
+    double cycles_per_bit = std::numeric_limits<double>::quiet_NaN();
+};
+
+uint64_t
+read_tsc()
+{
+#ifdef AFF3CT_BENCH_TSC
+    return (uint64_t)__rdtsc();
+#else
+    return 0;
+#endif
+}
+
+std::vector<std::string>
+split_list(const std::string& list)
+{
+    std::vector<std::string> elts;
+    for (auto& e : tools::split(list, ','))
+        if (!e.empty()) elts.push_back(e);
+    return elts;
+}
+
+int
+read_arguments(const int argc, const char** argv, Bench_params& params)
+{
+    cli::Argument_handler ah(argc, argv);
+    cli::Argument_map_info args;
+    cli::Argument_map_group arg_group;
+    std::vector<std::string> cmd_warn, cmd_error;
+
+    const std::string p = "bench";
+    const std::string class_name = "bench::";
+
+    tools::add_arg(
+      args,
+      p,
+      class_name + "p+cde-type,C",
+      cli::Text(cli::Including_set(
+        "POLAR", "POLAR_MK", "TURBO", "TURBO_DB", "TPC", "LDPC", "REP", "RA", "RSC", "RSC_DB", "BCH", "UNCODED", "RS")),
+      cli::arg_rank::REQ);
+    tools::add_arg(args, p, class_name + "p+sizes", cli::Text(), cli::arg_rank::REQ);
+#ifdef AFF3CT_MULTI_PREC
+    tools::add_arg(args, p, class_name + "p+prec", cli::List<int>(cli::Integer(cli::Including_set(8, 16, 32, 64))));
+#endif
+    tools::add_arg(args, p, class_name + "p+simd", cli::Text());
+    tools::add_arg(args, p, class_name + "p+fra", cli::List<int>(cli::Integer(cli::Positive(), cli::Non_zero())));
+    tools::add_arg(args, p, class_name + "p+ebn0", cli::Real());
+    tools::add_arg(args, p, class_name + "p+time", cli::Real(cli::Positive(), cli::Non_zero()));
+    tools::add_arg(args, p, class_name + "p+buffers", cli::Integer(cli::Positive(), cli::Non_zero()));
+    tools::add_arg(args, p, class_name + "p+seed", cli::Integer(cli::Positive()));
+    tools::add_arg(args, p, class_name + "p+out", cli::File(cli::openmode::write));
+    tools::add_arg(args, p, class_name + "help,h", cli::None());
+
+    auto vals = ah.parse_arguments(args, cmd_warn, cmd_error);
+
+    bool display_help = vals.exist({ "help", "h" });
+    try
+    {
+        if (vals.exist({ p + "-cde-type", "C" })) params.cde_type = vals.at({ p + "-cde-type", "C" });
+        if (vals.exist({ p + "-sizes" }))
+            for (auto& s : split_list(vals.at({ p + "-sizes" })))
+            {
+                const auto kn = tools::split(s, ':');
+                if (kn.size() != 2)
+                {
+                    std::stringstream message;
+                    message << "The sizes have to be given as 'K:N' couples ('s' = " << s << ").";
+                    throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+                }
+                params.sizes.push_back(std::make_pair(std::stoi(kn[0]), std::stoi(kn[1])));
+            }
+#ifdef AFF3CT_MULTI_PREC
+        params.precs = { 32 };
+        if (vals.exist({ p + "-prec" })) params.precs = vals.to_list<int>({ p + "-prec" });
+#else
+        params.precs = { (int)(8 * sizeof(Q)) };
+#endif
+        params.simds = { "NO" };
+        if (vals.exist({ p + "-simd" })) params.simds = split_list(vals.at({ p + "-simd" }));
+        for (auto& s : params.simds)
+            if (s != "NO" && s != "INTRA" && s != "INTER")
+            {
+                std::stringstream message;
+                message << "The SIMD strategies have to be 'NO', 'INTRA' or 'INTER' ('s' = " << s << ").";
+                throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+            }
+        params.n_frames = { 1 };
+        if (vals.exist({ p + "-fra" })) params.n_frames = vals.to_list<int>({ p + "-fra" });
+        if (vals.exist({ p + "-ebn0" })) params.ebn0 = vals.to_float({ p + "-ebn0" });
+        if (vals.exist({ p + "-time" })) params.min_time = vals.to_float({ p + "-time" });
+        if (vals.exist({ p + "-buffers" })) params.n_buffers = vals.to_int({ p + "-buffers" });
+        if (vals.exist({ p + "-seed" })) params.seed = vals.to_int({ p + "-seed" });
+        if (vals.exist({ p + "-out" })) params.out_path = vals.at({ p + "-out" });
+    }
+    catch (std::exception& e)
+    {
+        cmd_error.emplace_back(e.what());
+    }
+
+    if (cmd_error.size() || display_help)
+    {
+        arg_group["bench"] = "Benchmark parameter(s)";
+        ah.print_help(args, arg_group, false);
+
+        if (cmd_error.size()) std::cerr << std::endl;
+        for (auto e = 0; e < (int)cmd_error.size(); e++)
+            std::cerr << rang::tag::error << cmd_error[e] << std::endl;
+
+        std::cerr << std::endl
+                  << rang::tag::info
+                  << "The other arguments are given to the codec factory (ex: '--dec-type', '--dec-implem')."
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    // the benchmark arguments and their values are not forwarded to the codec factory
+    for (auto a = 1; a < argc; a++)
+    {
+        const std::string arg = argv[a];
+        if (arg.find("--" + p + "-") == 0 || arg == "-C")
+        {
+            while (a + 1 < argc && (argv[a + 1][0] != '-' || std::isdigit(argv[a + 1][1]) || argv[a + 1][1] == '.'))
+                a++;
+            continue;
+        }
+        params.cdc_args.push_back(arg);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+factory::Codec_SIHO*
+new_codec(const std::string& cde_type)
+{
+    if (cde_type == "POLAR") return new factory::Codec_polar();
+    if (cde_type == "POLAR_MK") return new factory::Codec_polar_MK();
+    if (cde_type == "TURBO") return new factory::Codec_turbo();
+    if (cde_type == "TURBO_DB") return new factory::Codec_turbo_DB();
+    if (cde_type == "TPC") return new factory::Codec_turbo_product();
+    if (cde_type == "LDPC") return new factory::Codec_LDPC();
+    if (cde_type == "REP") return new factory::Codec_repetition();
+    if (cde_type == "RA") return new factory::Codec_RA();
+    if (cde_type == "RSC") return new factory::Codec_RSC();
+    if (cde_type == "RSC_DB") return new factory::Codec_RSC_DB();
+    if (cde_type == "BCH") return new factory::Codec_BCH();
+    if (cde_type == "UNCODED") return new factory::Codec_uncoded();
+    if (cde_type == "RS") return new factory::Codec_RS();
+
+    throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
+}
+
+void
+store_codec_args(const Bench_params& params,
+                 const std::vector<std::string>& matrix_args,
+                 factory::Codec_SIHO& params_cdc,
+                 factory::Quantizer& params_qnt)
+{
+    std::vector<std::string> str_argv = { "aff3ct-bench-dec" };
+    str_argv.insert(str_argv.end(), matrix_args.begin(), matrix_args.end());
+    str_argv.insert(str_argv.end(), params.cdc_args.begin(), params.cdc_args.end());
+
+    std::vector<const char*> argv;
+    for (auto& a : str_argv)
+        argv.push_back(a.c_str());
+
+    cli::Argument_handler ah((int)argv.size(), argv.data());
+    cli::Argument_map_info args;
+    std::vector<std::string> cmd_warn, cmd_error;
+
+    params_cdc.get_description(args);
+    params_qnt.get_description(args);
+    args.erase({ params_cdc.enc->get_prefix() + "-seed", "S" });
+    args.erase({ params_qnt.get_prefix() + "-size", "N" });
+
+    auto vals = ah.parse_arguments(args, cmd_warn, cmd_error);
+    if (!cmd_error.empty())
+    {
+        std::stringstream message;
+        message << "The codec arguments are invalid:";
+        for (auto& e : cmd_error)
+            message << std::endl << e;
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    params_cdc.store(vals);
+    params_qnt.store(vals);
+}
+
+template<typename B, typename R, typename Q>
+Bench_result
+run(const Bench_params& params, const std::vector<std::string>& matrix_args, const std::string& simd, int n_frames)
+{
+    std::unique_ptr<factory::Codec_SIHO> params_cdc(new_codec(params.cde_type));
+    factory::Quantizer params_qnt;
+    if (std::is_floating_point<Q>::value) params_qnt.type = "NO";
+    store_codec_args(params, matrix_args, *params_cdc, params_qnt);
+    params_qnt.size = params_cdc->N_cw;
+
+    // the inter frame SIMD decoders process 'mipp::N<Q>()' frames at once
+    if (simd == "INTER") n_frames = ((n_frames + mipp::N<Q>() - 1) / mipp::N<Q>()) * mipp::N<Q>();
+
+    const auto bit_rate = (R)params_cdc->K / (R)params_cdc->N;
+    const auto esn0 = tools::ebn0_to_esn0((R)params.ebn0, bit_rate);
+    const auto sigma = tools::esn0_to_sigma(esn0);
+    tools::Sigma<> noise((float)sigma, params.ebn0, (float)esn0);
+
+    std::unique_ptr<tools::Codec_SIHO<B, Q>> codec(params_cdc->template build<B, Q>());
+    std::unique_ptr<module::Quantizer<R, Q>> qnt(params_qnt.template build<R, Q>());
+    codec->set_noise(noise);
+    codec->notify_noise_update();
+    codec->set_n_frames(n_frames);
+    qnt->set_n_frames(n_frames);
+
+    auto& enc = codec->get_encoder();
+    auto& dec = codec->get_decoder_siho();
+    const auto K = dec.get_K();
+    const auto N = dec.get_N();
+    if (enc.get_N() != N)
+    {
+        std::stringstream message;
+        message << "The punctured codes are not supported ('enc.get_N()' = " << enc.get_N() << ", 'dec.get_N()' = " << N
+                << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    // generation of the LLRs at a fixed SNR (BPSK over AWGN)
+    std::mt19937 gen(params.seed);
+    std::uniform_int_distribution<int> dist_bit(0, 1);
+    std::normal_distribution<R> dist_noise((R)0, (R)sigma);
+
+    std::vector<std::vector<B>> U_K(params.n_buffers, std::vector<B>(K * n_frames));
+    std::vector<std::vector<Q>> Y_N(params.n_buffers, std::vector<Q>(N * n_frames));
+    std::vector<B> X_N(N * n_frames);
+    std::vector<R> L_N(N * n_frames);
+    std::vector<B> V_K(K * n_frames);
+    for (auto b = 0; b < params.n_buffers; b++)
+    {
+        for (auto& u : U_K[b])
+            u = (B)dist_bit(gen);
+        enc.encode(U_K[b], X_N);
+        for (size_t i = 0; i < X_N.size(); i++)
+            L_N[i] = ((R)1 - (R)2 * (R)X_N[i] + dist_noise(gen)) * (R)2 / (R)(sigma * sigma);
+        qnt->process(L_N, Y_N[b]);
+    }
+
+    Bench_result res;
+    res.n_frames = n_frames;
+
+    // warm-up (caches, branch predictors and CPU frequency)
+    for (auto b = 0; b < params.n_buffers; b++)
+        dec.decode_siho(Y_N[b], V_K);
+
+    std::vector<double> latencies;
+    const auto t_start = std::chrono::steady_clock::now();
+    const auto c_start = read_tsc();
+    auto t_stop = t_start;
+    do
+    {
+        const auto t_call = std::chrono::steady_clock::now();
+        dec.decode_siho(Y_N[res.n_calls % params.n_buffers], V_K);
+        t_stop = std::chrono::steady_clock::now();
+
+        latencies.push_back((double)std::chrono::duration_cast<std::chrono::nanoseconds>(t_stop - t_call).count() /
+                            1000.);
+        res.n_calls++;
+    } while (std::chrono::duration_cast<std::chrono::microseconds>(t_stop - t_start).count() < params.min_time * 1e6 ||
+             res.n_calls < (size_t)params.n_buffers);
+    const auto c_stop = read_tsc();
+
+    const auto n_bits = (double)K * (double)n_frames * (double)res.n_calls;
+    const auto duration_us =
+      (double)std::chrono::duration_cast<std::chrono::nanoseconds>(t_stop - t_start).count() / 1000.;
+    res.mbps = n_bits / duration_us;
+#ifdef AFF3CT_BENCH_TSC
+    res.cycles_per_bit = (double)(c_stop - c_start) / n_bits;
+#endif
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](const double q) -> double
+    {
+        const auto idx = (size_t)std::ceil(q * (double)latencies.size());
+        return latencies[std::min(std::max(idx, (size_t)1), latencies.size()) - 1];
+    };
+    res.lat_p50 = percentile(0.50);
+    res.lat_p90 = percentile(0.90);
+    res.lat_p99 = percentile(0.99);
+
+    // the frame error rate is only a sanity check of the decoder configuration
+    size_t n_fe = 0;
+    for (auto b = 0; b < params.n_buffers; b++)
+    {
+        dec.decode_siho(Y_N[b], V_K);
+        for (auto f = 0; f < n_frames; f++)
+            if (!std::equal(V_K.begin() + f * K, V_K.begin() + (f + 1) * K, U_K[b].begin() + f * K)) n_fe++;
+    }
+    res.fer = (double)n_fe / (double)(params.n_buffers * n_frames);
+
+    return res;
+}
+
+Bench_result
+run(const Bench_params& params,
+    const std::vector<std::string>& matrix_args,
+    const std::string& simd,
+    const int n_frames,
+    const int prec)
+{
+#ifdef AFF3CT_MULTI_PREC
+    switch (prec)
+    {
+        case 8:
+            return run<B_8, R_8, Q_8>(params, matrix_args, simd, n_frames);
+        case 16:
+            return run<B_16, R_16, Q_16>(params, matrix_args, simd, n_frames);
+        case 32:
+            return run<B_32, R_32, Q_32>(params, matrix_args, simd, n_frames);
+        case 64:
+            return run<B_64, R_64, Q_64>(params, matrix_args, simd, n_frames);
+        default:
+            break;
+    }
+    std::stringstream message;
+    message << "Unsupported precision ('prec' = " << prec << ").";
+    throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+#else
+    return run<B, R, Q>(params, matrix_args, simd, n_frames);
+#endif
+}
+
+int
+main(int argc, char** argv)
+{
+    Bench_params params;
+    if (read_arguments(argc, (const char**)argv, params) == EXIT_FAILURE) return EXIT_FAILURE;
+
+    std::ofstream out_file;
+    if (!params.out_path.empty()) out_file.open(params.out_path);
+    std::ostream& out = params.out_path.empty() ? std::cout : out_file;
+
+    std::string affect_version = tools::version() == "GIT-NOTFOUND" ? "" : tools::version();
+    out << "# aff3ct-bench-dec " << affect_version << " (" << mipp::InstructionFullType << ")" << std::endl;
+    out << "code,K,N,prec,simd,n_frames,ebn0,n_calls,fer,mbps,lat_p50_us,lat_p90_us,lat_p99_us,cycles_per_bit"
+        << std::endl;
+
+    int exit_code = EXIT_SUCCESS;
+    for (auto& kn : params.sizes)
+        for (auto prec : params.precs)
+            for (auto& simd : params.simds)
+                for (auto n_frames : params.n_frames)
+                {
+                    std::vector<std::string> matrix_args = {
+                        "-K", std::to_string(kn.first), "-N", std::to_string(kn.second)
+                    };
+                    if (simd != "NO") matrix_args.insert(matrix_args.end(), { "--dec-simd", simd });
+
+                    try
+                    {
+                        const auto res = run(params, matrix_args, simd, n_frames, prec);
+                        out << params.cde_type << "," << kn.first << "," << kn.second << "," << prec << "," << simd
+                            << "," << res.n_frames << "," << params.ebn0 << "," << res.n_calls << "," << res.fer << ","
+                            << std::fixed << std::setprecision(3) << res.mbps << "," << res.lat_p50 << ","
+                            << res.lat_p90 << "," << res.lat_p99 << "," << res.cycles_per_bit << std::endl;
+                        out.unsetf(std::ios_base::floatfield);
+                        out << std::setprecision(6);
+                    }
+                    catch (std::exception const& e)
+                    {
+                        // the configurations which are not supported by the decoder are skipped
+                        rang::format_on_each_line(std::cerr, std::string(e.what()) + "\n", rang::tag::error);
+                        exit_code = EXIT_FAILURE;
+                    }
+                }
+
+    return exit_code;
+}
@@ -338,10 +338,12 @@ rst_epilog = """
 .. |MWBF|      replace:: :abbr:`MWBF     (Modified Weighted Bit Flipping)`
 .. |NEON|      replace:: :abbr:`NEON     (ARM SIMD instructions)`
 .. |NMS|       replace:: :abbr:`NMS      (Normalized Min-Sum)`
+.. |NR|        replace:: :abbr:`NR       (New Radio)`
 .. |OMS|       replace:: :abbr:`OMS      (Offset Min-Sum)`
 .. |ONMS|      replace:: :abbr:`ONMS     (Offset Normalized Min-Sum)`
 .. |OOK|       replace:: :abbr:`OOK      (On-Off Keying)`
 .. |OS|        replace:: :abbr:`OS       (Operating System)`
+.. |OSD|       replace:: :abbr:`OSD      (Ordered Statistics Decoding)`
 .. |OSs|       replace:: :abbr:`OSs      (Operating Systems)`
 .. |PAM|       replace:: :abbr:`PAM      (Pulse-Amplitude Modulation)`
 .. |PDF|       replace:: :abbr:`PDF      (Probability Density Function)`
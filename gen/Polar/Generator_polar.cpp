@@ -0,0 +1,667 @@
+#ifndef _USE_MATH_DEFINES
+#define _USE_MATH_DEFINES
+#endif
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <sstream>
+#include <streampu.hpp>
+
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_rep_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_spc.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+
+#include "Polar/Generator_polar.hpp"
+
+using namespace aff3ct;
+
+// same node types as in the default constructors of the fast decoders
+static std::vector<tools::Pattern_polar_i*>
+get_patterns(const std::string& type)
+{
+    if (type == "SC")
+        return { new tools::Pattern_polar_std,
+                 new tools::Pattern_polar_r0_left,
+                 new tools::Pattern_polar_r0,
+                 new tools::Pattern_polar_r1,
+                 new tools::Pattern_polar_rep_left,
+                 new tools::Pattern_polar_rep,
+                 new tools::Pattern_polar_spc };
+    else
+        return { new tools::Pattern_polar_std,
+                 new tools::Pattern_polar_r0,
+                 new tools::Pattern_polar_r1,
+                 new tools::Pattern_polar_r0_left,
+                 new tools::Pattern_polar_rep_left,
+                 new tools::Pattern_polar_rep,
+                 new tools::Pattern_polar_spc(2, 2) };
+}
+
+// 'ptr' + 'off' without the useless "+ 0"
+static std::string
+add(const std::string& ptr, const int off)
+{
+    return off ? ptr + " + " + std::to_string(off) : ptr;
+}
+
+// the frozen bits are embedded in the generated decoders
+static std::string
+set_frozen_bits_method()
+{
+    std::stringstream stream;
+    stream << "    virtual void set_frozen_bits(const std::vector<bool>& fb)" << std::endl
+           << "    {" << std::endl
+           << "        if (fb.size() != this->frozen_bits.size() ||" << std::endl
+           << "            !std::equal(fb.begin(), fb.end(), this->frozen_bits.begin()))" << std::endl
+           << "            throw spu::tools::invalid_argument(" << std::endl
+           << "              __FILE__, __LINE__, __func__, "
+           << "\"The frozen bits of a generated decoder can't be changed.\");" << std::endl
+           << "    }" << std::endl;
+    return stream.str();
+}
+
+static std::string
+upper(std::string str)
+{
+    std::transform(str.begin(), str.end(), str.begin(), ::toupper);
+    return str;
+}
+
+Generator_polar ::Generator_polar(const std::string& type,
+                                  const int K,
+                                  const int N,
+                                  const std::string& simd_strategy,
+                                  const std::string& tag,
+                                  const std::vector<bool>& frozen_bits)
+  : type(type)
+  , K(K)
+  , N(N)
+  , m((int)std::log2(N))
+  , simd_strategy(simd_strategy)
+  , tag(tag)
+  , frozen_bits(frozen_bits)
+  , polar_patterns(frozen_bits, get_patterns(type), type == "SC" ? 2 : 1, type == "SC" ? 3 : 2, true)
+{
+    if (type != "SC" && type != "SCL")
+    {
+        std::stringstream message;
+        message << "'type' has to be 'SC' or 'SCL' ('type' = " << type << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (!spu::tools::is_power_of_2(N) || N < 2)
+    {
+        std::stringstream message;
+        message << "'N' has to be a power of 2 greater than 1 ('N' = " << N << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (N != (int)frozen_bits.size())
+    {
+        std::stringstream message;
+        message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+                << ", 'N' = " << N << ").";
+        throw spu::tools::length_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (K != (int)std::count(frozen_bits.begin(), frozen_bits.end(), false))
+    {
+        std::stringstream message;
+        message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (simd_strategy != "" && simd_strategy != "INTRA" && simd_strategy != "INTER")
+    {
+        std::stringstream message;
+        message << "'simd_strategy' has to be empty, 'INTRA' or 'INTER' ('simd_strategy' = " << simd_strategy << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (type == "SCL" && simd_strategy == "INTER")
+        throw spu::tools::invalid_argument(
+          __FILE__, __LINE__, __func__, "The inter frame SIMD strategy is not supported by the SCL decoders.");
+
+    // the SCL decoders assume an inner root node (the lists are duplicated from the root children)
+    const auto root_type = polar_patterns.get_node_type(0);
+    if (type == "SCL" && root_type != tools::polar_node_t::STANDARD && root_type != tools::polar_node_t::RATE_0_LEFT &&
+        root_type != tools::polar_node_t::REP_LEFT)
+        throw spu::tools::invalid_argument(
+          __FILE__, __LINE__, __func__, "The root node of the SCL decoders can't be a terminal node.");
+}
+
+const std::string&
+Generator_polar ::get_type() const
+{
+    return this->type;
+}
+
+const std::string&
+Generator_polar ::get_simd_strategy() const
+{
+    return this->simd_strategy;
+}
+
+std::string
+Generator_polar ::get_implem() const
+{
+    const auto implem = "N" + std::to_string(this->N) + "_K" + std::to_string(this->K) + "_" + this->tag;
+    return this->type == "SC" ? implem : "CA_" + implem;
+}
+
+std::string
+Generator_polar ::get_class_name() const
+{
+    if (this->type == "SC")
+        return "Decoder_polar_SC_fast_sys_" + this->get_implem();
+    else
+        return "Decoder_polar_SCL_fast_CA_sys_" + this->get_implem().substr(3);
+}
+
+std::string
+Generator_polar ::get_fb_name() const
+{
+    const auto name = this->get_class_name();
+    const auto pos = name.rfind("_sys_") + 5;
+    return name.substr(0, pos) + "fb_" + name.substr(pos);
+}
+
+std::string
+Generator_polar ::get_header_path() const
+{
+    const auto dir =
+      this->type == "SC" ? "Module/Decoder/Polar/SC/Generated/" : "Module/Decoder/Polar/SCL/CRC/Generated/";
+    return dir + this->get_class_name() + ".hpp";
+}
+
+void
+Generator_polar ::generate(std::ostream& stream, const std::string& origin) const
+{
+    const auto class_name = this->get_class_name();
+    const auto guard = upper(class_name) + "_HPP_";
+    const auto base_header = this->type == "SC" ? "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp"
+                                                : "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp";
+
+    stream << "/*!" << std::endl
+           << " * \\file" << std::endl
+           << " * \\brief Class module::" << class_name << "." << std::endl
+           << " *" << std::endl
+           << " * Generated by aff3ct-gen-polar from \"" << origin << "\", do not edit." << std::endl
+           << " */" << std::endl
+           << "#ifndef " << guard << std::endl
+           << "#define " << guard << std::endl
+           << std::endl
+           << "#include <algorithm>" << std::endl
+           << "#include <streampu.hpp>" << std::endl
+           << "#include <string>" << std::endl
+           << "#include <vector>" << std::endl
+           << std::endl
+           << "#include \"" << base_header << "\"" << std::endl
+           << std::endl
+           << "namespace aff3ct" << std::endl
+           << "{" << std::endl
+           << "namespace module" << std::endl
+           << "{" << std::endl;
+
+    this->generate_frozen_bits(stream);
+    stream << std::endl;
+
+    if (this->type == "SC")
+        this->generate_class_SC(stream);
+    else
+        this->generate_class_SCL(stream);
+
+    stream << "}" << std::endl
+           << "}" << std::endl
+           << std::endl
+           << "#endif /* " << guard << " */" << std::endl;
+}
+
+void
+Generator_polar ::generate_frozen_bits(std::ostream& stream) const
+{
+    stream << "static const std::vector<bool> " << this->get_fb_name() << " = {";
+    for (auto i = 0; i < this->N; i++)
+    {
+        if (i % 32 == 0) stream << std::endl << "    ";
+        stream << this->frozen_bits[i] << (i < this->N - 1 ? (i % 32 == 31 ? "," : ", ") : "");
+    }
+    stream << std::endl << "};" << std::endl;
+}
+
+void
+Generator_polar ::generate_class_SC(std::ostream& stream) const
+{
+    const auto class_name = this->get_class_name();
+    const auto base_name = "Decoder_polar_SC_fast_sys<B, R, API_polar>";
+
+    stream << "template<typename B, typename R, class API_polar>" << std::endl
+           << "class " << class_name << " : public " << base_name << std::endl
+           << "{" << std::endl
+           << "  public:" << std::endl
+           << "    " << class_name << "(const int& K, const int& N)" << std::endl
+           << "      : " << base_name << "(K, N, " << this->get_fb_name() << ")" << std::endl
+           << "    {" << std::endl
+           << "        const std::string name = \"" << class_name << "\";" << std::endl
+           << "        this->set_name(name);" << std::endl
+           << "    }" << std::endl
+           << std::endl
+           << "    virtual ~" << class_name << "() = default;" << std::endl
+           << std::endl
+           << "    virtual " << class_name << "<B, R, API_polar>* clone() const" << std::endl
+           << "    {" << std::endl
+           << "        auto m = new " << class_name << "(*this);" << std::endl
+           << "        m->deep_copy(*this);" << std::endl
+           << "        return m;" << std::endl
+           << "    }" << std::endl
+           << std::endl
+           << set_frozen_bits_method() << std::endl
+           << "  protected:" << std::endl
+           << "    void _decode()" << std::endl
+           << "    {" << std::endl
+           << "        auto& l = this->l;" << std::endl
+           << "        auto& s = this->s;" << std::endl
+           << std::endl;
+
+    int node_id = 0;
+    this->recursive_generate_SC(stream, 0, 0, this->m, node_id);
+
+    stream << "    }" << std::endl << "};" << std::endl;
+}
+
+void
+Generator_polar ::generate_class_SCL(std::ostream& stream) const
+{
+    const auto class_name = this->get_class_name();
+    const auto base_name = "Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>";
+
+    stream << "template<typename B, typename R, class API_polar>" << std::endl
+           << "class " << class_name << " : public " << base_name << std::endl
+           << "{" << std::endl
+           << "  public:" << std::endl
+           << "    " << class_name << "(const int& K, const int& N, const int& L, const CRC<B>& crc)" << std::endl
+           << "      : " << base_name << "(K, N, L, " << this->get_fb_name() << ", crc)" << std::endl
+           << "    {" << std::endl
+           << "        const std::string name = \"" << class_name << "\";" << std::endl
+           << "        this->set_name(name);" << std::endl
+           << "    }" << std::endl
+           << std::endl
+           << "    virtual ~" << class_name << "() = default;" << std::endl
+           << std::endl
+           << "    virtual " << class_name << "<B, R, API_polar>* clone() const" << std::endl
+           << "    {" << std::endl
+           << "        auto m = new " << class_name << "(*this);" << std::endl
+           << "        m->deep_copy(*this);" << std::endl
+           << "        return m;" << std::endl
+           << "    }" << std::endl
+           << std::endl
+           << set_frozen_bits_method() << std::endl
+           << "  protected:" << std::endl
+           << "    void _decode(const R* Y_N)" << std::endl
+           << "    {" << std::endl
+           << "        auto& l = this->l;" << std::endl
+           << "        auto& s = this->s;" << std::endl
+           << "        auto& paths = this->paths;" << std::endl
+           << "        auto& path_2_array = this->path_2_array;" << std::endl
+           << std::endl;
+
+    int node_id = 0;
+    this->recursive_generate_SCL(stream, 0, 0, this->m, node_id);
+
+    stream << "    }" << std::endl << "};" << std::endl;
+}
+
+void
+Generator_polar ::recursive_generate_SC(std::ostream& stream,
+                                        const int off_l,
+                                        const int off_s,
+                                        const int rev_depth,
+                                        int& node_id) const
+{
+    const std::string tab = "        ";
+    const int n_elmts = 1 << rev_depth;
+    const int n_elm_2 = n_elmts >> 1;
+    const auto node_type = polar_patterns.get_node_type(node_id);
+    const auto s_n = std::to_string(n_elmts);
+    const auto s_n2 = std::to_string(n_elm_2);
+
+    const bool is_terminal_pattern =
+      (node_type == tools::polar_node_t::RATE_0) || (node_type == tools::polar_node_t::RATE_1) ||
+      (node_type == tools::polar_node_t::REP) || (node_type == tools::polar_node_t::SPC);
+
+    if (!is_terminal_pattern && rev_depth)
+    {
+        const auto a = std::to_string(off_l);
+        const auto b = std::to_string(off_l + n_elm_2);
+        const auto c = std::to_string(off_l + n_elmts);
+        const auto sa = std::to_string(off_s);
+        const auto sb = std::to_string(off_s + n_elm_2);
+
+        // f
+        if (node_type == tools::polar_node_t::STANDARD || node_type == tools::polar_node_t::REP_LEFT)
+            stream << tab << "API_polar::template f<" << s_n2 << ">(l, " << a << ", " << b << ", " << c << ", " << s_n2
+                   << ");" << std::endl;
+
+        this->recursive_generate_SC(stream, off_l + n_elmts, off_s, rev_depth - 1, ++node_id); // left
+
+        // g
+        switch (node_type)
+        {
+            case tools::polar_node_t::STANDARD:
+                stream << tab << "API_polar::template g<" << s_n2 << ">(s, l, " << a << ", " << b << ", " << sa << ", "
+                       << c << ", " << s_n2 << ");" << std::endl;
+                break;
+            case tools::polar_node_t::RATE_0_LEFT:
+                stream << tab << "API_polar::template g0<" << s_n2 << ">(l, " << a << ", " << b << ", " << c << ", "
+                       << s_n2 << ");" << std::endl;
+                break;
+            case tools::polar_node_t::REP_LEFT:
+                stream << tab << "API_polar::template gr<" << s_n2 << ">(s, l, " << a << ", " << b << ", " << sa
+                       << ", " << c << ", " << s_n2 << ");" << std::endl;
+                break;
+            default:
+                break;
+        }
+
+        this->recursive_generate_SC(stream, off_l + n_elmts, off_s + n_elm_2, rev_depth - 1, ++node_id); // right
+
+        // xor
+        switch (node_type)
+        {
+            case tools::polar_node_t::STANDARD:
+            case tools::polar_node_t::REP_LEFT:
+                stream << tab << "API_polar::template xo<" << s_n2 << ">(s, " << sa << ", " << sb << ", " << sa << ", "
+                       << s_n2 << ");" << std::endl;
+                break;
+            case tools::polar_node_t::RATE_0_LEFT:
+                stream << tab << "API_polar::template xo0<" << s_n2 << ">(s, " << sb << ", " << sa << ", " << s_n2
+                       << ");" << std::endl;
+                break;
+            default:
+                break;
+        }
+    }
+    else
+    {
+        const auto a = std::to_string(off_l);
+        const auto sa = std::to_string(off_s);
+
+        // h
+        switch (node_type)
+        {
+            case tools::polar_node_t::RATE_0:
+                stream << tab << "API_polar::template h0<" << s_n << ">(s, " << sa << ", " << s_n << ");" << std::endl;
+                break;
+            case tools::polar_node_t::RATE_1:
+                stream << tab << "API_polar::template h<" << s_n << ">(s, l, " << a << ", " << sa << ", " << s_n << ");"
+                       << std::endl;
+                break;
+            case tools::polar_node_t::REP:
+                stream << tab << "API_polar::template rep<" << s_n << ">(s, l, " << a << ", " << sa << ", " << s_n
+                       << ");" << std::endl;
+                break;
+            case tools::polar_node_t::SPC:
+                stream << tab << "API_polar::template spc<" << s_n << ">(s, l, " << a << ", " << sa << ", " << s_n
+                       << ");" << std::endl;
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void
+Generator_polar ::recursive_generate_SCL(std::ostream& stream,
+                                         const int off_l,
+                                         const int off_s,
+                                         const int rev_depth,
+                                         int& node_id) const
+{
+    const std::string tab = "        ";
+    const int n_elmts = 1 << rev_depth;
+    const int n_elm_2 = n_elmts >> 1;
+    const auto node_type = polar_patterns.get_node_type(node_id);
+    const auto s_n = std::to_string(n_elmts);
+    const auto s_n2 = std::to_string(n_elm_2);
+    const auto s_rd = std::to_string(rev_depth);
+    const auto s_rd_1 = std::to_string(rev_depth - 1);
+
+    const bool is_terminal_pattern =
+      (node_type == tools::polar_node_t::RATE_0) || (node_type == tools::polar_node_t::RATE_1) ||
+      (node_type == tools::polar_node_t::REP) || (node_type == tools::polar_node_t::SPC);
+
+    // loop over the active paths, 'body' is the last line of the loop
+    auto for_paths = [&](const std::string& cond, const bool parent, const std::string& body)
+    {
+        stream << tab << "for (auto i = 0; i < this->n_active_paths" << cond << "; i++)" << std::endl
+               << tab << "{" << std::endl
+               << tab << "    const auto path = paths[i];" << std::endl;
+        if (parent)
+            stream << tab << "    const auto parent = l[path_2_array[path][" << s_rd << "]].data();" << std::endl;
+        stream << tab << "    const auto child = l[this->up_ref_array_idx(path, " << s_rd_1 << ")].data();" << std::endl
+               << tab << "    " << body << std::endl
+               << tab << "}" << std::endl;
+    };
+
+    auto xor_paths = [&]()
+    {
+        const auto sa = std::to_string(off_s);
+        const auto sb = std::to_string(off_s + n_elm_2);
+        stream << tab << "for (auto i = 0; i < this->n_active_paths; i++)" << std::endl << tab << "    ";
+        switch (node_type)
+        {
+            case tools::polar_node_t::STANDARD:
+            case tools::polar_node_t::REP_LEFT:
+                stream << "API_polar::template xo<" << s_n2 << ">(s[paths[i]], " << sa << ", " << sb << ", " << sa
+                       << ", " << s_n2 << ");" << std::endl;
+                break;
+            case tools::polar_node_t::RATE_0_LEFT:
+                stream << "API_polar::template xo0<" << s_n2 << ">(s[paths[i]], " << sb << ", " << sa << ", " << s_n2
+                       << ");" << std::endl;
+                break;
+            default:
+                break;
+        }
+    };
+
+    if (rev_depth == this->m) // root node
+    {
+        const auto s_pa = add("s[path].data()", off_s);
+
+        // f
+        if (node_type == tools::polar_node_t::STANDARD || node_type == tools::polar_node_t::REP_LEFT)
+            stream << tab << "API_polar::template f<" << s_n2 << ">(Y_N, Y_N + " << s_n2 << ", l[0].data(), " << s_n2
+                   << ");" << std::endl;
+
+        this->recursive_generate_SCL(stream, off_l, off_s, rev_depth - 1, ++node_id); // left
+
+        // g
+        switch (node_type)
+        {
+            case tools::polar_node_t::STANDARD:
+                for_paths("",
+                          false,
+                          "API_polar::template g<" + s_n2 + ">(Y_N, Y_N + " + s_n2 + ", " + s_pa + ", child, " + s_n2 +
+                            ");");
+                break;
+            case tools::polar_node_t::RATE_0_LEFT:
+                for_paths(
+                  "", false, "API_polar::template g0<" + s_n2 + ">(Y_N, Y_N + " + s_n2 + ", child, " + s_n2 + ");");
+                break;
+            case tools::polar_node_t::REP_LEFT:
+                for_paths("",
+                          false,
+                          "API_polar::template gr<" + s_n2 + ">(Y_N, Y_N + " + s_n2 + ", " + s_pa + ", child, " + s_n2 +
+                            ");");
+                break;
+            default:
+                break;
+        }
+
+        this->recursive_generate_SCL(stream, off_l, off_s + n_elm_2, rev_depth - 1, ++node_id); // right
+
+        xor_paths();
+    }
+    else if (!is_terminal_pattern && rev_depth) // inner node
+    {
+        const auto p_a = add("parent", off_l);
+        const auto p_b = add("parent", off_l + n_elm_2);
+        const auto c_c = add("child", off_l + n_elmts);
+        const auto s_pa = add("s[path].data()", off_s);
+
+        // f
+        switch (node_type)
+        {
+            case tools::polar_node_t::STANDARD:
+            case tools::polar_node_t::REP_LEFT:
+                for_paths("",
+                          true,
+                          "API_polar::template f<" + s_n2 + ">(" + p_a + ", " + p_b + ", " + c_c + ", " + s_n2 + ");");
+                break;
+            case tools::polar_node_t::RATE_0_LEFT:
+                for_paths(" && this->n_active_paths > 1",
+                          true,
+                          "API_polar::template f<" + s_n2 + ">(" + p_a + ", " + p_b + ", " + c_c + ", " + s_n2 + ");");
+                break;
+            default:
+                break;
+        }
+
+        this->recursive_generate_SCL(stream, off_l + n_elmts, off_s, rev_depth - 1, ++node_id); // left
+
+        // g
+        switch (node_type)
+        {
+            case tools::polar_node_t::STANDARD:
+                for_paths("",
+                          true,
+                          "API_polar::template g<" + s_n2 + ">(" + p_a + ", " + p_b + ", " + s_pa + ", " + c_c + ", " +
+                            s_n2 + ");");
+                break;
+            case tools::polar_node_t::RATE_0_LEFT:
+                for_paths("",
+                          true,
+                          "API_polar::template g0<" + s_n2 + ">(" + p_a + ", " + p_b + ", " + c_c + ", " + s_n2 + ");");
+                break;
+            case tools::polar_node_t::REP_LEFT:
+                for_paths("",
+                          true,
+                          "API_polar::template gr<" + s_n2 + ">(" + p_a + ", " + p_b + ", " + s_pa + ", " + c_c +
+                            ", " + s_n2 + ");");
+                break;
+            default:
+                break;
+        }
+
+        this->recursive_generate_SCL(stream, off_l + n_elmts, off_s + n_elm_2, rev_depth - 1, ++node_id); // right
+
+        xor_paths();
+    }
+    else // leaf node
+    {
+        const auto args = "<" + s_rd + ", " + s_n + ">(" + std::to_string(off_l) + ", " + std::to_string(off_s) + ");";
+
+        // h
+        switch (node_type)
+        {
+            case tools::polar_node_t::RATE_0:
+                stream << tab << "this->template update_paths_r0" << args << std::endl;
+                break;
+            case tools::polar_node_t::REP:
+                stream << tab << "this->template update_paths_rep" << args << std::endl;
+                break;
+            case tools::polar_node_t::RATE_1:
+                stream << tab << "this->template update_paths_r1" << args << std::endl;
+                break;
+            case tools::polar_node_t::SPC:
+                stream << tab << "this->template update_paths_spc" << args << std::endl;
+                break;
+            default:
+                break;
+        }
+
+        stream << tab << "normalize_scl_metrics<R>(this->metrics, this->L);" << std::endl;
+    }
+}
+
+void
+Generator_polar ::generate_registry(const std::vector<Generator_polar*>& generators, std::ostream& stream)
+{
+    stream << "/*!" << std::endl
+           << " * \\file" << std::endl
+           << " * \\brief Generated Polar decoders, registered in factory::Decoder_polar." << std::endl
+           << " *" << std::endl
+           << " * Generated by aff3ct-gen-polar, do not edit." << std::endl
+           << " */" << std::endl
+           << "#ifndef DECODER_POLAR_GENERATED_HPP_" << std::endl
+           << "#define DECODER_POLAR_GENERATED_HPP_" << std::endl
+           << std::endl
+           << "#include <string>" << std::endl
+           << "#include <vector>" << std::endl
+           << std::endl
+           << "#include \"Module/CRC/CRC.hpp\"" << std::endl
+           << "#include \"Module/Decoder/Decoder_SIHO.hpp\"" << std::endl;
+
+    std::set<std::string> headers;
+    for (auto g : generators)
+        headers.insert(g->get_header_path());
+    for (auto& h : headers)
+        stream << "#include \"" << h << "\"" << std::endl;
+
+    stream << std::endl
+           << "namespace aff3ct" << std::endl
+           << "{" << std::endl
+           << "namespace factory" << std::endl
+           << "{" << std::endl
+           << "struct Decoder_polar_generated" << std::endl
+           << "{" << std::endl
+           << "    template<typename B, typename Q, class API_polar>" << std::endl
+           << "    static module::Decoder_SIHO<B, Q>* build(const std::string& type," << std::endl
+           << "                                             const std::string& implem," << std::endl
+           << "                                             const std::string& simd_strategy," << std::endl
+           << "                                             const int K," << std::endl
+           << "                                             const int N," << std::endl
+           << "                                             const int L," << std::endl
+           << "                                             const module::CRC<B>* crc)" << std::endl
+           << "    {" << std::endl;
+
+    for (auto g : generators)
+    {
+        stream << "        if (type == \"" << g->get_type() << "\" && implem == \"" << g->get_implem()
+               << "\" && simd_strategy == \"" << g->get_simd_strategy() << "\"";
+        if (g->get_type() == "SC")
+            stream << ")" << std::endl
+                   << "            return new module::" << g->get_class_name() << "<B, Q, API_polar>(K, N);"
+                   << std::endl;
+        else
+            stream << " && crc != nullptr)" << std::endl
+                   << "            return new module::" << g->get_class_name() << "<B, Q, API_polar>(K, N, L, *crc);"
+                   << std::endl;
+    }
+
+    stream << std::endl
+           << "        return nullptr;" << std::endl
+           << "    }" << std::endl
+           << std::endl
+           << "    static const std::vector<bool>* get_frozen_bits(const std::string& implem)" << std::endl
+           << "    {" << std::endl;
+
+    std::set<std::string> implems;
+    for (auto g : generators)
+        if (implems.insert(g->get_implem()).second)
+            stream << "        if (implem == \"" << g->get_implem() << "\") return &module::" << g->get_fb_name() << ";"
+                   << std::endl;
+
+    stream << std::endl
+           << "        return nullptr;" << std::endl
+           << "    }" << std::endl
+           << "};" << std::endl
+           << "}" << std::endl
+           << "}" << std::endl
+           << std::endl
+           << "#endif /* DECODER_POLAR_GENERATED_HPP_ */" << std::endl;
+}
@@ -0,0 +1,86 @@
+/*!
+ * \file
+ * \brief Class Generator_polar.
+ */
+#ifndef GENERATOR_POLAR_HPP_
+#define GENERATOR_POLAR_HPP_
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+
+namespace aff3ct
+{
+/*
+ * Emits the header of a fully unrolled fast systematic Polar decoder (SC or CA-SCL) for a fixed set of frozen bits.
+ * The decoding tree is parsed with the node types of the fast decoders and walked in the same order as their
+ * 'tools::Polar_schedule': each node becomes a straight-line call to the 'API_polar_static_*' kernels with constant
+ * offsets and sizes. The emitted class inherits from the fast decoder so the load, the store and the CRC checks are
+ * shared with it.
+ */
+class Generator_polar
+{
+  protected:
+    const std::string type; // "SC" or "SCL"
+    const int K;
+    const int N;
+    const int m;
+    const std::string simd_strategy; // "" (sequential), "INTRA" or "INTER"
+    const std::string tag;           // frozen bits source (ex: "SNR25")
+    const std::vector<bool> frozen_bits;
+    tools::Pattern_polar_parser polar_patterns;
+
+  public:
+    Generator_polar(const std::string& type,
+                    const int K,
+                    const int N,
+                    const std::string& simd_strategy,
+                    const std::string& tag,
+                    const std::vector<bool>& frozen_bits);
+
+    virtual ~Generator_polar() = default;
+
+    const std::string& get_type() const;
+    const std::string& get_simd_strategy() const;
+
+    /*
+     * Value of the '--dec-implem' parameter which selects the decoder (ex: "N1024_K512_SNR25")
+     */
+    std::string get_implem() const;
+
+    std::string get_class_name() const;
+    std::string get_fb_name() const;
+
+    /*
+     * Path of the header relatively to the root of the generated files (ex: "Module/Decoder/Polar/SC/Generated/...")
+     */
+    std::string get_header_path() const;
+
+    void generate(std::ostream& stream, const std::string& origin) const;
+
+    /*
+     * Emits the header which includes the generated decoders and registers them in 'factory::Decoder_polar'
+     */
+    static void generate_registry(const std::vector<Generator_polar*>& generators, std::ostream& stream);
+
+  private:
+    void generate_frozen_bits(std::ostream& stream) const;
+    void generate_class_SC(std::ostream& stream) const;
+    void generate_class_SCL(std::ostream& stream) const;
+
+    void recursive_generate_SC(std::ostream& stream,
+                               const int off_l,
+                               const int off_s,
+                               const int rev_depth,
+                               int& node_id) const;
+    void recursive_generate_SCL(std::ostream& stream,
+                                const int off_l,
+                                const int off_s,
+                                const int rev_depth,
+                                int& node_id) const;
+};
+}
+
+#endif /* GENERATOR_POLAR_HPP_ */
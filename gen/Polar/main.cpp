@@ -0,0 +1,246 @@
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cli.hpp>
+#include <streampu.hpp>
+
+#include "Factory/Tools/Code/Polar/Frozenbits_generator.hpp"
+#include "Tools/Display/rang_format/rang_format.h"
+#include "Tools/Documentation/documentation.h"
+#include "Tools/Noise/Event_probability.hpp"
+#include "Tools/Noise/Sigma.hpp"
+#include "Tools/general_utils.h"
+
+#include "Polar/Generator_polar.hpp"
+
+using namespace aff3ct;
+
+/*
+ * Build time generator of the unrolled Polar decoders: each 'TYPE:N:K:SIMD:FB' tuple gives one decoder header and the
+ * registry header includes all of them. The files are only rewritten when their content changes so the incremental
+ * builds do not recompile the factory for nothing.
+ */
+
+struct Gen_params
+{
+    std::vector<std::string> decoders; // 'TYPE:N:K:SIMD:FB' tuples
+    std::string out_dir;
+};
+
+int
+read_arguments(const int argc, const char** argv, Gen_params& params)
+{
+    cli::Argument_handler ah(argc, argv);
+    cli::Argument_map_info args;
+    cli::Argument_map_group arg_group;
+    std::vector<std::string> cmd_warn, cmd_error;
+
+    const std::string p = "gen";
+    const std::string class_name = "gen::";
+
+    tools::add_arg(args, p, class_name + "p+decoders", cli::Text(), cli::arg_rank::REQ);
+    tools::add_arg(args, p, class_name + "p+dir", cli::Folder(cli::openmode::write), cli::arg_rank::REQ);
+    tools::add_arg(args, p, class_name + "help,h", cli::None());
+
+    auto vals = ah.parse_arguments(args, cmd_warn, cmd_error);
+
+    bool display_help = vals.exist({ "help", "h" });
+    try
+    {
+        if (vals.exist({ p + "-decoders" }))
+            for (auto& d : tools::split(vals.at({ p + "-decoders" }), ','))
+                if (!d.empty()) params.decoders.push_back(d);
+        if (vals.exist({ p + "-dir" })) params.out_dir = vals.at({ p + "-dir" });
+    }
+    catch (std::exception& e)
+    {
+        cmd_error.emplace_back(e.what());
+    }
+
+    if (cmd_error.size() || display_help)
+    {
+        arg_group["gen"] = "Generator parameter(s)";
+        ah.print_help(args, arg_group, false);
+
+        if (cmd_error.size()) std::cerr << std::endl;
+        for (auto e = 0; e < (int)cmd_error.size(); e++)
+            std::cerr << rang::tag::error << cmd_error[e] << std::endl;
+
+        std::cerr << std::endl
+                  << rang::tag::info
+                  << "A decoder is given as 'TYPE:N:K:SIMD:FB' with TYPE in {SC, SCL}, SIMD in {SEQ, INTRA, INTER} "
+                     "and FB in {GA=<Eb/N0 dB>, TV=<Eb/N0 dB>, BEC=<erasure probability>, 5G, FILE=<path>}."
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// parse a 'TYPE:N:K:SIMD:FB' tuple and compute its frozen bits
+Generator_polar*
+new_generator(const std::string& tuple)
+{
+    // the frozen bits source comes last and may contain ':' (ex: a Windows path)
+    std::vector<std::string> fields;
+    size_t pos = 0;
+    for (auto f = 0; f < 4; f++)
+    {
+        const auto next = tuple.find(':', pos);
+        if (next == std::string::npos) break;
+        fields.push_back(tuple.substr(pos, next - pos));
+        pos = next + 1;
+    }
+    fields.push_back(tuple.substr(pos));
+
+    if (fields.size() != 5)
+    {
+        std::stringstream message;
+        message << "The decoders have to be given as 'TYPE:N:K:SIMD:FB' tuples ('tuple' = " << tuple << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    const auto type = fields[0];
+    const auto N = std::stoi(fields[1]);
+    const auto K = std::stoi(fields[2]);
+    const auto simd = fields[3];
+    const auto fb_src = fields[4];
+
+    if (simd != "SEQ" && simd != "INTRA" && simd != "INTER")
+    {
+        std::stringstream message;
+        message << "The SIMD strategy has to be 'SEQ', 'INTRA' or 'INTER' ('simd' = " << simd << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    const auto eq = fb_src.find('=');
+    const auto fb_type = fb_src.substr(0, eq);
+    const auto fb_value = eq == std::string::npos ? std::string() : fb_src.substr(eq + 1);
+
+    factory::Frozenbits_generator fb_params;
+    fb_params.type = fb_type;
+    fb_params.K = K;
+    fb_params.N_cw = N;
+
+    std::string tag;
+    std::unique_ptr<tools::Noise<>> noise;
+    if (fb_type == "GA" || fb_type == "TV")
+    {
+        const auto ebn0 = std::stof(fb_value);
+        const auto esn0 = tools::ebn0_to_esn0(ebn0, (float)K / (float)N);
+        noise.reset(new tools::Sigma<>(tools::esn0_to_sigma(esn0), ebn0, esn0));
+        tag = (fb_type == "TV" ? "TV_SNR" : "SNR") + std::to_string(std::lround(ebn0 * 10));
+    }
+    else if (fb_type == "BEC")
+    {
+        const auto ep = std::stof(fb_value);
+        noise.reset(new tools::Event_probability<>(ep));
+        tag = "BEC" + std::to_string(std::lround(ep * 1000));
+    }
+    else if (fb_type == "5G")
+    {
+        noise.reset(new tools::Sigma<>(1.f)); // the 5G frozen bits do not depend on the noise
+        tag = "5G";
+    }
+    else if (fb_type == "FILE")
+    {
+        fb_params.path_fb = fb_value;
+        noise.reset(new tools::Sigma<>(1.f)); // the file is looked up with the sigma, the FILE generator ignores it
+
+        auto stem = fb_value.substr(fb_value.find_last_of("/\\") + 1);
+        stem = stem.substr(0, stem.find('.'));
+        for (auto& c : stem)
+            if (!std::isalnum((unsigned char)c)) c = '_';
+        tag = "FILE_" + stem;
+    }
+    else
+    {
+        std::stringstream message;
+        message << "The frozen bits source has to be 'GA=<Eb/N0 dB>', 'TV=<Eb/N0 dB>', 'BEC=<erasure probability>', "
+                << "'5G' or 'FILE=<path>' ('fb' = " << fb_src << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    std::vector<bool> frozen_bits(N);
+    std::unique_ptr<tools::Frozenbits_generator> fb_generator(fb_params.build());
+    fb_generator->set_noise(*noise);
+    fb_generator->generate(frozen_bits);
+
+    return new Generator_polar(type, K, N, simd == "SEQ" ? "" : simd, tag, frozen_bits);
+}
+
+// write 'content' in 'path' only if it differs from the current file
+void
+write_if_changed(const std::string& path, const std::string& content)
+{
+    std::ifstream in_file(path, std::ios::binary);
+    if (in_file.is_open())
+    {
+        std::stringstream current;
+        current << in_file.rdbuf();
+        if (current.str() == content) return;
+    }
+
+    std::ofstream out_file(path, std::ios::binary);
+    if (!out_file.is_open())
+    {
+        std::stringstream message;
+        message << "The file can't be written ('path' = " << path << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+    out_file << content;
+}
+
+int
+main(int argc, char** argv)
+{
+    Gen_params params;
+    if (read_arguments(argc, (const char**)argv, params) == EXIT_FAILURE) return EXIT_FAILURE;
+
+    std::vector<Generator_polar*> generators;
+    int exit_code = EXIT_SUCCESS;
+    try
+    {
+        std::set<std::string> entries;
+        for (auto& d : params.decoders)
+        {
+            generators.push_back(new_generator(d));
+
+            const auto entry = generators.back()->get_type() + ":" + generators.back()->get_implem() + ":" +
+                               generators.back()->get_simd_strategy();
+            if (!entries.insert(entry).second)
+            {
+                std::stringstream message;
+                message << "The decoder is generated twice ('tuple' = " << d << ").";
+                throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+            }
+
+            // the same decoder class may be registered with several SIMD strategies, its header is the same
+            std::stringstream header;
+            generators.back()->generate(header, d);
+            write_if_changed(params.out_dir + "/" + generators.back()->get_header_path(), header.str());
+        }
+
+        std::stringstream registry;
+        Generator_polar::generate_registry(generators, registry);
+        write_if_changed(params.out_dir + "/Factory/Module/Decoder/Polar/Decoder_polar_generated.hpp", registry.str());
+    }
+    catch (std::exception const& e)
+    {
+        rang::format_on_each_line(std::cerr, std::string(e.what()) + "\n", rang::tag::error);
+        exit_code = EXIT_FAILURE;
+    }
+
+    for (auto g : generators)
+        delete g;
+
+    return exit_code;
+}
@@ -32,6 +32,8 @@ class Channel : public Factory
     std::string implem = "STD";
     std::string path = "";
     std::string block_fading = "NO";
+    std::string is_bias = "NONE"; // importance sampling bias of the noise
+    float is_factor = 1.f;
     bool add_users = false;
     bool complex = false;
     int seed = 0;
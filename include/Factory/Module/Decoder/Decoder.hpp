@@ -36,6 +36,7 @@ class Decoder : public Factory
     bool hamming = false;
     int tail_length = 0;
     int flips = 3;
+    int order = 2;
     int seed = 0;
 
     // deduced parameters
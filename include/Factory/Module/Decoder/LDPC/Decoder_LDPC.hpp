@@ -40,6 +40,8 @@ class Decoder_LDPC : public Decoder
     bool enable_syndrome = true;
     int syndrome_depth = 1;
     int n_ite = 10;
+    int Z = 0; // lifting size of the QC matrix (0 if unknown)
+    bool lane_refill = false;
 
     std::vector<float> ppbf_proba;
 
@@ -63,6 +65,9 @@ class Decoder_LDPC : public Decoder
     module::Decoder_SISO<B, Q>* build_siso(const tools::Sparse_matrix& H,
                                            const std::vector<unsigned>& info_bits_pos,
                                            module::Encoder<B>* encoder = nullptr) const;
+
+  private:
+    void check_lane_refill() const;
 };
 }
 }
@@ -61,6 +61,11 @@ class Decoder_polar : public Decoder
 
     static const std::vector<bool>& get_frozen_bits(const std::string& implem);
 
+    /*
+     * True if 'implem' names a decoder generated at build time (see the 'AFF3CT_POLAR_GEN_DECODERS' CMake option)
+     */
+    static bool is_generated(const std::string& implem);
+
   private:
     template<typename B = int, typename Q = float, class API_polar>
     module::Decoder_SIHO<B, Q>* _build(const std::vector<bool>& frozen_bits,
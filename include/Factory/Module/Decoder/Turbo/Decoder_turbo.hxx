@@ -258,7 +258,7 @@ Decoder_turbo<D1, D2>::get_headers(std::map<std::string, tools::header_list>& he
 
     if (itl != nullptr) itl->get_headers(headers, full);
 
-    if (this->type != "ML" && this->type != "CHASE")
+    if (this->type != "ML" && this->type != "CHASE" && this->type != "OSD")
     {
         auto p = this->get_prefix();
 
@@ -13,6 +13,7 @@
 #include "Module/Encoder/LDPC/Encoder_LDPC.hpp"
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 #include "Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants.hpp"
+#include "Tools/Code/LDPC/Standard/NR/NR_constants.hpp"
 #include "Tools/Factory/Header.hpp"
 
 namespace aff3ct
@@ -36,6 +37,10 @@ class Encoder_LDPC : public Encoder
     std::string G_method = "IDENTITY";
     std::string G_save_path = "";
 
+    // 5G NR
+    int NR_BG = 0; // base graph (0 = selected from the info bits and the code rate)
+    std::string NR_bg_path = "";
+
     // -------------------------------------------------------------------------------------------------------- METHODS
     explicit Encoder_LDPC(const std::string& p = Encoder_LDPC_prefix);
     virtual ~Encoder_LDPC() = default;
@@ -53,6 +58,10 @@ class Encoder_LDPC : public Encoder
     module::Encoder_LDPC<B>* build(const tools::Sparse_matrix& G,
                                    const tools::Sparse_matrix& H,
                                    const tools::dvbs2_values& dvbs2) const;
+    template<typename B = int>
+    module::Encoder_LDPC<B>* build(const tools::Sparse_matrix& G,
+                                   const tools::Sparse_matrix& H,
+                                   const tools::nr_values& nr) const;
 };
 }
 }
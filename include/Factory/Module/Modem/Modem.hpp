@@ -53,6 +53,7 @@ class Modem : public Factory
     std::string psi = "PSI0"; // psi function to use in the SCMA demodulation (PSI0, PSI1, PSI2, PSI3)
     bool no_sig2 = false;     // do not divide by (sig^2) / 2 in the demodulation
     int n_ite = 1;            // number of demodulations/decoding sessions to perform in the BFERI simulations
+    bool fxp = false;         // use 16-bit fixed-point messages in the log-domain SCMA demodulator
     int N_fil = 0;            // frame size at the output of the filter
     int rop_est_bits = 0;     // The number of bits known by the Modem_OOK_optical_rop_estimate demodulator
                               // to estimate the ROP
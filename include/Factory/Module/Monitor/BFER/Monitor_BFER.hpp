@@ -45,7 +45,7 @@ class Monitor_BFER : public Monitor
 
     // builder
     template<typename B = int>
-    module::Monitor_BFER<B>* build(bool count_unknown_values = false) const;
+    module::Monitor_BFER<B>* build(bool count_unknown_values = false, bool importance_sampling = false) const;
 };
 }
 }
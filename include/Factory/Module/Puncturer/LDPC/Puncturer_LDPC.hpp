@@ -25,6 +25,10 @@ class Puncturer_LDPC : public Puncturer
     // ----------------------------------------------------------------------------------------------------- PARAMETERS
     // optional parameters
     std::vector<bool> pattern;
+    int NR_BG = 0;   // base graph of the 5G NR code (set by the codec)
+    int NR_Z = 0;    // lifting size of the 5G NR code (set by the codec)
+    int NR_rv = 0;   // redundancy version
+    int NR_N_cb = 0; // size of the circular buffer (0 = full buffer)
 
     // -------------------------------------------------------------------------------------------------------- METHODS
     explicit Puncturer_LDPC(const std::string& p = Puncturer_LDPC_prefix);
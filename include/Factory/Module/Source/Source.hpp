@@ -32,6 +32,7 @@ class Source : public Factory
     std::string path = "";
     bool auto_reset = true;
     bool fifo_mode = false;
+    bool packed = false; // generate packed bits (see Tools/Perf/common/bit_packing.h)
     int seed = 0;
     int start_idx = 0;
 
@@ -23,6 +23,7 @@ enum class tsk : size_t
     extract,
     check,
     check_packed,
+    build_packed,
     SIZE
 };
 
@@ -50,6 +51,12 @@ enum class check_packed : size_t
     V_K,
     status
 };
+enum class build_packed : size_t
+{
+    U_K1,
+    U_K2,
+    status
+};
 }
 }
 
@@ -70,6 +77,8 @@ class CRC : public spu::module::Stateful
     inline spu::runtime::Socket& operator[](const crc::sck::build s);
     inline spu::runtime::Socket& operator[](const crc::sck::extract s);
     inline spu::runtime::Socket& operator[](const crc::sck::check s);
+    inline spu::runtime::Socket& operator[](const crc::sck::check_packed s);
+    inline spu::runtime::Socket& operator[](const crc::sck::build_packed s);
 
   protected:
     const int K; /*!< Number of information bits (the CRC bits are not included in K) */
@@ -149,6 +158,20 @@ class CRC : public spu::module::Stateful
     // bool check_packed(const B *V_K, const int n_frames = -1, const int frame_id = -1);
     bool check_packed(const B* V_K, const int frame_id = -1, const bool managed_memory = true);
 
+    /*!
+     * \brief Computes and adds the CRC to a vector of packed information bits.
+     *
+     * The frames are stored in 'tools::packed_size<B>(K)' (input) and 'tools::packed_size<B>(K + size)' (output)
+     * elements (see Tools/Perf/common/bit_packing.h).
+     */
+    template<class A = std::allocator<B>>
+    void build_packed(const std::vector<B, A>& U_K1,
+                      std::vector<B, A>& U_K2,
+                      const int frame_id = -1,
+                      const bool managed_memory = true);
+
+    void build_packed(const B* U_K1, B* U_K2, const int frame_id = -1, const bool managed_memory = true);
+
   protected:
     virtual void _build(const B* U_K1, B* U_K2, const size_t frame_id);
 
@@ -157,6 +180,8 @@ class CRC : public spu::module::Stateful
     virtual bool _check(const B* V_K, const size_t frame_id);
 
     virtual bool _check_packed(const B* V_K, const size_t frame_id);
+
+    virtual void _build_packed(const B* U_K1, B* U_K2, const size_t frame_id);
 };
 }
 }
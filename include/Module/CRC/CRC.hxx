@@ -3,6 +3,7 @@
 #include <string>
 
 #include "Module/CRC/CRC.hpp"
+#include "Tools/Perf/common/bit_packing.h"
 
 namespace aff3ct
 {
@@ -37,6 +38,20 @@ CRC<B>::operator[](const crc::sck::check s)
     return spu::module::Module::operator[]((size_t)crc::tsk::check)[(size_t)s];
 }
 
+template<typename B>
+spu::runtime::Socket&
+CRC<B>::operator[](const crc::sck::check_packed s)
+{
+    return spu::module::Module::operator[]((size_t)crc::tsk::check_packed)[(size_t)s];
+}
+
+template<typename B>
+spu::runtime::Socket&
+CRC<B>::operator[](const crc::sck::build_packed s)
+{
+    return spu::module::Module::operator[]((size_t)crc::tsk::build_packed)[(size_t)s];
+}
+
 template<typename B>
 CRC<B>::CRC(const int K, const int size)
   : spu::module::Stateful()
@@ -106,6 +121,21 @@ CRC<B>::CRC(const int K, const int size)
 
                              return ret ? spu::runtime::status_t::SUCCESS : spu::runtime::status_t::FAILURE_STOP;
                          });
+
+    auto& p5 = this->create_task("build_packed");
+    auto p5s_U_K1 = this->template create_socket_in<B>(p5, "U_K1", tools::packed_size<B>(this->K));
+    auto p5s_U_K2 = this->template create_socket_out<B>(p5, "U_K2", tools::packed_size<B>(this->K + this->size));
+    this->create_codelet(
+      p5,
+      [p5s_U_K1, p5s_U_K2](spu::module::Module& m, spu::runtime::Task& t, const size_t frame_id) -> int
+      {
+          auto& crc = static_cast<CRC<B>&>(m);
+
+          crc._build_packed(
+            static_cast<B*>(t[p5s_U_K1].get_dataptr()), static_cast<B*>(t[p5s_U_K2].get_dataptr()), frame_id);
+
+          return spu::runtime::status_t::SUCCESS;
+      });
 }
 
 template<typename B>
@@ -253,6 +283,28 @@ CRC<B>::check_packed(const B* V_K, const int frame_id, const bool managed_memory
     }
 }
 
+template<typename B>
+template<class A>
+void
+CRC<B>::build_packed(const std::vector<B, A>& U_K1,
+                     std::vector<B, A>& U_K2,
+                     const int frame_id,
+                     const bool managed_memory)
+{
+    (*this)[crc::sck::build_packed::U_K1].bind(U_K1);
+    (*this)[crc::sck::build_packed::U_K2].bind(U_K2);
+    (*this)[crc::tsk::build_packed].exec(frame_id, managed_memory);
+}
+
+template<typename B>
+void
+CRC<B>::build_packed(const B* U_K1, B* U_K2, const int frame_id, const bool managed_memory)
+{
+    (*this)[crc::sck::build_packed::U_K1].bind(U_K1);
+    (*this)[crc::sck::build_packed::U_K2].bind(U_K2);
+    (*this)[crc::tsk::build_packed].exec(frame_id, managed_memory);
+}
+
 template<typename B>
 void
 CRC<B>::_build(const B* U_K1, B* U_K2, const size_t frame_id)
@@ -283,5 +335,12 @@ CRC<B>::_check_packed(const B* V_K, const size_t frame_id)
     return false;
 }
 
+template<typename B>
+void
+CRC<B>::_build_packed(const B* U_K1, B* U_K2, const size_t frame_id)
+{
+    throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
+}
+
 }
 }
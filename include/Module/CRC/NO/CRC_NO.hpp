@@ -26,6 +26,7 @@ class CRC_NO : public CRC<B>
     virtual void _extract(const B* V_K1, B* V_K2, const size_t frame_id);
     virtual bool _check(const B* V_K, const size_t frame_id);
     virtual bool _check_packed(const B* V_K, const size_t frame_id);
+    virtual void _build_packed(const B* U_K1, B* U_K2, const size_t frame_id);
 };
 }
 }
@@ -5,6 +5,7 @@
 #ifndef CRC_POLYNOMIAL_HPP_
 #define CRC_POLYNOMIAL_HPP_
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <tuple>
@@ -20,9 +21,9 @@ template<typename B = int>
 class CRC_polynomial : public CRC<B>
 {
   protected:
-    const static std::map<std::string, std::tuple<unsigned, int>> known_polynomials;
+    const static std::map<std::string, std::tuple<uint64_t, int>> known_polynomials;
     std::vector<B> polynomial;
-    unsigned polynomial_packed;
+    uint64_t polynomial_packed;
     std::vector<B> buff_crc;
 
   public:
@@ -32,7 +33,7 @@ class CRC_polynomial : public CRC<B>
 
     static int get_size(const std::string& poly_key);
     static std::string get_name(const std::string& poly_key);
-    static unsigned get_value(const std::string& poly_key);
+    static uint64_t get_value(const std::string& poly_key);
 
     virtual void set_n_frames(const size_t n_frames);
 
@@ -41,6 +42,7 @@ class CRC_polynomial : public CRC<B>
     virtual void _extract(const B* V_K1, B* V_K2, const size_t frame_id);
     virtual bool _check(const B* V_K, const size_t frame_id);
     virtual bool _check_packed(const B* V_K, const size_t frame_id);
+    virtual void _build_packed(const B* U_K1, B* U_K2, const size_t frame_id);
 
     void _generate(const B* U_in, B* U_out, const int off_in, const int off_out, const int loop_size);
 };
@@ -5,10 +5,12 @@
 #ifndef CRC_POLYNOMIAL_FAST_HPP_
 #define CRC_POLYNOMIAL_FAST_HPP_
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
 #include "Module/CRC/Polynomial/CRC_polynomial.hpp"
+#include "Tools/Code/CRC/CRC_engine.hpp"
 
 namespace aff3ct
 {
@@ -18,23 +20,39 @@ template<typename B = int>
 class CRC_polynomial_fast : public CRC_polynomial<B>
 {
   protected:
-    std::vector<unsigned> lut_crc32;
-    unsigned polynomial_packed_rev;
+    tools::CRC_engine engine;
+
+    // state of the incremental check: the last checked frame, its packed bits and the CRC states every 16 bytes
+    std::vector<B> inc_V_K;
+    std::vector<uint8_t> inc_bytes;
+    std::vector<uint64_t> inc_states;
+    bool inc_valid;
 
   public:
     CRC_polynomial_fast(const int K, const std::string& poly_key, const int size = 0);
     virtual ~CRC_polynomial_fast() = default;
     virtual CRC_polynomial_fast<B>* clone() const;
 
+    /*!
+     * \brief Checks the CRC of a frame (K + size bits, one bit per element) by resuming the computation from the
+     * frame given to the previous call.
+     *
+     * Only the bits after the common prefix of the two frames are processed, this is useful to check the candidates
+     * of a list decoder. 'reset_incremental' has to be called when the previous frame is not relevant anymore.
+     *
+     * \return true if the CRC is verified, false otherwise.
+     */
+    bool check_incremental(const B* V_K);
+    void reset_incremental();
+
   protected:
     virtual void _build(const B* U_K1, B* U_K2, const size_t frame_id);
     virtual bool _check(const B* V_K, const size_t frame_id);
     virtual bool _check_packed(const B* V_K, const size_t frame_id);
+    virtual void _build_packed(const B* U_K1, B* U_K2, const size_t frame_id);
 
   private:
-    inline unsigned compute_crc_v1(const void* data, const int n_bits);
-    inline unsigned compute_crc_v2(const void* data, const int n_bits);
-    inline unsigned compute_crc_v3(const void* data, const int n_bits);
+    uint64_t extract_crc(const uint8_t* bytes) const;
 };
 }
 }
@@ -14,6 +14,19 @@ namespace aff3ct
 {
 namespace module
 {
+/*!
+ * \brief Biasing of the noise density in the 'add_noise_is' task (importance sampling).
+ *
+ * - SCALE: the standard deviation of the noise is multiplied by the biasing factor,
+ * - SHIFT: the mean of the noise is moved toward the decision threshold by the biasing factor (the noise is shifted by
+ *          -factor * sign(X_N)).
+ */
+enum class Importance_sampling_bias
+{
+    SCALE,
+    SHIFT
+};
+
 template<typename R = float>
 class Channel_AWGN_LLR : public Channel<R>
 {
@@ -21,6 +34,9 @@ class Channel_AWGN_LLR : public Channel<R>
     const bool add_users;
     std::shared_ptr<tools::Gaussian_gen<R>> gaussian_generator;
 
+    Importance_sampling_bias is_bias;
+    R is_factor;
+
   public:
     Channel_AWGN_LLR(const int N, const tools::Gaussian_gen<R>& noise_generator, const bool add_users = false);
 
@@ -36,9 +52,13 @@ class Channel_AWGN_LLR : public Channel<R>
 
     void set_seed(const int seed);
 
+    void set_importance_sampling(const Importance_sampling_bias bias, const R factor);
+
   protected:
     void _add_noise(const float* CP, const R* X_N, R* Y_N, const size_t frame_id);
 
+    void _add_noise_is(const float* CP, const R* X_N, R* Y_N, double* LW, const size_t frame_id);
+
     virtual void deep_copy(const Channel_AWGN_LLR<R>& m);
 };
 }
@@ -23,6 +23,7 @@ enum class tsk : size_t
 {
     add_noise,
     add_noise_wg,
+    add_noise_is,
     SIZE
 };
 
@@ -43,6 +44,14 @@ enum class add_noise_wg : size_t
     Y_N,
     status
 };
+enum class add_noise_is : size_t
+{
+    CP,
+    X_N,
+    Y_N,
+    LW,
+    status
+};
 }
 }
 
@@ -64,10 +73,14 @@ class Channel
     inline spu::runtime::Task& operator[](const chn::tsk t);
     inline spu::runtime::Socket& operator[](const chn::sck::add_noise s);
     inline spu::runtime::Socket& operator[](const chn::sck::add_noise_wg s);
+    inline spu::runtime::Socket& operator[](const chn::sck::add_noise_is s);
 
   protected:
     const int N;                // Size of one frame (= number of bits in one frame)
     std::vector<R> noised_data; // vector of the noise applied to the signal
+    uint64_t frame_counter;     // number of frames processed by this replica since the last 'set_seed'
+    size_t replica_rank;        // rank of this replica among the replicas that share the frames
+    size_t n_replicas;          // number of replicas that share the frames
 
   public:
     /*!
@@ -90,6 +103,18 @@ class Channel
 
     virtual void set_seed(const int seed);
 
+    /*!
+     * \brief Sets the rank of this replica among the 'n_replicas' replicas of the channel that share the frames.
+     *
+     * The replicas take the blocks of frames in a round robin order: the global index of a frame is deduced from the
+     * rank, it does not depend on the number of replicas nor on the number of frames per block. With a counter-based
+     * noise generator keyed by the same seed in all the replicas, the noise of a frame is reproducible.
+     *
+     * \param rank:       rank of this replica (in [0, 'n_replicas'[).
+     * \param n_replicas: number of replicas that share the frames.
+     */
+    void set_replica(const size_t rank, const size_t n_replicas);
+
     /*!
      * \brief Task method that adds the noise to a perfectly clear signal.
      *
@@ -127,12 +152,45 @@ class Channel
                       const int frame_id = -1,
                       const bool managed_memory = true);
 
+    /*!
+     * \brief Task method that adds a biased noise to a perfectly clear signal (importance sampling).
+     *
+     * \param X_N: a perfectly clear message.
+     * \param Y_N: a noisy signal.
+     * \param LW:  the log-likelihood ratio between the true and the biased noise densities of each frame (the
+     *             natural logarithm of the importance sampling weight).
+     */
+    template<class A = std::allocator<R>>
+    void add_noise_is(const std::vector<float, A>& CP,
+                      const std::vector<R, A>& X_N,
+                      std::vector<R, A>& Y_N,
+                      std::vector<double>& LW,
+                      const int frame_id = -1,
+                      const bool managed_memory = true);
+
+    void add_noise_is(const float* CP,
+                      const R* X_N,
+                      R* Y_N,
+                      double* LW,
+                      const int frame_id = -1,
+                      const bool managed_memory = true);
+
     virtual void set_n_frames(const size_t n_frames);
 
   protected:
+    /*!
+     * \brief Gets the global index of the next frame processed by this replica.
+     *
+     * \param block_size: number of frames in a block (the number of frames per task, or 1 when the frames of a task
+     *                    share the same noise).
+     */
+    uint64_t next_frame_index(const size_t block_size);
+
     virtual void _add_noise(const float* CP, const R* X_N, R* Y_N, const size_t frame_id);
 
     virtual void _add_noise_wg(const float* CP, const R* X_N, R* H_N, R* Y_N, const size_t frame_id);
+
+    virtual void _add_noise_is(const float* CP, const R* X_N, R* Y_N, double* LW, const size_t frame_id);
 };
 }
 }
@@ -30,11 +30,21 @@ Channel<R>::operator[](const chn::sck::add_noise_wg s)
     return spu::module::Module::operator[]((size_t)chn::tsk::add_noise_wg)[(size_t)s];
 }
 
+template<typename R>
+spu::runtime::Socket&
+Channel<R>::operator[](const chn::sck::add_noise_is s)
+{
+    return spu::module::Module::operator[]((size_t)chn::tsk::add_noise_is)[(size_t)s];
+}
+
 template<typename R>
 Channel<R>::Channel(const int N)
   : spu::module::Stateful()
   , N(N)
   , noised_data(this->N * this->n_frames, 0)
+  , frame_counter(0)
+  , replica_rank(0)
+  , n_replicas(1)
 {
     const std::string name = "Channel";
     this->set_name(name);
@@ -84,6 +94,26 @@ Channel<R>::Channel(const int N)
 
           return spu::runtime::status_t::SUCCESS;
       });
+
+    auto& p3 = this->create_task("add_noise_is");
+    auto p3s_CP = this->template create_socket_in<float>(p3, "CP", 1);
+    auto p3s_X_N = this->template create_socket_in<R>(p3, "X_N", this->N);
+    auto p3s_Y_N = this->template create_socket_out<R>(p3, "Y_N", this->N);
+    auto p3s_LW = this->template create_socket_out<double>(p3, "LW", 1);
+    this->create_codelet(
+      p3,
+      [p3s_CP, p3s_X_N, p3s_Y_N, p3s_LW](spu::module::Module& m, spu::runtime::Task& t, const size_t frame_id) -> int
+      {
+          auto& chn = static_cast<Channel<R>&>(m);
+
+          chn._add_noise_is(static_cast<float*>(t[p3s_CP].get_dataptr()),
+                            static_cast<R*>(t[p3s_X_N].get_dataptr()),
+                            static_cast<R*>(t[p3s_Y_N].get_dataptr()),
+                            static_cast<double*>(t[p3s_LW].get_dataptr()),
+                            frame_id);
+
+          return spu::runtime::status_t::SUCCESS;
+      });
 }
 
 template<typename R>
@@ -114,6 +144,34 @@ Channel<R>::set_seed(const int seed)
     // do nothing in the general case, this method has to be overrided
 }
 
+template<typename R>
+void
+Channel<R>::set_replica(const size_t rank, const size_t n_replicas)
+{
+    if (n_replicas == 0 || rank >= n_replicas)
+    {
+        std::stringstream message;
+        message << "'rank' has to be smaller than 'n_replicas' ('rank' = " << rank << ", 'n_replicas' = " << n_replicas
+                << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->replica_rank = rank;
+    this->n_replicas = n_replicas;
+    this->frame_counter = 0;
+}
+
+template<typename R>
+uint64_t
+Channel<R>::next_frame_index(const size_t block_size)
+{
+    const auto block = this->frame_counter / block_size;
+    const auto f = this->frame_counter % block_size;
+    this->frame_counter++;
+
+    return (block * this->n_replicas + this->replica_rank) * block_size + f;
+}
+
 template<typename R>
 template<class A>
 void
@@ -167,6 +225,39 @@ Channel<R>::add_noise_wg(const float* CP, const R* X_N, R* H_N, R* Y_N, const in
     (*this)[chn::tsk::add_noise_wg].exec(frame_id, managed_memory);
 }
 
+template<typename R>
+template<class A>
+void
+Channel<R>::add_noise_is(const std::vector<float, A>& CP,
+                         const std::vector<R, A>& X_N,
+                         std::vector<R, A>& Y_N,
+                         std::vector<double>& LW,
+                         const int frame_id,
+                         const bool managed_memory)
+{
+    (*this)[chn::sck::add_noise_is::CP].bind(CP);
+    (*this)[chn::sck::add_noise_is::X_N].bind(X_N);
+    (*this)[chn::sck::add_noise_is::Y_N].bind(Y_N);
+    (*this)[chn::sck::add_noise_is::LW].bind(LW);
+    (*this)[chn::tsk::add_noise_is].exec(frame_id, managed_memory);
+}
+
+template<typename R>
+void
+Channel<R>::add_noise_is(const float* CP,
+                         const R* X_N,
+                         R* Y_N,
+                         double* LW,
+                         const int frame_id,
+                         const bool managed_memory)
+{
+    (*this)[chn::sck::add_noise_is::CP].bind(CP);
+    (*this)[chn::sck::add_noise_is::X_N].bind(X_N);
+    (*this)[chn::sck::add_noise_is::Y_N].bind(Y_N);
+    (*this)[chn::sck::add_noise_is::LW].bind(LW);
+    (*this)[chn::tsk::add_noise_is].exec(frame_id, managed_memory);
+}
+
 template<typename R>
 void
 Channel<R>::_add_noise(const float* CP, const R* X_N, R* Y_N, const size_t frame_id)
@@ -181,6 +272,13 @@ Channel<R>::_add_noise_wg(const float* CP, const R* X_N, R* H_N, R* Y_N, const s
     throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
 }
 
+template<typename R>
+void
+Channel<R>::_add_noise_is(const float* CP, const R* X_N, R* Y_N, double* LW, const size_t frame_id)
+{
+    throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
+}
+
 template<typename R>
 void
 Channel<R>::set_n_frames(const size_t n_frames)
@@ -5,6 +5,8 @@
 #ifndef CHANNEL_USER_HPP_
 #define CHANNEL_USER_HPP_
 
+#include <cstddef>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -20,6 +22,9 @@ namespace module
  *
  * \brief The output is directly set by the data read in the given file.
  *
+ * The binary files (with the type of the reals of the Channel) are memory-mapped when the platform allows it: the
+ * frames are not loaded in memory and the file can be larger than the memory (replay of the erroneous frames).
+ *
  * \tparam R: type of the reals (floating-point representation) in the Channel.
  */
 template<typename R = float>
@@ -32,6 +37,10 @@ class Channel_user : public Channel<R>
     std::vector<std::vector<R>> noise_buff;
     int noise_counter;
 
+    std::shared_ptr<const char> noise_map; // the memory-mapped file, shared by the clones
+    const R* noise_mapped;                 // the first frame in 'noise_map'
+    size_t n_noise_mapped;                 // the number of frames in 'noise_map'
+
   public:
     Channel_user(const int N, const std::string& filename, const bool add_users = false);
     virtual ~Channel_user() = default;
@@ -45,6 +54,9 @@ class Channel_user : public Channel<R>
     virtual void _add_noise(const float* CP, const R* X_N, R* Y_N, const size_t frame_id);
 
     virtual void set_noise(const size_t frame_id);
+
+  private:
+    bool map_binary(const std::string& filename);
 };
 }
 }
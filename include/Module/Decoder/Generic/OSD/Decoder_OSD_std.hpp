@@ -0,0 +1,83 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_OSD_std.
+ */
+#ifndef DECODER_OSD_STD_HPP_
+#define DECODER_OSD_STD_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Module/Decoder/Decoder_SIHO.hpp"
+#include "Module/Encoder/Encoder.hpp"
+#include "Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hpp"
+#include "Tools/Interface/Interface_get_set_frozen_bits.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Ordered Statistics Decoder of order 'order' (Fossorier and Lin, 1995) for any linear code.
+ * The generator matrix is deduced from the encoder (one encoding per information bit). For each frame, a packed copy
+ * of [G | I] is reduced on the K Most Reliable Independent Positions (MRIP), then all the test patterns of weight
+ * <= 'order' are re-encoded with word-wide XORs and the candidate with the smallest discrepancy with the hard decisions
+ * wins. The patterns whose discrepancy on the MRIP alone already reaches the best one are skipped: it does not change
+ * the result.
+ * The frozen bits are forwarded to the encoder (if it has some), then the generator matrix is deduced again.
+ */
+template<typename B = int, typename R = float>
+class Decoder_OSD_std
+  : public Decoder_SIHO<B, R>
+  , public tools::Interface_get_set_frozen_bits
+{
+  protected:
+    using Word = tools::GF2_matrix::Word;
+
+    std::shared_ptr<Encoder<B>> encoder;
+    const int order;
+    const bool hamming;
+
+    tools::GF2_matrix G;    // [G | I], the identity tracks the information bits of the rows
+    tools::GF2_matrix G_sh; // [G | I] reduced on the MRIP, one per frame
+    const size_t n_words_N; // number of words of the codeword part of a row
+
+    std::vector<uint32_t> sorted_pos; // positions sorted by decreasing reliability
+    std::vector<uint32_t> mrip;       // positions of the pivots of the rows of 'G_sh'
+    std::vector<float> weights;       // cost of a disagreement with the hard decision, per position
+    std::vector<Word> hard_Y_N;       // packed hard decisions
+    std::vector<Word> candidates;     // partial re-encodings, one per flipped MRIP ('order' + 1 rows)
+    std::vector<Word> best;           // best candidate (codeword and information bits)
+    float min_cost;
+
+  public:
+    Decoder_OSD_std(const int K,
+                    const int N,
+                    const Encoder<B>& encoder,
+                    const int order = 2,
+                    const bool hamming = false);
+    virtual ~Decoder_OSD_std() = default;
+    virtual Decoder_OSD_std<B, R>* clone() const;
+
+    virtual void set_frozen_bits(const std::vector<bool>& frozen_bits);
+    virtual const std::vector<bool>& get_frozen_bits() const;
+
+  protected:
+    virtual void deep_copy(const Decoder_OSD_std<B, R>& m);
+    int _decode_siho(const R* Y_N, B* V_K, const size_t frame_id);
+    int _decode_siho_cw(const R* Y_N, B* V_N, const size_t frame_id);
+
+    void _decode(const R* Y_N);
+
+  private:
+    tools::Interface_get_set_frozen_bits& get_fb_encoder() const;
+    void build_G();
+    void reduce_on_mrip();
+    inline float compute_cost(const Word* candidate) const;
+    void reprocess(const int level, const int last_mrip, const float mrip_cost);
+};
+}
+}
+
+#endif /* DECODER_OSD_STD_HPP_ */
@@ -6,6 +6,7 @@
 #define DECODER_LDPC_BP_HPP_
 
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hpp"
 
 namespace aff3ct
 {
@@ -15,7 +16,7 @@ class Decoder_LDPC_BP
 {
   protected:
     const int n_ite;
-    const tools::Sparse_matrix H;
+    const tools::Sparse_matrix_CSR H; // compressed for the decoding loops
     const bool enable_syndrome;
     const int syndrome_depth;
 
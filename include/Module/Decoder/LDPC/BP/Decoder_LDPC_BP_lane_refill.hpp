@@ -0,0 +1,105 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_LDPC_BP_lane_refill.
+ */
+#ifndef DECODER_LDPC_BP_LANE_REFILL_HPP_
+#define DECODER_LDPC_BP_LANE_REFILL_HPP_
+
+#include <cstdint>
+#include <mipp.h>
+#include <vector>
+
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_BP_lane_refill
+ *
+ * \brief Lane refill mode of the inter frame BP decoders.
+ *
+ * In the lane refill mode, the 'decode_siho' and 'decode_siho_cw' tasks receive all the frames at once. When a SIMD
+ * lane meets the stop criterion, its frame is stored and the next pending frame is loaded in the lane. The decoding
+ * time then depends on the average number of iterations instead of the maximum one of each wave.
+ *
+ * The refill loop and the per lane bookkeeping are shared here, the decoders only describe how to load a frame in a
+ * lane, how to store the hard decision of a lane and how to run one iteration on all the lanes.
+ *
+ * \tparam B: type of the bits in the decoder.
+ * \tparam R: type of the reals (floating-point or fixed-point representation) in the decoder.
+ */
+template<typename B = int, typename R = float>
+class Decoder_LDPC_BP_lane_refill : public Decoder_LDPC_BP
+{
+  protected:
+    bool lane_refill;
+    std::vector<int> lane_frame;      // frame decoded in each SIMD lane (-1 if the lane is idle)
+    std::vector<int> lane_ite;        // number of iterations done in each SIMD lane
+    std::vector<int> lane_synd_depth; // current syndrome depth of each SIMD lane
+
+  public:
+    Decoder_LDPC_BP_lane_refill(const int K,
+                                const int N,
+                                const int n_ite,
+                                const tools::Sparse_matrix& H,
+                                const bool enable_syndrome = true,
+                                const int syndrome_depth = 1);
+
+    virtual ~Decoder_LDPC_BP_lane_refill() = default;
+
+    bool is_lane_refill() const;
+
+  protected:
+    /*!
+     * \brief Decodes all the frames by refilling the SIMD lanes as soon as they meet the stop criterion.
+     *
+     * \param Y_N:      the noisy frames ('n_frames' frames of 'N' LLRs).
+     * \param CWD:      the codeword detection flags ('n_frames' elements).
+     * \param V:        the decoded frames ('n_frames' frames of 'K' or 'N' bits).
+     * \param n_frames: the number of frames to decode.
+     * \param codeword: true to store the 'N' bits of the codewords, false to store the 'K' information bits.
+     *
+     * \return SUCCESS if all the frames verify the syndrome, FAILURE otherwise.
+     */
+    int _decode_lane_refill(const R* Y_N, int8_t* CWD, B* V, const int n_frames, const bool codeword);
+
+    /*!
+     * \brief Computes the per lane syndrome.
+     *
+     * \return a mask with the lanes that do not verify the syndrome (always false if the syndrome is disabled).
+     */
+    mipp::Msk<mipp::N<R>()> _check_syndrome_soft_lanes(const mipp::vector<mipp::Reg<R>>& var_nodes);
+
+    /*!
+     * \brief Loads the frame 'frame' of 'Y_N' in the SIMD lane 'lane' and clears the messages of the lane.
+     *
+     * A negative 'frame' idles the lane (no frame to load, 'Y_N' is not read).
+     */
+    virtual void _load_lane(const R* Y_N, const int frame, const int lane) = 0;
+
+    /*!
+     * \brief Stores the hard decision of the SIMD lane 'lane' in the frame 'frame' of 'V'.
+     */
+    virtual void _store_lane(B* V, const int frame, const int lane, const bool codeword) = 0;
+
+    /*!
+     * \brief Runs one decoding iteration on all the SIMD lanes.
+     *
+     * \return a mask with the lanes that do not verify the syndrome.
+     */
+    virtual mipp::Msk<mipp::N<R>()> _decode_single_ite_lanes(const int ite) = 0;
+
+    virtual void _begin_decoding_lanes();
+    virtual void _end_decoding_lanes();
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP_lane_refill.hxx"
+#endif
+
+#endif /* DECODER_LDPC_BP_LANE_REFILL_HPP_ */
@@ -0,0 +1,131 @@
+#include <streampu.hpp>
+
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP_lane_refill.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template<typename B, typename R>
+Decoder_LDPC_BP_lane_refill<B, R>::Decoder_LDPC_BP_lane_refill(const int K,
+                                                               const int N,
+                                                               const int n_ite,
+                                                               const tools::Sparse_matrix& H,
+                                                               const bool enable_syndrome,
+                                                               const int syndrome_depth)
+  : Decoder_LDPC_BP(K, N, n_ite, H, enable_syndrome, syndrome_depth)
+  , lane_refill(false)
+  , lane_frame(mipp::N<R>(), -1)
+  , lane_ite(mipp::N<R>(), 0)
+  , lane_synd_depth(mipp::N<R>(), 0)
+{
+}
+
+template<typename B, typename R>
+bool
+Decoder_LDPC_BP_lane_refill<B, R>::is_lane_refill() const
+{
+    return this->lane_refill;
+}
+
+template<typename B, typename R>
+int
+Decoder_LDPC_BP_lane_refill<B, R>::_decode_lane_refill(const R* Y_N,
+                                                       int8_t* CWD,
+                                                       B* V,
+                                                       const int n_frames,
+                                                       const bool codeword)
+{
+    const auto n_lanes = (int)mipp::N<R>();
+
+    // fill the SIMD lanes with the first frames
+    auto next_frame = 0;
+    auto n_active = 0;
+    for (auto l = 0; l < n_lanes; l++)
+    {
+        this->lane_ite[l] = 0;
+        this->lane_synd_depth[l] = 0;
+        this->lane_frame[l] = next_frame < n_frames ? next_frame++ : -1;
+        this->_load_lane(Y_N, this->lane_frame[l], l);
+        if (this->lane_frame[l] >= 0) n_active++;
+    }
+
+    int status = spu::runtime::status_t::SUCCESS;
+
+    // the update rules do not depend on the iteration number, the lanes can be at different iterations
+    this->_begin_decoding_lanes();
+    for (auto ite = 0; n_active > 0; ite++)
+    {
+        const auto unsat = this->_decode_single_ite_lanes(ite);
+
+        for (auto l = 0; l < n_lanes; l++)
+        {
+            if (this->lane_frame[l] < 0) continue;
+
+            this->lane_ite[l]++;
+            auto converged = false;
+            if (this->enable_syndrome && !unsat[l])
+            {
+                this->lane_synd_depth[l] = (this->lane_synd_depth[l] + 1) % this->syndrome_depth;
+                converged = this->lane_synd_depth[l] == 0;
+            }
+            else
+                this->lane_synd_depth[l] = 0;
+
+            if (converged || this->lane_ite[l] == this->n_ite)
+            {
+                const auto f = this->lane_frame[l];
+                const auto valid = !this->enable_syndrome || !unsat[l];
+                this->_store_lane(V, f, l, codeword);
+                CWD[f] = valid;
+                if (!valid) status = spu::runtime::status_t::FAILURE;
+
+                // refill the lane with the next pending frame
+                this->lane_ite[l] = 0;
+                this->lane_synd_depth[l] = 0;
+                this->lane_frame[l] = next_frame < n_frames ? next_frame++ : -1;
+                this->_load_lane(Y_N, this->lane_frame[l], l);
+                if (this->lane_frame[l] < 0) n_active--;
+            }
+        }
+    }
+    this->_end_decoding_lanes();
+
+    return status;
+}
+
+template<typename B, typename R>
+mipp::Msk<mipp::N<R>()>
+Decoder_LDPC_BP_lane_refill<B, R>::_check_syndrome_soft_lanes(const mipp::vector<mipp::Reg<R>>& var_nodes)
+{
+    auto syndrome = mipp::Msk<mipp::N<R>()>(false);
+    if (this->enable_syndrome)
+    {
+        const auto n_chk_nodes = (int)this->H.get_n_cols();
+        for (auto c = 0; c < n_chk_nodes; c++)
+        {
+            auto sign = mipp::Msk<mipp::N<R>()>(false);
+            const auto chk_vars = this->H.get_rows_from_col(c);
+            const auto chk_degree = (int)chk_vars.size();
+            for (auto v = 0; v < chk_degree; v++)
+                sign ^= mipp::sign(var_nodes[chk_vars[v]]);
+
+            syndrome |= sign;
+        }
+    }
+    return syndrome;
+}
+
+template<typename B, typename R>
+void
+Decoder_LDPC_BP_lane_refill<B, R>::_begin_decoding_lanes()
+{
+}
+
+template<typename B, typename R>
+void
+Decoder_LDPC_BP_lane_refill<B, R>::_end_decoding_lanes()
+{
+}
+}
+}
@@ -39,34 +39,29 @@ Decoder_LDPC_BP_flooding<B, R, Update_rule>::Decoder_LDPC_BP_flooding(const int
 
     mipp::vector<unsigned char> connections(this->H.get_n_rows(), 0);
 
-    const auto& msg_chk_to_var_id = this->H.get_col_to_rows();
-    const auto& msg_var_to_chk_id = this->H.get_row_to_cols();
+    // the branches are stored per check node in 'transpose' and per variable node in the messages: the branches of
+    // the variable node 'var_id' start at 'msg_var_to_chk_off[var_id]'
+    const auto& msg_chk_to_var_id = this->H.get_col_indices();
+    const auto& msg_var_to_chk_off = this->H.get_row_offsets();
 
-    auto k = 0;
-    for (auto i = 0; i < (int)msg_chk_to_var_id.size(); i++)
+    for (size_t k = 0; k < msg_chk_to_var_id.size(); k++)
     {
-        for (auto j = 0; j < (int)msg_chk_to_var_id[i].size(); j++)
+        const auto var_id = msg_chk_to_var_id[k];
+        const auto var_degree = (int)(msg_var_to_chk_off[var_id + 1] - msg_var_to_chk_off[var_id]);
+
+        const auto branch_id = (int)msg_var_to_chk_off[var_id] + connections[var_id];
+        connections[var_id]++;
+
+        if (connections[var_id] > var_degree)
         {
-            auto var_id = msg_chk_to_var_id[i][j];
-
-            auto branch_id = 0;
-            for (auto ii = 0; ii < (int)var_id; ii++)
-                branch_id += (int)msg_var_to_chk_id[ii].size();
-            branch_id += connections[var_id];
-            connections[var_id]++;
-
-            if (connections[var_id] > (int)msg_var_to_chk_id[var_id].size())
-            {
-                std::stringstream message;
-                message << "'connections[var_id]' has to be equal or smaller than 'msg_var_to_chk_id[var_id].size()' "
-                        << "('var_id' = " << var_id << ", 'connections[var_id]' = " << connections[var_id]
-                        << ", 'msg_var_to_chk_id[var_id].size()' = " << msg_var_to_chk_id[var_id].size() << ").";
-                throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-            }
-
-            transpose[k] = branch_id;
-            k++;
+            std::stringstream message;
+            message << "'connections[var_id]' has to be equal or smaller than 'var_degree' "
+                    << "('var_id' = " << var_id << ", 'connections[var_id]' = " << connections[var_id]
+                    << ", 'var_degree' = " << var_degree << ").";
+            throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
         }
+
+        transpose[k] = branch_id;
     }
 
     this->reset();
@@ -203,7 +198,7 @@ Decoder_LDPC_BP_flooding<B, R, Update_rule>::_initialize_var_to_chk(const R* Y_N
     ;
     for (auto v = 0; v < n_var_nodes; v++)
     {
-        const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+        const auto var_degree = (int)this->H.get_cols_from_row(v).size();
 
         auto sum_msg_chk_to_var = (R)0;
         for (auto c = 0; c < var_degree; c++)
@@ -229,7 +224,7 @@ Decoder_LDPC_BP_flooding<B, R, Update_rule>::_decode_single_ite(const std::vecto
     const auto n_chk_nodes = (int)this->H.get_n_cols();
     for (auto c = 0; c < n_chk_nodes; c++)
     {
-        const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
+        const auto chk_degree = (int)this->H.get_rows_from_col(c).size();
 
         this->up_rule.begin_chk_node_in(c, chk_degree);
         for (auto v = 0; v < chk_degree; v++)
@@ -257,7 +252,7 @@ Decoder_LDPC_BP_flooding<B, R, Update_rule>::_compute_post(const R* Y_N,
     ;
     for (auto v = 0; v < n_var_nodes; v++)
     {
-        const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+        const auto var_degree = (int)this->H.get_cols_from_row(v).size();
 
         auto sum_msg_chk_to_var = (R)0;
         for (auto c = 0; c < var_degree; c++)
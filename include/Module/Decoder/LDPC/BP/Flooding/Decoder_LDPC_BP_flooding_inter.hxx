@@ -25,9 +25,10 @@ Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::Decoder_LDPC_BP_flooding_inte
   const std::vector<unsigned>& info_bits_pos,
   const Update_rule& up_rule,
   const bool enable_syndrome,
-  const int syndrome_depth)
+  const int syndrome_depth,
+  const bool lane_refill)
   : Decoder_SISO<B, R>(K, N)
-  , Decoder_LDPC_BP(K, N, n_ite, _H, enable_syndrome, syndrome_depth)
+  , Decoder_LDPC_BP_lane_refill<B, R>(K, N, n_ite, _H, enable_syndrome, syndrome_depth)
   , info_bits_pos(info_bits_pos)
   , up_rule(up_rule)
   , sat_val((R)((1 << ((sizeof(R) * 8 - 2) - (int)std::log2(this->H.get_rows_max_degree()))) - 1))
@@ -55,36 +56,32 @@ Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::Decoder_LDPC_BP_flooding_inte
 
     mipp::vector<unsigned char> connections(this->H.get_n_rows(), 0);
 
-    const auto& msg_chk_to_var_id = this->H.get_col_to_rows();
-    const auto& msg_var_to_chk_id = this->H.get_row_to_cols();
+    // the branches are stored per check node in 'transpose' and per variable node in the messages: the branches of
+    // the variable node 'var_id' start at 'msg_var_to_chk_off[var_id]'
+    const auto& msg_chk_to_var_id = this->H.get_col_indices();
+    const auto& msg_var_to_chk_off = this->H.get_row_offsets();
 
-    auto k = 0;
-    for (auto i = 0; i < (int)msg_chk_to_var_id.size(); i++)
+    for (size_t k = 0; k < msg_chk_to_var_id.size(); k++)
     {
-        for (auto j = 0; j < (int)msg_chk_to_var_id[i].size(); j++)
-        {
-            auto var_id = msg_chk_to_var_id[i][j];
-
-            auto branch_id = 0;
-            for (auto ii = 0; ii < (int)var_id; ii++)
-                branch_id += (int)msg_var_to_chk_id[ii].size();
-            branch_id += connections[var_id];
-            connections[var_id]++;
+        const auto var_id = msg_chk_to_var_id[k];
+        const auto var_degree = (int)(msg_var_to_chk_off[var_id + 1] - msg_var_to_chk_off[var_id]);
 
-            if (connections[var_id] > (int)msg_var_to_chk_id[var_id].size())
-            {
-                std::stringstream message;
-                message << "'connections[var_id]' has to be equal or smaller than 'msg_var_to_chk_id[var_id].size()' "
-                        << "('var_id' = " << var_id << ", 'connections[var_id]' = " << connections[var_id]
-                        << ", 'msg_var_to_chk_id[var_id].size()' = " << msg_var_to_chk_id[var_id].size() << ").";
-                throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-            }
+        const auto branch_id = (int)msg_var_to_chk_off[var_id] + connections[var_id];
+        connections[var_id]++;
 
-            transpose[k] = branch_id;
-            k++;
+        if (connections[var_id] > var_degree)
+        {
+            std::stringstream message;
+            message << "'connections[var_id]' has to be equal or smaller than 'var_degree' "
+                    << "('var_id' = " << var_id << ", 'connections[var_id]' = " << connections[var_id]
+                    << ", 'var_degree' = " << var_degree << ").";
+            throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
         }
+
+        transpose[k] = branch_id;
     }
 
+    this->set_lane_refill(lane_refill);
     this->reset();
 }
 
@@ -113,6 +110,13 @@ Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_decode_siso(const R* Y_N1,
                                                                 R* Y_N2,
                                                                 const size_t frame_id)
 {
+    if (this->lane_refill)
+    {
+        std::stringstream message;
+        message << "The lane refill mode is not supported by the 'decode_siso' task.";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
     const auto cur_wave = frame_id / this->get_n_frames_per_wave();
 
     std::vector<const R*> frames_in(mipp::N<R>());
@@ -146,6 +150,8 @@ Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_decode_siho(const R* Y_N,
                                                                 B* V_K,
                                                                 const size_t frame_id)
 {
+    if (this->lane_refill) return this->_decode_lane_refill(Y_N, CWD, V_K, (int)this->get_n_frames(), false);
+
     //	auto t_load = std::chrono::steady_clock::now(); // -----------------------------------------------------------
     // LOAD
     const auto cur_wave = frame_id / this->get_n_frames_per_wave();
@@ -194,6 +200,8 @@ Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_decode_siho_cw(const R* Y_N,
                                                                    B* V_N,
                                                                    const size_t frame_id)
 {
+    if (this->lane_refill) return this->_decode_lane_refill(Y_N, CWD, V_N, (int)this->get_n_frames(), true);
+
     //	auto t_load = std::chrono::steady_clock::now(); // -----------------------------------------------------------
     // LOAD
     const auto cur_wave = frame_id / this->get_n_frames_per_wave();
@@ -260,6 +268,73 @@ Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_decode(const mipp::Reg<R>* Y
     return packed_synd;
 }
 
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_load_lane(const R* Y_N, const int frame, const int lane)
+{
+    const auto n_lanes = (size_t)mipp::N<R>();
+    R* Y_N_reorderered = (R*)this->Y_N_reorderered.data();
+    R* msg_chk_to_var = (R*)this->msg_chk_to_var[0].data();
+
+    // the channel LLRs stay in 'Y_N_reorderered' because they are used at each iteration
+    if (frame >= 0)
+        for (size_t v = 0; v < (size_t)this->N; v++)
+            Y_N_reorderered[v * n_lanes + lane] = Y_N[frame * this->N + v];
+    else
+        for (size_t v = 0; v < (size_t)this->N; v++)
+            Y_N_reorderered[v * n_lanes + lane] = (R)0;
+
+    const auto n_connections = this->msg_chk_to_var[0].size();
+    for (size_t e = 0; e < n_connections; e++)
+        msg_chk_to_var[e * n_lanes + lane] = (R)0;
+}
+
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_store_lane(B* V,
+                                                               const int frame,
+                                                               const int lane,
+                                                               const bool codeword)
+{
+    const auto n_lanes = (size_t)mipp::N<R>();
+    const R* post = (const R*)this->post.data();
+
+    if (codeword)
+        for (size_t v = 0; v < (size_t)this->N; v++)
+            V[frame * this->N + v] = (B)(post[v * n_lanes + lane] < 0);
+    else
+        for (size_t k = 0; k < (size_t)this->K; k++)
+            V[frame * this->K + k] = (B)(post[this->info_bits_pos[k] * n_lanes + lane] < 0);
+}
+
+template<typename B, typename R, class Update_rule>
+mipp::Msk<mipp::N<R>()>
+Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_decode_single_ite_lanes(const int ite)
+{
+    this->up_rule.begin_ite(ite);
+    this->_initialize_var_to_chk(this->Y_N_reorderered.data(), this->msg_chk_to_var[0], this->msg_var_to_chk[0]);
+    this->_decode_single_ite(this->msg_var_to_chk[0], this->msg_chk_to_var[0]);
+    this->up_rule.end_ite();
+
+    // the a posteriori information is needed by all the lanes that reach the maximum number of iterations
+    this->_compute_post(this->Y_N_reorderered.data(), this->msg_chk_to_var[0], this->post);
+    return this->_check_syndrome_soft_lanes(this->post);
+}
+
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_begin_decoding_lanes()
+{
+    this->up_rule.begin_decoding(this->n_ite);
+}
+
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_end_decoding_lanes()
+{
+    this->up_rule.end_decoding();
+}
+
 template<typename B, typename R, class Update_rule>
 void
 Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_initialize_var_to_chk(
@@ -274,7 +349,7 @@ Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_initialize_var_to_chk(
     ;
     for (auto v = 0; v < n_var_nodes; v++)
     {
-        const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+        const auto var_degree = (int)this->H.get_cols_from_row(v).size();
 
         auto sum_msg_chk_to_var = mipp::Reg<R>((R)0);
         for (auto c = 0; c < var_degree; c++)
@@ -300,7 +375,7 @@ Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_decode_single_ite(const mipp
     const auto n_chk_nodes = (int)this->H.get_n_cols();
     for (auto c = 0; c < n_chk_nodes; c++)
     {
-        const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
+        const auto chk_degree = (int)this->H.get_rows_from_col(c).size();
 
         this->up_rule.begin_chk_node_in(c, chk_degree);
         for (auto v = 0; v < chk_degree; v++)
@@ -332,7 +407,7 @@ Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_compute_post(const mipp::Reg
     ;
     for (auto v = 0; v < n_var_nodes; v++)
     {
-        const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+        const auto var_degree = (int)this->H.get_cols_from_row(v).size();
 
         auto sum_msg_chk_to_var = mipp::Reg<R>((R)0);
         for (auto c = 0; c < var_degree; c++)
@@ -352,16 +427,17 @@ Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_check_syndrome_soft(const mi
     const auto zero = mipp::Msk<mipp::N<B>()>(false);
     auto syndrome = zero;
 
-    auto n_chk_nodes = (int)H.get_n_cols();
+    auto n_chk_nodes = (int)this->H.get_n_cols();
     auto c = 0;
     auto syndrome_scalar = true;
     while (c < n_chk_nodes && (syndrome_scalar = mipp::testz(syndrome)))
     {
         auto sign = zero;
-        const auto chk_degree = (int)this->H[c].size();
+        const auto chk_vars = this->H.get_rows_from_col(c);
+        const auto chk_degree = (int)chk_vars.size();
         for (auto v = 0; v < chk_degree; v++)
         {
-            const auto value = var_nodes[this->H[c][v]];
+            const auto value = var_nodes[chk_vars[v]];
             sign ^= mipp::sign(value);
         }
 
@@ -381,16 +457,17 @@ Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::_check_syndrome_soft_status(
     const auto zero = mipp::Msk<mipp::N<B>()>(false);
     auto syndrome = zero;
 
-    auto n_chk_nodes = (int)H.get_n_cols();
+    auto n_chk_nodes = (int)this->H.get_n_cols();
     auto c = 0;
     auto syndrome_scalar = true;
     while (c < n_chk_nodes)
     {
         auto sign = zero;
-        const auto chk_degree = (int)this->H[c].size();
+        const auto chk_vars = this->H.get_rows_from_col(c);
+        const auto chk_degree = (int)chk_vars.size();
         for (auto v = 0; v < chk_degree; v++)
         {
-            const auto value = var_nodes[this->H[c][v]];
+            const auto value = var_nodes[chk_vars[v]];
             sign ^= mipp::sign(value);
         }
 
@@ -436,5 +513,13 @@ Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::set_n_frames(const size_t n_f
     }
 }
 
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_flooding_inter<B, R, Update_rule>::set_lane_refill(const bool lane_refill)
+{
+    this->lane_refill = lane_refill;
+    this->set_single_wave(lane_refill);
+}
+
 }
 }
@@ -187,11 +187,12 @@ Decoder_LDPC_BP_horizontal_layered<B, R, Update_rule>::_decode_single_ite(std::v
     const auto n_chk_nodes = (int)this->H.get_n_cols();
     for (auto c = 0; c < n_chk_nodes; c++)
     {
-        const auto chk_degree = (int)this->H[c].size();
+        const auto chk_vars = this->H.get_rows_from_col(c);
+        const auto chk_degree = (int)chk_vars.size();
         this->up_rule.begin_chk_node_in(c, chk_degree);
         for (auto v = 0; v < chk_degree; v++)
         {
-            this->contributions[v] = var_nodes[this->H[c][v]] - messages[kr++];
+            this->contributions[v] = var_nodes[chk_vars[v]] - messages[kr++];
             this->up_rule.compute_chk_node_in(v, this->contributions[v]);
         }
         this->up_rule.end_chk_node_in();
@@ -200,7 +201,7 @@ Decoder_LDPC_BP_horizontal_layered<B, R, Update_rule>::_decode_single_ite(std::v
         for (auto v = 0; v < chk_degree; v++)
         {
             messages[kw] = this->up_rule.compute_chk_node_out(v, this->contributions[v]);
-            var_nodes[this->H[c][v]] = this->contributions[v] + messages[kw++];
+            var_nodes[chk_vars[v]] = this->contributions[v] + messages[kw++];
         }
         this->up_rule.end_chk_node_out();
     }
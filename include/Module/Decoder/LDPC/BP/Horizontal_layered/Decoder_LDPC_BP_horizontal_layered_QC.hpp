@@ -0,0 +1,98 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_LDPC_BP_horizontal_layered_QC.
+ */
+#ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_QC_HPP_
+#define DECODER_LDPC_BP_HORIZONTAL_LAYERED_QC_HPP_
+#ifdef __cpp_aligned_new
+
+#include <cstdint>
+#include <mipp.h>
+#include <utility>
+#include <vector>
+
+#include "Module/Decoder/Decoder_SISO.hpp"
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/Update_rule/NMS/Update_rule_NMS_simd.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_BP_horizontal_layered_QC
+ * \brief Horizontal layered BP decoder for quasi-cyclic LDPC codes (intra-frame SIMD strategy).
+ *
+ * A layer is a row of circulant blocks of the base matrix. The Z check nodes of a layer do not share any variable
+ * node, they are processed mipp::N<R>() at a time: the variable nodes of a circulant block are read and written with
+ * cyclic-shift unaligned loads/stores. Only one frame is decoded at a time.
+ */
+template<typename B = int, typename R = float, class Update_rule = tools::Update_rule_NMS_simd<R>>
+class Decoder_LDPC_BP_horizontal_layered_QC
+  : public Decoder_SISO<B, R>
+  , public Decoder_LDPC_BP
+{
+  protected:
+    const std::vector<uint32_t> info_bits_pos;
+
+    Update_rule up_rule;
+
+    const R sat_val;
+
+    const unsigned Z;        // lifting size
+    const unsigned Z_stride; // size of a block of variable nodes: Z values followed by a copy of the first ones
+    const unsigned Z_pad;    // Z rounded up to a multiple of mipp::N<R>()
+
+    // for each layer, the list of the (block column, shift value) pairs
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> layers;
+
+    mipp::Msk<mipp::N<R>()> tail_mask; // valid lanes of the last group of check nodes of a layer
+
+    // data structures for iterative decoding
+    std::vector<mipp::vector<R>> var_nodes;
+    std::vector<mipp::vector<R>> messages;
+
+    mipp::vector<mipp::Reg<R>> contributions;
+    mipp::vector<R> tmp; // temporary storage of a SIMD register
+
+  public:
+    Decoder_LDPC_BP_horizontal_layered_QC(const int K,
+                                          const int N,
+                                          const int n_ite,
+                                          const tools::Sparse_matrix& H,
+                                          const std::vector<unsigned>& info_bits_pos,
+                                          const int Z,
+                                          const Update_rule& up_rule,
+                                          const bool enable_syndrome = true,
+                                          const int syndrome_depth = 1);
+    virtual ~Decoder_LDPC_BP_horizontal_layered_QC() = default;
+
+    virtual Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>* clone() const;
+
+    virtual void set_n_frames(const size_t n_frames);
+
+  protected:
+    void _reset(const size_t frame_id);
+
+    int _decode_siso(const R* Y_N1, int8_t* CWD, R* Y_N2, const size_t frame_id);
+    int _decode_siho(const R* Y_N, int8_t* CWD, B* V_K, const size_t frame_id);
+    int _decode_siho_cw(const R* Y_N, int8_t* CWD, B* V_N, const size_t frame_id);
+
+    void _load(const R* Y_N, const size_t frame_id);
+    int _decode(const size_t frame_id);
+    void _decode_single_ite(mipp::vector<R>& var_nodes, mipp::vector<R>& messages);
+    bool _check_syndrome_soft(const mipp::vector<R>& var_nodes);
+
+    inline size_t var_idx(const size_t v) const;
+    inline void store_cyclic(R* blk, const unsigned pos, const mipp::Reg<R> r_val, const unsigned n_valid);
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_QC.hxx"
+#endif
+
+#endif
+#endif /* DECODER_LDPC_BP_HORIZONTAL_LAYERED_QC_HPP_ */
@@ -0,0 +1,333 @@
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <string>
+
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_QC.hpp"
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_inter.hpp"
+#include "Tools/Code/LDPC/QC/QC.hpp"
+#include "Tools/general_utils.h"
+
+namespace aff3ct
+{
+namespace module
+{
+template<typename B, typename R, class Update_rule>
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>::Decoder_LDPC_BP_horizontal_layered_QC(
+  const int K,
+  const int N,
+  const int n_ite,
+  const tools::Sparse_matrix& _H,
+  const std::vector<unsigned>& info_bits_pos,
+  const int Z,
+  const Update_rule& up_rule,
+  const bool enable_syndrome,
+  const int syndrome_depth)
+  : Decoder_SISO<B, R>(K, N)
+  , Decoder_LDPC_BP(K, N, n_ite, _H, enable_syndrome, syndrome_depth)
+  , info_bits_pos(info_bits_pos)
+  , up_rule(up_rule)
+  , sat_val((R)((1 << ((sizeof(R) * 8 - 2) - (int)std::log2(this->H.get_rows_max_degree()))) - 1))
+  , Z((unsigned)Z)
+  , Z_stride((unsigned)Z + mipp::N<R>())
+  , Z_pad((((unsigned)Z + mipp::N<R>() - 1) / mipp::N<R>()) * mipp::N<R>())
+  , var_nodes(this->n_frames)
+  , messages(this->n_frames)
+  , contributions(this->H.get_cols_max_degree())
+  , tmp(mipp::N<R>())
+{
+    const std::string name = "Decoder_LDPC_BP_horizontal_layered_QC<" + this->up_rule.get_name() + ">";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    tools::check_LUT(info_bits_pos, "info_bits_pos", (size_t)K);
+
+    if (Z <= 0 || N % Z)
+    {
+        std::stringstream message;
+        message << "'Z' has to be greater than 0 and has to divide 'N' ('Z' = " << Z << ", 'N' = " << N << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->sat_val <= 0)
+    {
+        std::stringstream message;
+        message << "'sat_val' has to be greater than 0 ('sat_val' = " << this->sat_val << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    // keep the base graph and the shift values instead of the expanded matrix
+    const auto base = tools::QC::get_base_matrix(_H, Z);
+    this->layers.resize(base.size());
+    for (size_t i = 0; i < base.size(); i++)
+        for (size_t j = 0; j < base[i].size(); j++)
+            if (base[i][j] >= 0) this->layers[i].push_back(std::make_pair((uint32_t)j, (uint32_t)base[i][j]));
+
+    for (auto l = 0; l < mipp::N<R>(); l++)
+        this->tmp[l] = (R)l;
+    const auto n_valid_last = this->Z - (this->Z_pad - mipp::N<R>());
+    this->tail_mask = mipp::Reg<R>(this->tmp.data()) < mipp::Reg<R>((R)n_valid_last);
+
+    for (auto& vn : this->var_nodes)
+        vn.resize((N / Z) * this->Z_stride);
+    for (auto& msg : this->messages)
+        msg.resize((this->H.get_n_connections() / Z) * this->Z_pad);
+
+    this->reset();
+}
+
+template<typename B, typename R, class Update_rule>
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>*
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>::clone() const
+{
+    auto m = new Decoder_LDPC_BP_horizontal_layered_QC(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R, class Update_rule>
+size_t
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>::var_idx(const size_t v) const
+{
+    return (v / this->Z) * this->Z_stride + v % this->Z;
+}
+
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>::store_cyclic(R* blk,
+                                                                       const unsigned pos,
+                                                                       const mipp::Reg<R> r_val,
+                                                                       const unsigned n_valid)
+{
+    if (n_valid == (unsigned)mipp::N<R>())
+    {
+        r_val.storeu(blk + pos);
+
+        // keep the copy of the first values (stored after the Z values) up to date
+        if (pos < n_valid || pos + n_valid > this->Z)
+            for (auto i = pos; i < pos + n_valid; i++)
+            {
+                if (i >= this->Z)
+                    blk[i - this->Z] = blk[i];
+                else if (i < n_valid)
+                    blk[i + this->Z] = blk[i];
+            }
+    }
+    else
+    {
+        r_val.store(this->tmp.data());
+        for (unsigned l = 0; l < n_valid; l++)
+            for (auto x = (pos + l) % this->Z; x < this->Z_stride; x += this->Z)
+                blk[x] = this->tmp[l];
+    }
+}
+
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>::_reset(const size_t frame_id)
+{
+    std::fill(this->messages[frame_id].begin(), this->messages[frame_id].end(), (R)0);
+    std::fill(this->var_nodes[frame_id].begin(), this->var_nodes[frame_id].end(), (R)0);
+}
+
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>::_load(const R* Y_N, const size_t frame_id)
+{
+    const auto n_blk_cols = (size_t)this->N / this->Z;
+    for (size_t j = 0; j < n_blk_cols; j++)
+        for (unsigned x = 0; x < this->Z_stride; x++) // var_nodes contain previous extrinsic information
+            this->var_nodes[frame_id][j * this->Z_stride + x] += Y_N[j * this->Z + x % this->Z];
+}
+
+template<typename B, typename R, class Update_rule>
+int
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>::_decode_siso(const R* Y_N1,
+                                                                       int8_t* CWD,
+                                                                       R* Y_N2,
+                                                                       const size_t frame_id)
+{
+    // memory zones initialization
+    this->_load(Y_N1, frame_id);
+
+    // actual decoding
+    auto status = this->_decode(frame_id);
+
+    // prepare for next round by processing extrinsic information
+    for (auto v = 0; v < this->N; v++)
+        Y_N2[v] = this->var_nodes[frame_id][this->var_idx(v)] - Y_N1[v];
+
+    // copy extrinsic information into var_nodes for next TURBO iteration
+    std::fill(this->var_nodes[frame_id].begin(), this->var_nodes[frame_id].end(), (R)0);
+    this->_load(Y_N2, frame_id);
+
+    CWD[0] = !status;
+    return status;
+}
+
+template<typename B, typename R, class Update_rule>
+int
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>::_decode_siho(const R* Y_N,
+                                                                       int8_t* CWD,
+                                                                       B* V_K,
+                                                                       const size_t frame_id)
+{
+    this->_load(Y_N, frame_id);
+
+    auto status = this->_decode(frame_id);
+
+    // take the hard decision
+    for (auto i = 0; i < this->K; i++)
+    {
+        const auto k = this->info_bits_pos[i];
+        V_K[i] = !(this->var_nodes[frame_id][this->var_idx(k)] >= 0);
+    }
+
+    CWD[0] = !status;
+    return status;
+}
+
+template<typename B, typename R, class Update_rule>
+int
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>::_decode_siho_cw(const R* Y_N,
+                                                                          int8_t* CWD,
+                                                                          B* V_N,
+                                                                          const size_t frame_id)
+{
+    this->_load(Y_N, frame_id);
+
+    auto status = this->_decode(frame_id);
+
+    // take the hard decision
+    for (auto v = 0; v < this->N; v++)
+        V_N[v] = !(this->var_nodes[frame_id][this->var_idx(v)] >= 0);
+
+    CWD[0] = !status;
+    return status;
+}
+
+template<typename B, typename R, class Update_rule>
+int
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>::_decode(const size_t frame_id)
+{
+    this->up_rule.begin_decoding(this->n_ite);
+
+    bool valid_synd = true;
+    for (auto ite = 0; ite < this->n_ite; ite++)
+    {
+        this->up_rule.begin_ite(ite);
+        this->_decode_single_ite(this->var_nodes[frame_id], this->messages[frame_id]);
+        this->up_rule.end_ite();
+
+        valid_synd = this->_check_syndrome_soft(this->var_nodes[frame_id]);
+        if (valid_synd) break;
+    }
+
+    this->up_rule.end_decoding();
+
+    return !valid_synd && this->enable_syndrome;
+}
+
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>::_decode_single_ite(mipp::vector<R>& var_nodes,
+                                                                             mipp::vector<R>& messages)
+{
+    auto k = 0;
+
+    // horizontal layered scheduling, the check nodes of a layer are processed mipp::N<R>() at a time
+    const auto n_layers = (int)this->layers.size();
+    for (auto l = 0; l < n_layers; l++)
+    {
+        const auto& layer = this->layers[l];
+        const auto chk_degree = (int)layer.size();
+
+        for (unsigned z = 0; z < this->Z; z += mipp::N<R>())
+        {
+            const auto n_valid = std::min((unsigned)mipp::N<R>(), this->Z - z);
+
+            this->up_rule.begin_chk_node_in(l, chk_degree);
+            for (auto e = 0; e < chk_degree; e++)
+            {
+                const auto blk = var_nodes.data() + layer[e].first * this->Z_stride;
+                const auto pos = (z + layer[e].second) % this->Z;
+
+                mipp::Reg<R> r_var;
+                r_var.loadu(blk + pos);
+                const mipp::Reg<R> r_msg = &messages[(k + e) * this->Z_pad + z];
+
+                this->contributions[e] = r_var - r_msg;
+                this->up_rule.compute_chk_node_in(e, this->contributions[e]);
+            }
+            this->up_rule.end_chk_node_in();
+
+            this->up_rule.begin_chk_node_out(l, chk_degree);
+            for (auto e = 0; e < chk_degree; e++)
+            {
+                const auto blk = var_nodes.data() + layer[e].first * this->Z_stride;
+                const auto pos = (z + layer[e].second) % this->Z;
+
+                const auto r_msg =
+                  saturate<R>(this->up_rule.compute_chk_node_out(e, this->contributions[e]), this->sat_val);
+                r_msg.store(&messages[(k + e) * this->Z_pad + z]);
+                this->store_cyclic(blk, pos, this->contributions[e] + r_msg, n_valid);
+            }
+            this->up_rule.end_chk_node_out();
+        }
+
+        k += chk_degree;
+    }
+}
+
+template<typename B, typename R, class Update_rule>
+bool
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>::_check_syndrome_soft(const mipp::vector<R>& var_nodes)
+{
+    if (this->enable_syndrome)
+    {
+        const auto zero = mipp::Msk<mipp::N<R>()>(false);
+        auto syndrome = zero;
+
+        const auto n_layers = this->layers.size();
+        for (size_t l = 0; l < n_layers && mipp::testz(syndrome); l++)
+            for (unsigned z = 0; z < this->Z; z += mipp::N<R>())
+            {
+                auto sign = zero;
+                for (auto& e : this->layers[l])
+                {
+                    mipp::Reg<R> r_var;
+                    r_var.loadu(&var_nodes[e.first * this->Z_stride + (z + e.second) % this->Z]);
+                    sign ^= mipp::sign(r_var);
+                }
+
+                syndrome |= (z + mipp::N<R>() > this->Z) ? sign & this->tail_mask : sign;
+            }
+
+        const auto syndrome_scalar = mipp::testz(syndrome);
+        this->cur_syndrome_depth = syndrome_scalar ? (this->cur_syndrome_depth + 1) % this->syndrome_depth : 0;
+        return syndrome_scalar && (this->cur_syndrome_depth == 0);
+    }
+    else
+        return false;
+}
+
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_horizontal_layered_QC<B, R, Update_rule>::set_n_frames(const size_t n_frames)
+{
+    const auto old_n_frames = this->get_n_frames();
+    if (old_n_frames != n_frames)
+    {
+        Decoder_SISO<B, R>::set_n_frames(n_frames);
+
+        const auto vec_size = this->var_nodes[0].size();
+        this->var_nodes.resize(n_frames, mipp::vector<R>(vec_size));
+
+        const auto vec_size2 = this->messages[0].size();
+        this->messages.resize(n_frames, mipp::vector<R>(vec_size2));
+    }
+}
+
+}
+}
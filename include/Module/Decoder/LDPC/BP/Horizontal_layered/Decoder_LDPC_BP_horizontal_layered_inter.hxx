@@ -43,9 +43,10 @@ Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::Decoder_LDPC_BP_hor
   const std::vector<unsigned>& info_bits_pos,
   const Update_rule& up_rule,
   const bool enable_syndrome,
-  const int syndrome_depth)
+  const int syndrome_depth,
+  const bool lane_refill)
   : Decoder_SISO<B, R>(K, N)
-  , Decoder_LDPC_BP(K, N, n_ite, _H, enable_syndrome, syndrome_depth)
+  , Decoder_LDPC_BP_lane_refill<B, R>(K, N, n_ite, _H, enable_syndrome, syndrome_depth)
   , info_bits_pos(info_bits_pos)
   , up_rule(up_rule)
   , sat_val((R)((1 << ((sizeof(R) * 8 - 2) - (int)std::log2(this->H.get_rows_max_degree()))) - 1))
@@ -70,6 +71,7 @@ Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::Decoder_LDPC_BP_hor
         throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
+    this->set_lane_refill(lane_refill);
     this->reset();
 }
 
@@ -114,6 +116,13 @@ Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_decode_siso(const
                                                                           R* Y_N2,
                                                                           const size_t frame_id)
 {
+    if (this->lane_refill)
+    {
+        std::stringstream message;
+        message << "The lane refill mode is not supported by the 'decode_siso' task.";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
     // memory zones initialization
     this->_load(Y_N1, frame_id);
 
@@ -141,6 +150,8 @@ Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_decode_siho(const
                                                                           B* V_K,
                                                                           const size_t frame_id)
 {
+    if (this->lane_refill) return this->_decode_lane_refill(Y_N, CWD, V_K, (int)this->get_n_frames(), false);
+
     //	auto t_load = std::chrono::steady_clock::now(); // -----------------------------------------------------------
     // LOAD
     this->_load(Y_N, frame_id);
@@ -183,6 +194,8 @@ Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_decode_siho_cw(con
                                                                              B* V_N,
                                                                              const size_t frame_id)
 {
+    if (this->lane_refill) return this->_decode_lane_refill(Y_N, CWD, V_N, (int)this->get_n_frames(), true);
+
     //	auto t_load = std::chrono::steady_clock::now(); // -----------------------------------------------------------
     // LOAD
     this->_load(Y_N, frame_id);
@@ -239,6 +252,69 @@ Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_decode(const size_
     return packed_synd;
 }
 
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_load_lane(const R* Y_N, const int frame, const int lane)
+{
+    const auto n_lanes = (size_t)mipp::N<R>();
+    R* var_nodes = (R*)this->var_nodes[0].data();
+    R* messages = (R*)this->messages[0].data();
+
+    if (frame >= 0)
+        for (size_t v = 0; v < (size_t)this->N; v++)
+            var_nodes[v * n_lanes + lane] = Y_N[frame * this->N + v];
+    else
+        for (size_t v = 0; v < (size_t)this->N; v++)
+            var_nodes[v * n_lanes + lane] = (R)0;
+
+    const auto n_connections = this->messages[0].size();
+    for (size_t e = 0; e < n_connections; e++)
+        messages[e * n_lanes + lane] = (R)0;
+}
+
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_store_lane(B* V,
+                                                                         const int frame,
+                                                                         const int lane,
+                                                                         const bool codeword)
+{
+    const auto n_lanes = (size_t)mipp::N<R>();
+    const R* var_nodes = (const R*)this->var_nodes[0].data();
+
+    if (codeword)
+        for (size_t v = 0; v < (size_t)this->N; v++)
+            V[frame * this->N + v] = (B)(var_nodes[v * n_lanes + lane] < 0);
+    else
+        for (size_t k = 0; k < (size_t)this->K; k++)
+            V[frame * this->K + k] = (B)(var_nodes[this->info_bits_pos[k] * n_lanes + lane] < 0);
+}
+
+template<typename B, typename R, class Update_rule>
+mipp::Msk<mipp::N<R>()>
+Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_decode_single_ite_lanes(const int ite)
+{
+    this->up_rule.begin_ite(ite);
+    this->_decode_single_ite(this->var_nodes[0], this->messages[0]);
+    this->up_rule.end_ite();
+
+    return this->_check_syndrome_soft_lanes(this->var_nodes[0]);
+}
+
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_begin_decoding_lanes()
+{
+    this->up_rule.begin_decoding(this->n_ite);
+}
+
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_end_decoding_lanes()
+{
+    this->up_rule.end_decoding();
+}
+
 template<typename B, typename R, class Update_rule>
 void
 Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_decode_single_ite(mipp::vector<mipp::Reg<R>>& var_nodes,
@@ -251,11 +327,12 @@ Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_decode_single_ite(
     const auto n_chk_nodes = (int)this->H.get_n_cols();
     for (auto c = 0; c < n_chk_nodes; c++)
     {
-        const auto chk_degree = (int)this->H[c].size();
+        const auto chk_vars = this->H.get_rows_from_col(c);
+        const auto chk_degree = (int)chk_vars.size();
         this->up_rule.begin_chk_node_in(c, chk_degree);
         for (auto v = 0; v < chk_degree; v++)
         {
-            this->contributions[v] = var_nodes[this->H[c][v]] - messages[kr++];
+            this->contributions[v] = var_nodes[chk_vars[v]] - messages[kr++];
             this->up_rule.compute_chk_node_in(v, this->contributions[v]);
         }
         this->up_rule.end_chk_node_in();
@@ -264,7 +341,7 @@ Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_decode_single_ite(
         for (auto v = 0; v < chk_degree; v++)
         {
             messages[kw] = saturate<R>(this->up_rule.compute_chk_node_out(v, this->contributions[v]), this->sat_val);
-            var_nodes[this->H[c][v]] = this->contributions[v] + messages[kw++];
+            var_nodes[chk_vars[v]] = this->contributions[v] + messages[kw++];
         }
         this->up_rule.end_chk_node_out();
     }
@@ -280,16 +357,17 @@ Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_check_syndrome_sof
         const auto zero = mipp::Msk<mipp::N<B>()>(false);
         auto syndrome = zero;
 
-        auto n_chk_nodes = (int)H.get_n_cols();
+        auto n_chk_nodes = (int)this->H.get_n_cols();
         auto c = 0;
         auto syndrome_scalar = true;
         while (c < n_chk_nodes && (syndrome_scalar = mipp::testz(syndrome)))
         {
             auto sign = zero;
-            const auto chk_degree = (int)this->H[c].size();
+            const auto chk_vars = this->H.get_rows_from_col(c);
+            const auto chk_degree = (int)chk_vars.size();
             for (auto v = 0; v < chk_degree; v++)
             {
-                const auto value = var_nodes[this->H[c][v]];
+                const auto value = var_nodes[chk_vars[v]];
                 sign ^= mipp::sign(value);
             }
 
@@ -314,16 +392,17 @@ Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::_check_syndrome_sof
         const auto zero = mipp::Msk<mipp::N<B>()>(false);
         auto syndrome = zero;
 
-        auto n_chk_nodes = (int)H.get_n_cols();
+        auto n_chk_nodes = (int)this->H.get_n_cols();
         auto c = 0;
         auto syndrome_scalar = true;
         while (c < n_chk_nodes)
         {
             auto sign = zero;
-            const auto chk_degree = (int)this->H[c].size();
+            const auto chk_vars = this->H.get_rows_from_col(c);
+            const auto chk_degree = (int)chk_vars.size();
             for (auto v = 0; v < chk_degree; v++)
             {
-                const auto value = var_nodes[this->H[c][v]];
+                const auto value = var_nodes[chk_vars[v]];
                 sign ^= mipp::sign(value);
             }
 
@@ -372,5 +451,13 @@ Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::set_n_frames(const
     }
 }
 
+template<typename B, typename R, class Update_rule>
+void
+Decoder_LDPC_BP_horizontal_layered_inter<B, R, Update_rule>::set_lane_refill(const bool lane_refill)
+{
+    this->lane_refill = lane_refill;
+    this->set_single_wave(lane_refill);
+}
+
 }
 }
@@ -9,7 +9,7 @@
 #include <vector>
 
 #include "Module/Decoder/Decoder_SISO.hpp"
-#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp"
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP_lane_refill.hpp"
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 
 namespace aff3ct
@@ -19,7 +19,7 @@ namespace module
 template<typename B = int, typename R = float>
 class Decoder_LDPC_BP_horizontal_layered_ONMS_inter
   : public Decoder_SISO<B, R>
-  , public Decoder_LDPC_BP
+  , public Decoder_LDPC_BP_lane_refill<B, R>
 {
   private:
     const float normalize_factor;
@@ -47,12 +47,18 @@ class Decoder_LDPC_BP_horizontal_layered_ONMS_inter
                                                   const float normalize_factor = 1.f,
                                                   const R offset = (R)0,
                                                   const bool enable_syndrome = true,
-                                                  const int syndrome_depth = 1);
+                                                  const int syndrome_depth = 1,
+                                                  const bool lane_refill = false);
     virtual ~Decoder_LDPC_BP_horizontal_layered_ONMS_inter() = default;
     virtual Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>* clone() const;
 
     virtual void set_n_frames(const size_t n_frames);
 
+    /*!
+     * \brief Enable or disable the lane refill mode (see Decoder_LDPC_BP_lane_refill).
+     */
+    void set_lane_refill(const bool lane_refill);
+
   protected:
     void _reset(const size_t frame_id);
 
@@ -67,6 +73,10 @@ class Decoder_LDPC_BP_horizontal_layered_ONMS_inter
     void _decode_single_ite(mipp::vector<mipp::Reg<R>>& var_nodes, mipp::vector<mipp::Reg<R>>& branches);
     bool _check_syndrome(const size_t frame_id);
     int _check_syndrome_status(const size_t frame_id);
+
+    void _load_lane(const R* Y_N, const int frame, const int lane);
+    void _store_lane(B* V, const int frame, const int lane, const bool codeword);
+    mipp::Msk<mipp::N<R>()> _decode_single_ite_lanes(const int ite);
 };
 }
 }
@@ -23,6 +23,7 @@ class Decoder_LDPC_BP_peeling
 {
   protected:
     const std::vector<unsigned> info_bits_pos;
+    const tools::Sparse_matrix H_links; // the peeling removes connections, start each decoding from a copy
 
     // data structures for iterative decoding
     std::vector<B> var_nodes;
@@ -196,17 +196,19 @@ Decoder_LDPC_BP_vertical_layered<B, R, Update_rule>::_decode_single_ite(std::vec
     for (auto vv = 0; vv < n_var_nodes; vv++)
     {
         auto msg_acc = (R)0;
-        const auto var_degree = (int)this->H.get_cols_from_row(vv).size();
+        const auto var_chks = this->H.get_cols_from_row(vv);
+        const auto var_degree = (int)var_chks.size();
         for (auto c = 0; c < var_degree; c++)
         {
             auto v_out = -1;
-            const auto cc = (int)this->H.get_cols_from_row(vv)[c];
+            const auto cc = (int)var_chks[c];
             const auto off_msg = (int)this->messages_offsets[cc];
-            const auto chk_degree = (int)this->H[cc].size();
+            const auto chk_vars = this->H.get_rows_from_col(cc);
+            const auto chk_degree = (int)chk_vars.size();
             this->up_rule.begin_chk_node_in(cc, chk_degree);
             for (auto v = 0; v < chk_degree; v++)
             {
-                const auto var_id = this->H[cc][v];
+                const auto var_id = chk_vars[v];
                 v_out = (var_id == (unsigned)vv) ? v : v_out;
                 this->contributions[v] = var_nodes[var_id] - messages[off_msg + v];
                 this->up_rule.compute_chk_node_in(v, this->contributions[v]);
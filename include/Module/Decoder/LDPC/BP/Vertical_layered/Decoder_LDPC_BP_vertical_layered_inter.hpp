@@ -11,7 +11,7 @@
 #include <vector>
 
 #include "Module/Decoder/Decoder_SISO.hpp"
-#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp"
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP_lane_refill.hpp"
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 #include "Tools/Code/LDPC/Update_rule/NMS/Update_rule_NMS_simd.hpp"
 
@@ -22,7 +22,7 @@ namespace module
 template<typename B = int, typename R = float, class Update_rule = tools::Update_rule_NMS_simd<R>>
 class Decoder_LDPC_BP_vertical_layered_inter
   : public Decoder_SISO<B, R>
-  , public Decoder_LDPC_BP
+  , public Decoder_LDPC_BP_lane_refill<B, R>
 {
   protected:
     const std::vector<unsigned> info_bits_pos;
@@ -48,13 +48,19 @@ class Decoder_LDPC_BP_vertical_layered_inter
                                            const std::vector<unsigned>& info_bits_pos,
                                            const Update_rule& up_rule,
                                            const bool enable_syndrome = true,
-                                           const int syndrome_depth = 1);
+                                           const int syndrome_depth = 1,
+                                           const bool lane_refill = false);
     virtual ~Decoder_LDPC_BP_vertical_layered_inter() = default;
 
     virtual Decoder_LDPC_BP_vertical_layered_inter<B, R, Update_rule>* clone() const;
 
     virtual void set_n_frames(const size_t n_frames);
 
+    /*!
+     * \brief Enable or disable the lane refill mode (see Decoder_LDPC_BP_lane_refill).
+     */
+    void set_lane_refill(const bool lane_refill);
+
   protected:
     void _reset(const size_t frame_id);
 
@@ -67,6 +73,12 @@ class Decoder_LDPC_BP_vertical_layered_inter
     void _decode_single_ite(mipp::vector<mipp::Reg<R>>& var_nodes, mipp::vector<mipp::Reg<R>>& messages);
     bool _check_syndrome_soft(const mipp::vector<mipp::Reg<R>>& var_nodes);
     int _check_syndrome_soft_status(const mipp::vector<mipp::Reg<R>>& var_nodes);
+
+    void _load_lane(const R* Y_N, const int frame, const int lane);
+    void _store_lane(B* V, const int frame, const int lane, const bool codeword);
+    mipp::Msk<mipp::N<R>()> _decode_single_ite_lanes(const int ite);
+    void _begin_decoding_lanes();
+    void _end_decoding_lanes();
 };
 }
 }
@@ -96,20 +96,16 @@ Decoder_polar_ASCL_fast_CA_sys<B, R, API_polar>::_decode(const R* Y_N, B* V_K, c
         {
             do
             {
-                int first_node_id = 0, off_l = 0, off_s = 0;
-
                 this->L <<= 1;
                 this->init_buffers();
-                this->recursive_decode(Y_N, off_l, off_s, this->m, first_node_id);
+                this->execute_schedule(Y_N);
             } while (!this->select_best_path(frame_id) && this->L < L_max);
         }
         else // partial adaptive mode
         {
-            int first_node_id = 0, off_l = 0, off_s = 0;
-
             this->L = this->L_max;
             this->init_buffers();
-            this->recursive_decode(Y_N, off_l, off_s, this->m, first_node_id);
+            this->execute_schedule(Y_N);
             this->select_best_path(frame_id);
         }
     }
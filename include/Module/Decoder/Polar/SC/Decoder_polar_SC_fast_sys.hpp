@@ -12,6 +12,7 @@
 #include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
 #include "Tools/Code/Polar/Pattern_polar_parser.hpp"
 #include "Tools/Code/Polar/Patterns/Pattern_polar_i.hpp"
+#include "Tools/Code/Polar/Polar_schedule.hpp"
 #include "Tools/Code/Polar/decoder_polar_functions.h"
 #include "Tools/Interface/Interface_get_set_frozen_bits.hpp"
 
@@ -51,6 +52,14 @@ class Decoder_polar_SC_fast_sys
     std::vector<bool> frozen_bits; // frozen bits
 
     tools::Pattern_polar_parser polar_patterns;
+    tools::Polar_schedule schedule; // flat decoding tree, compiled for each set of frozen bits
+
+    struct Operation
+    {
+        void (*kernel)(mipp::vector<B>& s, mipp::vector<R>& l, const tools::polar_instr_t& instr);
+        tools::polar_instr_t instr;
+    };
+    std::vector<Operation> operations; // the schedule bound to the 'API_polar' kernels
 
   public:
     Decoder_polar_SC_fast_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits);
@@ -77,7 +86,7 @@ class Decoder_polar_SC_fast_sys
     void _store(B* V_K);
     void _store_cw(B* V_N);
 
-    virtual void recursive_decode(const int off_l, const int off_s, const int reverse_depth, int& node_id);
+    void compile_schedule();
 };
 }
 }
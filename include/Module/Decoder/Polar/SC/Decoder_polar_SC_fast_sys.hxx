@@ -26,128 +26,131 @@ namespace module
 {
 constexpr int static_level = 6; // 2^6 = 64
 
-template<typename B, typename R, class API_polar, int REV_D>
-struct Decoder_polar_SC_fast_sys_static
+// operations of the schedule on a node of 'N_ELMTS' elements, 'N_ELMTS' = 0 when the size is only known at runtime
+template<typename B, typename R, class API_polar, int N_ELMTS>
+struct Decoder_polar_SC_fast_sys_kernels
 {
-    static void decode(const tools::Pattern_polar_parser& polar_patterns,
-                       mipp::vector<B>& s,
-                       mipp::vector<R>& l,
-                       const int off_l,
-                       const int off_s,
-                       int& node_id)
+    using kernel_t = void (*)(mipp::vector<B>& s, mipp::vector<R>& l, const tools::polar_instr_t& instr);
+
+    static constexpr int N_ELM_2 = N_ELMTS >> 1;
+
+    static void f(mipp::vector<B>& s, mipp::vector<R>& l, const tools::polar_instr_t& instr)
     {
-        constexpr int reverse_depth = REV_D;
-        constexpr int n_elmts = 1 << reverse_depth;
-        constexpr int n_elm_2 = n_elmts >> 1;
+        const int n_elmts = 1 << instr.rev_depth, n_elm_2 = n_elmts >> 1;
+        API_polar::template f<N_ELM_2>(l, instr.off_l, instr.off_l + n_elm_2, instr.off_l + n_elmts, n_elm_2);
+    }
 
-        const tools::polar_node_t node_type = polar_patterns.get_node_type(node_id);
+    static void g(mipp::vector<B>& s, mipp::vector<R>& l, const tools::polar_instr_t& instr)
+    {
+        const int n_elmts = 1 << instr.rev_depth, n_elm_2 = n_elmts >> 1;
+        API_polar::template g<N_ELM_2>(
+          s, l, instr.off_l, instr.off_l + n_elm_2, instr.off_s, instr.off_l + n_elmts, n_elm_2);
+    }
 
-        const bool is_terminal_pattern =
-          (node_type == tools::polar_node_t::RATE_0) || (node_type == tools::polar_node_t::RATE_1) ||
-          (node_type == tools::polar_node_t::REP) || (node_type == tools::polar_node_t::SPC);
+    static void g0(mipp::vector<B>& s, mipp::vector<R>& l, const tools::polar_instr_t& instr)
+    {
+        const int n_elmts = 1 << instr.rev_depth, n_elm_2 = n_elmts >> 1;
+        API_polar::template g0<N_ELM_2>(l, instr.off_l, instr.off_l + n_elm_2, instr.off_l + n_elmts, n_elm_2);
+    }
 
-        if (!is_terminal_pattern && reverse_depth)
-        {
-            // f
-            switch (node_type)
-            {
-                case tools::polar_node_t::STANDARD:
-                    API_polar::template f<n_elm_2>(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2);
-                    break;
-                case tools::polar_node_t::REP_LEFT:
-                    API_polar::template f<n_elm_2>(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2);
-                    break;
-                default:
-                    break;
-            }
+    static void gr(mipp::vector<B>& s, mipp::vector<R>& l, const tools::polar_instr_t& instr)
+    {
+        const int n_elmts = 1 << instr.rev_depth, n_elm_2 = n_elmts >> 1;
+        API_polar::template gr<N_ELM_2>(
+          s, l, instr.off_l, instr.off_l + n_elm_2, instr.off_s, instr.off_l + n_elmts, n_elm_2);
+    }
 
-            Decoder_polar_SC_fast_sys_static<B, R, API_polar, REV_D - 1>::decode(
-              polar_patterns, s, l, off_l + n_elmts, off_s, ++node_id); // recursive call left
+    static void xo(mipp::vector<B>& s, mipp::vector<R>& l, const tools::polar_instr_t& instr)
+    {
+        const int n_elm_2 = (1 << instr.rev_depth) >> 1;
+        API_polar::template xo<N_ELM_2>(s, instr.off_s, instr.off_s + n_elm_2, instr.off_s, n_elm_2);
+    }
 
-            // g
-            switch (node_type)
-            {
-                case tools::polar_node_t::STANDARD:
-                    API_polar::template g<n_elm_2>(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2);
-                    break;
-                case tools::polar_node_t::RATE_0_LEFT:
-                    API_polar::template g0<n_elm_2>(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2);
-                    break;
-                case tools::polar_node_t::REP_LEFT:
-                    API_polar::template gr<n_elm_2>(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2);
-                    break;
-                default:
-                    break;
-            }
+    static void xo0(mipp::vector<B>& s, mipp::vector<R>& l, const tools::polar_instr_t& instr)
+    {
+        const int n_elm_2 = (1 << instr.rev_depth) >> 1;
+        API_polar::template xo0<N_ELM_2>(s, instr.off_s + n_elm_2, instr.off_s, n_elm_2);
+    }
 
-            Decoder_polar_SC_fast_sys_static<B, R, API_polar, REV_D - 1>::decode(
-              polar_patterns, s, l, off_l + n_elmts, off_s + n_elm_2, ++node_id); // recursive call right
+    static void h0(mipp::vector<B>& s, mipp::vector<R>& l, const tools::polar_instr_t& instr)
+    {
+        API_polar::template h0<N_ELMTS>(s, instr.off_s, 1 << instr.rev_depth);
+    }
 
-            // xor
-            switch (node_type)
-            {
-                case tools::polar_node_t::STANDARD:
-                    API_polar::template xo<n_elm_2>(s, off_s, off_s + n_elm_2, off_s, n_elm_2);
-                    break;
-                case tools::polar_node_t::RATE_0_LEFT:
-                    API_polar::template xo0<n_elm_2>(s, off_s + n_elm_2, off_s, n_elm_2);
-                    break;
-                case tools::polar_node_t::REP_LEFT:
-                    API_polar::template xo<n_elm_2>(s, off_s, off_s + n_elm_2, off_s, n_elm_2);
-                    break;
-                default:
-                    break;
-            }
-        }
-        else
+    static void h(mipp::vector<B>& s, mipp::vector<R>& l, const tools::polar_instr_t& instr)
+    {
+        API_polar::template h<N_ELMTS>(s, l, instr.off_l, instr.off_s, 1 << instr.rev_depth);
+    }
+
+    static void rep(mipp::vector<B>& s, mipp::vector<R>& l, const tools::polar_instr_t& instr)
+    {
+        API_polar::template rep<N_ELMTS>(s, l, instr.off_l, instr.off_s, 1 << instr.rev_depth);
+    }
+
+    static void spc(mipp::vector<B>& s, mipp::vector<R>& l, const tools::polar_instr_t& instr)
+    {
+        API_polar::template spc<N_ELMTS>(s, l, instr.off_l, instr.off_s, 1 << instr.rev_depth);
+    }
+
+    // the f of the rate 0 left nodes is useless in SC and is not compiled (nullptr)
+    static kernel_t get(const tools::polar_op_t op)
+    {
+        switch (op)
         {
-            // h
-            switch (node_type)
-            {
-                case tools::polar_node_t::RATE_0:
-                    API_polar::template h0<n_elmts>(s, off_s, n_elmts);
-                    break;
-                case tools::polar_node_t::RATE_1:
-                    API_polar::template h<n_elmts>(s, l, off_l, off_s, n_elmts);
-                    break;
-                case tools::polar_node_t::REP:
-                    API_polar::template rep<n_elmts>(s, l, off_l, off_s, n_elmts);
-                    break;
-                case tools::polar_node_t::SPC:
-                    API_polar::template spc<n_elmts>(s, l, off_l, off_s, n_elmts);
-                    break;
-                default:
-                    break;
-            }
+            case tools::polar_op_t::F:
+                return f;
+            case tools::polar_op_t::G:
+                return g;
+            case tools::polar_op_t::G0:
+                return g0;
+            case tools::polar_op_t::GR:
+                return gr;
+            case tools::polar_op_t::XO:
+                return xo;
+            case tools::polar_op_t::XO0:
+                return xo0;
+            case tools::polar_op_t::H0:
+                return h0;
+            case tools::polar_op_t::H:
+                return h;
+            case tools::polar_op_t::REP:
+                return rep;
+            case tools::polar_op_t::SPC:
+                return spc;
+            default:
+                return nullptr;
         }
     }
 };
 
+// selects the kernels with a static size for the nodes of the 'static_level' last levels of the tree
+template<typename B, typename R, class API_polar, int REV_D>
+struct Decoder_polar_SC_fast_sys_static
+{
+    static typename Decoder_polar_SC_fast_sys_kernels<B, R, API_polar, 0>::kernel_t select(
+      const tools::polar_instr_t& instr)
+    {
+        if (instr.rev_depth == REV_D)
+            return Decoder_polar_SC_fast_sys_kernels<B, R, API_polar, 1 << REV_D>::get(instr.op);
+        else
+            return Decoder_polar_SC_fast_sys_static<B, R, API_polar, REV_D - 1>::select(instr);
+    }
+};
+
 template<typename B, typename R, class API_polar>
 struct Decoder_polar_SC_fast_sys_static<B, R, API_polar, 0>
 {
-    static void decode(const tools::Pattern_polar_parser& polar_patterns,
-                       mipp::vector<B>& s,
-                       mipp::vector<R>& l,
-                       const int off_l,
-                       const int off_s,
-                       int& node_id)
+    static typename Decoder_polar_SC_fast_sys_kernels<B, R, API_polar, 0>::kernel_t select(
+      const tools::polar_instr_t& instr)
     {
-        constexpr int reverse_depth = 0;
-        constexpr int n_elmts = 1 << reverse_depth;
-
-        const tools::polar_node_t node_t = polar_patterns.get_node_type(node_id);
-
-        switch (node_t)
+        switch (instr.op)
         {
-            case tools::polar_node_t::RATE_0:
-                API_polar::template h0<n_elmts>(s, off_s, n_elmts);
-                break;
-            case tools::polar_node_t::RATE_1:
-                API_polar::template h<n_elmts>(s, l, off_l, off_s, n_elmts);
-                break;
+            case tools::polar_op_t::H0:
+                return Decoder_polar_SC_fast_sys_kernels<B, R, API_polar, 1>::h0;
+            case tools::polar_op_t::H:
+                return Decoder_polar_SC_fast_sys_kernels<B, R, API_polar, 1>::h;
             default:
-                break;
+                return nullptr;
         }
     }
 };
@@ -173,6 +176,7 @@ Decoder_polar_SC_fast_sys<B, R, API_polar>::Decoder_polar_SC_fast_sys(const int&
                    2,
                    3,
                    true)
+  , schedule(this->polar_patterns)
 {
     const std::string name = "Decoder_polar_SC_fast_sys";
     this->set_name(name);
@@ -207,6 +211,8 @@ Decoder_polar_SC_fast_sys<B, R, API_polar>::Decoder_polar_SC_fast_sys(const int&
                 << ").";
         throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
+
+    this->compile_schedule();
 }
 
 template<typename B, typename R, class API_polar>
@@ -224,6 +230,7 @@ Decoder_polar_SC_fast_sys<B, R, API_polar>::Decoder_polar_SC_fast_sys(
   , s_bis(1 * N * API_polar::get_n_frames() + mipp::nElReg<B>())
   , frozen_bits(frozen_bits)
   , polar_patterns(frozen_bits, polar_patterns, idx_r0, idx_r1)
+  , schedule(this->polar_patterns)
 {
     const std::string name = "Decoder_polar_SC_fast_sys";
     this->set_name(name);
@@ -277,6 +284,22 @@ Decoder_polar_SC_fast_sys<B, R, API_polar>::set_frozen_bits(const std::vector<bo
     aff3ct::tools::fb_assert(frozen_bits, this->K, this->N);
     std::copy(fb.begin(), fb.end(), this->frozen_bits.begin());
     polar_patterns.set_frozen_bits(this->frozen_bits);
+    schedule.build(polar_patterns);
+    this->compile_schedule();
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SC_fast_sys<B, R, API_polar>::compile_schedule()
+{
+    this->operations.clear();
+    for (auto& instr : schedule.get_instructions())
+    {
+        const auto kernel = instr.rev_depth > static_level
+                              ? Decoder_polar_SC_fast_sys_kernels<B, R, API_polar, 0>::get(instr.op)
+                              : Decoder_polar_SC_fast_sys_static<B, R, API_polar, static_level>::select(instr);
+        if (kernel != nullptr) this->operations.push_back({ kernel, instr });
+    }
 }
 
 template<typename B, typename R, class API_polar>
@@ -322,8 +345,8 @@ Decoder_polar_SC_fast_sys<B, R, API_polar>::_decode()
         throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
-    int first_id = 0, off_l = 0, off_s = 0;
-    this->recursive_decode(off_l, off_s, m, first_id);
+    for (auto& op : this->operations)
+        op.kernel(this->s, this->l, op.instr);
 }
 
 template<typename B, typename R, class API_polar>
@@ -392,105 +415,6 @@ Decoder_polar_SC_fast_sys<B, R, API_polar>::_decode_siho_cw(const R* Y_N, B* V_N
     return 0;
 }
 
-template<typename B, typename R, class API_polar>
-void
-Decoder_polar_SC_fast_sys<B, R, API_polar>::recursive_decode(const int off_l,
-                                                             const int off_s,
-                                                             const int reverse_depth,
-                                                             int& node_id)
-{
-    if (reverse_depth == static_level)
-    {
-        // use the static version of the decoder
-        Decoder_polar_SC_fast_sys_static<B, R, API_polar, static_level>::decode(
-          polar_patterns, this->s, this->l, off_l, off_s, node_id);
-    }
-    else
-    {
-        const int n_elmts = 1 << reverse_depth;
-        const int n_elm_2 = n_elmts >> 1;
-        const auto node_type = polar_patterns.get_node_type(node_id);
-
-        const bool is_terminal_pattern =
-          (node_type == tools::polar_node_t::RATE_0) || (node_type == tools::polar_node_t::RATE_1) ||
-          (node_type == tools::polar_node_t::REP) || (node_type == tools::polar_node_t::SPC);
-
-        if (!is_terminal_pattern && reverse_depth)
-        {
-            // f
-            switch (node_type)
-            {
-                case tools::polar_node_t::STANDARD:
-                    API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2);
-                    break;
-                case tools::polar_node_t::REP_LEFT:
-                    API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2);
-                    break;
-                default:
-                    break;
-            }
-
-            this->recursive_decode(off_l + n_elmts, off_s, reverse_depth - 1, ++node_id); // recursive call left
-
-            // g
-            switch (node_type)
-            {
-                case tools::polar_node_t::STANDARD:
-                    API_polar::g(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2);
-                    break;
-                case tools::polar_node_t::RATE_0_LEFT:
-                    API_polar::g0(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2);
-                    break;
-                case tools::polar_node_t::REP_LEFT:
-                    API_polar::gr(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2);
-                    break;
-                default:
-                    break;
-            }
-
-            this->recursive_decode(
-              off_l + n_elmts, off_s + n_elm_2, reverse_depth - 1, ++node_id); // recursive call right
-
-            // xor
-            switch (node_type)
-            {
-                case tools::polar_node_t::STANDARD:
-                    API_polar::xo(s, off_s, off_s + n_elm_2, off_s, n_elm_2);
-                    break;
-                case tools::polar_node_t::RATE_0_LEFT:
-                    API_polar::xo0(s, off_s + n_elm_2, off_s, n_elm_2);
-                    break;
-                case tools::polar_node_t::REP_LEFT:
-                    API_polar::xo(s, off_s, off_s + n_elm_2, off_s, n_elm_2);
-                    break;
-                default:
-                    break;
-            }
-        }
-        else
-        {
-            // h
-            switch (node_type)
-            {
-                case tools::polar_node_t::RATE_0:
-                    API_polar::h0(s, off_s, n_elmts);
-                    break;
-                case tools::polar_node_t::RATE_1:
-                    API_polar::h(s, l, off_l, off_s, n_elmts);
-                    break;
-                case tools::polar_node_t::REP:
-                    API_polar::rep(s, l, off_l, off_s, n_elmts);
-                    break;
-                case tools::polar_node_t::SPC:
-                    API_polar::spc(s, l, off_l, off_s, n_elmts);
-                    break;
-                default:
-                    break;
-            }
-        }
-    }
-}
-
 template<typename B, typename R, class API_polar>
 void
 Decoder_polar_SC_fast_sys<B, R, API_polar>::_store(B* V_K)
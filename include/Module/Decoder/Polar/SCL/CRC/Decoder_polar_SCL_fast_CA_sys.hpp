@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "Module/CRC/CRC.hpp"
+#include "Module/CRC/Polynomial/CRC_polynomial_fast.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys.hpp"
 #include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
 #include "Tools/Code/Polar/decoder_polar_functions.h"
@@ -34,6 +35,7 @@ class Decoder_polar_SCL_fast_CA_sys : public Decoder_polar_SCL_fast_sys<B, R, AP
 
   protected:
     std::shared_ptr<CRC<B>> crc;
+    CRC_polynomial_fast<B>* crc_fast; // not null if the candidates can be checked incrementally
     mipp::vector<B> U_test;
 
   public:
@@ -19,6 +19,7 @@ Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::Decoder_polar_SCL_fast_CA_sys(co
   : Decoder_polar_SCL_fast_sys<B, R, API_polar>(K, N, L, frozen_bits)
   , fast_store(false)
   , crc(crc.clone())
+  , crc_fast(dynamic_cast<CRC_polynomial_fast<B>*>(this->crc.get()))
   , U_test(K)
 {
     const std::string name = "Decoder_polar_SCL_fast_CA_sys";
@@ -48,6 +49,7 @@ Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::Decoder_polar_SCL_fast_CA_sys(
   : Decoder_polar_SCL_fast_sys<B, R, API_polar>(K, N, L, frozen_bits, polar_patterns, idx_r0, idx_r1)
   , fast_store(false)
   , crc(crc.clone())
+  , crc_fast(dynamic_cast<CRC_polynomial_fast<B>*>(this->crc.get()))
   , U_test(K)
 {
     const std::string name = "Decoder_polar_SCL_fast_CA_sys";
@@ -79,6 +81,7 @@ Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::deep_copy(const Decoder_polar_SC
 {
     Decoder_polar_SCL_fast_sys<B, R, API_polar>::deep_copy(m);
     if (m.crc != nullptr) this->crc.reset(m.crc->clone());
+    this->crc_fast = dynamic_cast<CRC_polynomial_fast<B>*>(this->crc.get());
 }
 
 template<typename B, typename R, class API_polar>
@@ -87,7 +90,8 @@ Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::crc_check(mipp::vector<B>& s, co
 {
     tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), s.data(), U_test.data());
 
-    // check the CRC
+    // check the CRC, the candidates share a prefix with the previous one when the CRC can be resumed
+    if (crc_fast != nullptr) return crc_fast->check_incremental(U_test.data());
     return crc->check(U_test, frame_id);
 }
 
@@ -99,6 +103,8 @@ Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::select_best_path(const size_t fr
               this->paths.begin() + this->n_active_paths,
               [this](int x, int y) { return this->metrics[x] < this->metrics[y]; });
 
+    if (crc_fast != nullptr) crc_fast->reset_incremental();
+
     auto i = 0;
     while (i < this->n_active_paths && !crc_check(this->s[this->paths[i]], frame_id))
         i++;
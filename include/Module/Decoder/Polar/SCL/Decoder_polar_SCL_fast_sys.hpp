@@ -12,6 +12,7 @@
 #include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
 #include "Tools/Code/Polar/Pattern_polar_parser.hpp"
 #include "Tools/Code/Polar/Patterns/Pattern_polar_i.hpp"
+#include "Tools/Code/Polar/Polar_schedule.hpp"
 #include "Tools/Code/Polar/decoder_polar_functions.h"
 #include "Tools/Interface/Interface_get_set_frozen_bits.hpp"
 
@@ -39,6 +40,7 @@ class Decoder_polar_SCL_fast_sys
     int L;       // maximum paths number
     std::vector<bool> frozen_bits;
     tools::Pattern_polar_parser polar_patterns;
+    tools::Polar_schedule schedule; // flat decoding tree, compiled for each set of frozen bits
 
     std ::vector<int> paths;                  // active paths
     std ::vector<R> metrics;                  // path metrics
@@ -86,7 +88,7 @@ class Decoder_polar_SCL_fast_sys
     virtual void _store(B* V_K) const;
     virtual void _store_cw(B* V_N) const;
 
-    inline void recursive_decode(const R* Y_N, const int off_l, const int off_s, const int rev_depth, int& node_id);
+    inline void execute_schedule(const R* Y_N);
 
     inline void update_paths_r0(const int rev_depth, const int off_l, const int off_s, const int n_elmts);
     inline void update_paths_r1(const int rev_depth, const int off_l, const int off_s, const int n_elmts);
@@ -89,6 +89,7 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::Decoder_polar_SCL_fast_sys(const in
       1,
       2,
       true)
+  , schedule(this->polar_patterns)
   , paths(L)
   , metrics(L)
   , l(L, mipp::vector<R>(N + mipp::nElReg<R>()))
@@ -178,6 +179,7 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::Decoder_polar_SCL_fast_sys(
   , L(L)
   , frozen_bits(frozen_bits)
   , polar_patterns(frozen_bits, polar_patterns, idx_r0, idx_r1)
+  , schedule(this->polar_patterns)
   , paths(L)
   , metrics(L)
   , l(L, mipp::vector<R>(N + mipp::nElReg<R>()))
@@ -274,6 +276,7 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::set_frozen_bits(const std::vector<b
     aff3ct::tools::fb_assert(frozen_bits, this->K, this->N);
     std::copy(fb.begin(), fb.end(), this->frozen_bits.begin());
     polar_patterns.set_frozen_bits(fb);
+    schedule.build(polar_patterns);
 }
 
 template<typename B, typename R, class API_polar>
@@ -304,8 +307,7 @@ template<typename B, typename R, class API_polar>
 void
 Decoder_polar_SCL_fast_sys<B, R, API_polar>::_decode(const R* Y_N)
 {
-    int first_node_id = 0, off_l = 0, off_s = 0;
-    recursive_decode(Y_N, off_l, off_s, m, first_node_id);
+    this->execute_schedule(Y_N);
 }
 
 template<typename B, typename R, class API_polar>
@@ -376,96 +378,66 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::_decode_siho_cw(const R* Y_N, B* V_
 
 template<typename B, typename R, class API_polar>
 void
-Decoder_polar_SCL_fast_sys<B, R, API_polar>::recursive_decode(const R* Y_N,
-                                                              const int off_l,
-                                                              const int off_s,
-                                                              const int rev_depth,
-                                                              int& node_id)
+Decoder_polar_SCL_fast_sys<B, R, API_polar>::execute_schedule(const R* Y_N)
 {
-    const int n_elmts = 1 << rev_depth;
-    const int n_elm_2 = n_elmts >> 1;
-    const auto node_type = polar_patterns.get_node_type(node_id);
-
-    const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
-                                     (node_type == tools::polar_node_t::RATE_1) ||
-                                     (node_type == tools::polar_node_t::REP) || (node_type == tools::polar_node_t::SPC);
-
-    // root node
-    if (rev_depth == m)
+    for (auto& instr : schedule.get_instructions())
     {
-        // f
-        switch (node_type)
-        {
-            case tools::polar_node_t::STANDARD:
-                API_polar::f(Y_N, Y_N + n_elm_2, l[0].data(), n_elm_2);
-                break;
-            case tools::polar_node_t::REP_LEFT:
-                API_polar::f(Y_N, Y_N + n_elm_2, l[0].data(), n_elm_2);
-                break;
-            default:
-                break;
-        }
-
-        recursive_decode(Y_N, off_l, off_s, rev_depth - 1, ++node_id); // recursive call left
-
-        // g
-        switch (node_type)
+        const int rev_depth = instr.rev_depth;
+        const int n_elmts = 1 << rev_depth;
+        const int n_elm_2 = n_elmts >> 1;
+        const int off_s = instr.off_s;
+        // the LLRs of the root are read in 'Y_N', the arrays of the paths start with the children of the root
+        const int off_l = instr.off_l - this->N;
+
+        // root node
+        if (rev_depth == m)
         {
-            case tools::polar_node_t::STANDARD:
-                for (auto i = 0; i < n_active_paths; i++)
-                {
-                    const auto path = paths[i];
-                    const auto child = l[up_ref_array_idx(path, rev_depth - 1)].data();
-                    API_polar::g(Y_N, Y_N + n_elm_2, s[path].data() + off_s, child, n_elm_2);
-                }
-                break;
-            case tools::polar_node_t::RATE_0_LEFT:
-                for (auto i = 0; i < n_active_paths; i++)
-                {
-                    const auto path = paths[i];
-                    const auto child = l[up_ref_array_idx(path, rev_depth - 1)].data();
-                    API_polar::g0(Y_N, Y_N + n_elm_2, child, n_elm_2);
-                }
-                break;
-            case tools::polar_node_t::REP_LEFT:
-                for (auto i = 0; i < n_active_paths; i++)
-                {
-                    const auto path = paths[i];
-                    const auto child = l[up_ref_array_idx(path, rev_depth - 1)].data();
-                    API_polar::gr(Y_N, Y_N + n_elm_2, s[path].data() + off_s, child, n_elm_2);
-                }
-                break;
-            default:
-                break;
+            switch (instr.op)
+            {
+                case tools::polar_op_t::F:
+                    API_polar::f(Y_N, Y_N + n_elm_2, l[0].data(), n_elm_2);
+                    break;
+                case tools::polar_op_t::G:
+                    for (auto i = 0; i < n_active_paths; i++)
+                    {
+                        const auto path = paths[i];
+                        const auto child = l[up_ref_array_idx(path, rev_depth - 1)].data();
+                        API_polar::g(Y_N, Y_N + n_elm_2, s[path].data() + off_s, child, n_elm_2);
+                    }
+                    break;
+                case tools::polar_op_t::G0:
+                    for (auto i = 0; i < n_active_paths; i++)
+                    {
+                        const auto path = paths[i];
+                        const auto child = l[up_ref_array_idx(path, rev_depth - 1)].data();
+                        API_polar::g0(Y_N, Y_N + n_elm_2, child, n_elm_2);
+                    }
+                    break;
+                case tools::polar_op_t::GR:
+                    for (auto i = 0; i < n_active_paths; i++)
+                    {
+                        const auto path = paths[i];
+                        const auto child = l[up_ref_array_idx(path, rev_depth - 1)].data();
+                        API_polar::gr(Y_N, Y_N + n_elm_2, s[path].data() + off_s, child, n_elm_2);
+                    }
+                    break;
+                case tools::polar_op_t::XO:
+                    for (auto i = 0; i < n_active_paths; i++)
+                        API_polar::xo(s[paths[i]], off_s, off_s + n_elm_2, off_s, n_elm_2);
+                    break;
+                case tools::polar_op_t::XO0:
+                    for (auto i = 0; i < n_active_paths; i++)
+                        API_polar::xo0(s[paths[i]], off_s + n_elm_2, off_s, n_elm_2);
+                    break;
+                default:
+                    break;
+            }
+            continue;
         }
 
-        recursive_decode(Y_N, off_l, off_s + n_elm_2, rev_depth - 1, ++node_id); // recursive call right
-
-        // xor
-        switch (node_type)
-        {
-            case tools::polar_node_t::STANDARD:
-                for (auto i = 0; i < n_active_paths; i++)
-                    API_polar::xo(s[paths[i]], off_s, off_s + n_elm_2, off_s, n_elm_2);
-                break;
-            case tools::polar_node_t::RATE_0_LEFT:
-                for (auto i = 0; i < n_active_paths; i++)
-                    API_polar::xo0(s[paths[i]], off_s + n_elm_2, off_s, n_elm_2);
-                break;
-            case tools::polar_node_t::REP_LEFT:
-                for (auto i = 0; i < n_active_paths; i++)
-                    API_polar::xo(s[paths[i]], off_s, off_s + n_elm_2, off_s, n_elm_2);
-                break;
-            default:
-                break;
-        }
-    }
-    else if (!is_terminal_pattern && rev_depth) // other node (not root or leaf)
-    {
-        // f
-        switch (node_type)
+        switch (instr.op)
         {
-            case tools::polar_node_t::STANDARD:
+            case tools::polar_op_t::F:
                 for (auto i = 0; i < n_active_paths; i++)
                 {
                     const auto path = paths[i];
@@ -474,16 +446,7 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::recursive_decode(const R* Y_N,
                     API_polar::f(parent + off_l, parent + off_l + n_elm_2, child + off_l + n_elmts, n_elm_2);
                 }
                 break;
-            case tools::polar_node_t::REP_LEFT:
-                for (auto i = 0; i < n_active_paths; i++)
-                {
-                    const auto path = paths[i];
-                    const auto parent = l[path_2_array[path][rev_depth]].data();
-                    const auto child = l[up_ref_array_idx(path, rev_depth - 1)].data();
-                    API_polar::f(parent + off_l, parent + off_l + n_elm_2, child + off_l + n_elmts, n_elm_2);
-                }
-                break;
-            case tools::polar_node_t::RATE_0_LEFT:
+            case tools::polar_op_t::F0:
                 for (auto i = 0; i < n_active_paths && n_active_paths > 1; i++)
                 {
                     const auto path = paths[i];
@@ -492,16 +455,7 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::recursive_decode(const R* Y_N,
                     API_polar::f(parent + off_l, parent + off_l + n_elm_2, child + off_l + n_elmts, n_elm_2);
                 }
                 break;
-            default:
-                break;
-        }
-
-        recursive_decode(Y_N, off_l + n_elmts, off_s, rev_depth - 1, ++node_id); // recursive call left
-
-        // g
-        switch (node_type)
-        {
-            case tools::polar_node_t::STANDARD:
+            case tools::polar_op_t::G:
                 for (auto i = 0; i < n_active_paths; i++)
                 {
                     const auto path = paths[i];
@@ -514,7 +468,7 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::recursive_decode(const R* Y_N,
                                  n_elm_2);
                 }
                 break;
-            case tools::polar_node_t::RATE_0_LEFT:
+            case tools::polar_op_t::G0:
                 for (auto i = 0; i < n_active_paths; i++)
                 {
                     const auto path = paths[i];
@@ -523,7 +477,7 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::recursive_decode(const R* Y_N,
                     API_polar::g0(parent + off_l, parent + off_l + n_elm_2, child + off_l + n_elmts, n_elm_2);
                 }
                 break;
-            case tools::polar_node_t::REP_LEFT:
+            case tools::polar_op_t::GR:
                 for (auto i = 0; i < n_active_paths; i++)
                 {
                     const auto path = paths[i];
@@ -536,53 +490,33 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::recursive_decode(const R* Y_N,
                                   n_elm_2);
                 }
                 break;
-            default:
-                break;
-        }
-
-        recursive_decode(Y_N, off_l + n_elmts, off_s + n_elm_2, rev_depth - 1, ++node_id); // recursive call right
-
-        // xor
-        switch (node_type)
-        {
-            case tools::polar_node_t::STANDARD:
+            case tools::polar_op_t::XO:
                 for (auto i = 0; i < n_active_paths; i++)
                     API_polar::xo(s[paths[i]], off_s, off_s + n_elm_2, off_s, n_elm_2);
                 break;
-            case tools::polar_node_t::RATE_0_LEFT:
+            case tools::polar_op_t::XO0:
                 for (auto i = 0; i < n_active_paths; i++)
                     API_polar::xo0(s[paths[i]], off_s + n_elm_2, off_s, n_elm_2);
                 break;
-            case tools::polar_node_t::REP_LEFT:
-                for (auto i = 0; i < n_active_paths; i++)
-                    API_polar::xo(s[paths[i]], off_s, off_s + n_elm_2, off_s, n_elm_2);
-                break;
-            default:
-                break;
-        }
-    }
-    else // leaf node
-    {
-        // h
-        switch (node_type)
-        {
-            case tools::polar_node_t::RATE_0:
+            case tools::polar_op_t::H0:
                 update_paths_r0(rev_depth, off_l, off_s, n_elmts);
+                normalize_scl_metrics<R>(this->metrics, this->L);
                 break;
-            case tools::polar_node_t::REP:
+            case tools::polar_op_t::REP:
                 update_paths_rep(rev_depth, off_l, off_s, n_elmts);
+                normalize_scl_metrics<R>(this->metrics, this->L);
                 break;
-            case tools::polar_node_t::RATE_1:
+            case tools::polar_op_t::H:
                 update_paths_r1(rev_depth, off_l, off_s, n_elmts);
+                normalize_scl_metrics<R>(this->metrics, this->L);
                 break;
-            case tools::polar_node_t::SPC:
+            case tools::polar_op_t::SPC:
                 update_paths_spc(rev_depth, off_l, off_s, n_elmts);
+                normalize_scl_metrics<R>(this->metrics, this->L);
                 break;
             default:
                 break;
         }
-
-        normalize_scl_metrics<R>(this->metrics, this->L);
     }
 }
 
@@ -0,0 +1,77 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_RSC_BCJR_subblock.
+ */
+#ifndef DECODER_RSC_BCJR_SUBBLOCK_HPP_
+#define DECODER_RSC_BCJR_SUBBLOCK_HPP_
+
+#include <mipp.h>
+#include <vector>
+
+#include "Module/Decoder/RSC/BCJR/Decoder_RSC_BCJR.hpp"
+#include "Tools/Math/max.h"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_RSC_BCJR_subblock
+ *
+ * \brief Low latency BCJR decoder: the trellis of a single frame is split in sub-blocks processed in parallel.
+ *
+ * The trellis is split in 'mipp::N<R>()' sub-blocks of the same length and each sub-block is decoded in a SIMD lane
+ * (the layout of the inter-frame decoders is used, the lanes are the sub-blocks instead of the frames). The metrics
+ * at the boundaries of the sub-blocks are initialized from the metrics computed by the neighbour sub-blocks during the
+ * previous call (next iteration initialization), the first call after a reset starts from equiprobable states.
+ *
+ * In a turbo decoder the boundary metrics have to be kept between the iterations of a frame: the auto reset has to be
+ * disabled and 'reset' has to be called when a new frame is decoded.
+ */
+template<typename B = int, typename R = float, tools::proto_max_i<R> MAX = tools::max_i>
+class Decoder_RSC_BCJR_subblock : public Decoder_RSC_BCJR<B, R>
+{
+  protected:
+    const int n_sb;   // number of sub-blocks (one per SIMD lane)
+    const int sb_len; // number of trellis sections per sub-block
+
+    mipp::vector<R> alpha[8]; // node metric (left to right), index = section * n_sb + sub-block
+    mipp::vector<R> beta[8];  // node metric (right to left), index = section * n_sb + sub-block
+    mipp::vector<R> gamma[2]; // edge metric
+    mipp::vector<R> sys_sb;   // systematic LLRs reordered by sub-block
+    mipp::vector<R> par_sb;   // parity LLRs reordered by sub-block
+    mipp::vector<R> ext_sb;   // extrinsic LLRs reordered by sub-block
+
+    mipp::vector<R> alpha_init; // alpha metrics at the beginning of each sub-block (8 x n_sb)
+    mipp::vector<R> beta_init;  // beta metrics at the end of each sub-block (8 x n_sb)
+    bool init_valid;            // true if the boundary metrics come from a previous call
+
+  public:
+    Decoder_RSC_BCJR_subblock(const int& K,
+                              const std::vector<std::vector<int>>& trellis,
+                              const bool buffered_encoding = true);
+    virtual ~Decoder_RSC_BCJR_subblock() = default;
+
+    virtual Decoder_RSC_BCJR_subblock<B, R, MAX>* clone() const;
+
+    int get_n_subblocks() const;
+
+  protected:
+    virtual void _reset(const size_t frame_id);
+
+    int _decode_siso_alt(const R* sys, const R* par, R* ext, const size_t frame_id);
+
+    void compute_gamma(const R* sys, const R* par);
+    void compute_alpha();
+    void compute_beta();
+    void compute_ext(R* ext);
+    void update_boundaries();
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Module/Decoder/RSC/BCJR/Subblock/Decoder_RSC_BCJR_subblock.hxx"
+#endif
+
+#endif /* DECODER_RSC_BCJR_SUBBLOCK_HPP_ */
@@ -0,0 +1,294 @@
+#include <algorithm>
+#include <limits>
+#include <mipp.h>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Decoder/RSC/BCJR/Inter/Decoder_RSC_BCJR_inter_std.hpp"
+#include "Module/Decoder/RSC/BCJR/Subblock/Decoder_RSC_BCJR_subblock.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template<typename R>
+struct RSC_BCJR_subblock_init
+{
+    static R min() { return -std::numeric_limits<R>::max(); }
+};
+
+template<>
+struct RSC_BCJR_subblock_init<short>
+{
+    static short min() { return -(1 << (sizeof(short) * 8 - 2)); }
+};
+
+template<>
+struct RSC_BCJR_subblock_init<signed char>
+{
+    static signed char min() { return -127; }
+};
+
+// set the metrics of the 'idx' element to the state 0 (beginning of the trellis or end of the terminated trellis)
+template<typename R>
+static inline void
+RSC_BCJR_subblock_state0(mipp::vector<R> metrics[8], const int idx)
+{
+    metrics[0][idx] = (R)0;
+    for (auto j = 1; j < 8; j++)
+        metrics[j][idx] = RSC_BCJR_subblock_init<R>::min();
+}
+
+template<typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_subblock<B, R, MAX>::Decoder_RSC_BCJR_subblock(const int& K,
+                                                                const std::vector<std::vector<int>>& trellis,
+                                                                const bool buffered_encoding)
+  : Decoder_RSC_BCJR<B, R>(K, trellis, buffered_encoding)
+  , n_sb(mipp::N<R>())
+  , sb_len((K + this->n_ff + mipp::N<R>() - 1) / mipp::N<R>())
+  , sys_sb(sb_len * n_sb)
+  , par_sb(sb_len * n_sb)
+  , ext_sb(sb_len * n_sb)
+  , alpha_init(8 * n_sb, (R)0)
+  , beta_init(8 * n_sb, (R)0)
+  , init_valid(false)
+{
+    const std::string name = "Decoder_RSC_BCJR_subblock";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    std::vector<std::vector<int>> req_trellis(10, std::vector<int>(8));
+    req_trellis[0] = { 0, 2, 4, 6, 0, 2, 4, 6 };
+    req_trellis[1] = { 1, -1, 1, -1, -1, 1, -1, 1 };
+    req_trellis[2] = { 0, 1, 1, 0, 0, 1, 1, 0 };
+    req_trellis[3] = { 1, 3, 5, 7, 1, 3, 5, 7 };
+    req_trellis[4] = { -1, 1, -1, 1, 1, -1, 1, -1 };
+    req_trellis[5] = { 0, 1, 1, 0, 0, 1, 1, 0 };
+    req_trellis[6] = { 0, 4, 5, 1, 2, 6, 7, 3 };
+    req_trellis[7] = { 0, 0, 1, 1, 1, 1, 0, 0 };
+    req_trellis[8] = { 4, 0, 1, 5, 6, 2, 3, 7 };
+    req_trellis[9] = { 0, 0, 1, 1, 1, 1, 0, 0 };
+
+    for (unsigned i = 0; i < req_trellis.size(); i++)
+        if (trellis[i] != req_trellis[i])
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, "Unsupported trellis.");
+
+    for (auto i = 0; i < 8; i++)
+        alpha[i].resize((sb_len + 1) * n_sb);
+    for (auto i = 0; i < 8; i++)
+        beta[i].resize((sb_len + 1) * n_sb);
+    for (auto i = 0; i < 2; i++)
+        gamma[i].resize(sb_len * n_sb);
+}
+
+template<typename B, typename R, tools::proto_max_i<R> MAX>
+Decoder_RSC_BCJR_subblock<B, R, MAX>*
+Decoder_RSC_BCJR_subblock<B, R, MAX>::clone() const
+{
+    auto m = new Decoder_RSC_BCJR_subblock(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R, tools::proto_max_i<R> MAX>
+int
+Decoder_RSC_BCJR_subblock<B, R, MAX>::get_n_subblocks() const
+{
+    return this->n_sb;
+}
+
+template<typename B, typename R, tools::proto_max_i<R> MAX>
+void
+Decoder_RSC_BCJR_subblock<B, R, MAX>::_reset(const size_t frame_id)
+{
+    this->init_valid = false;
+}
+
+template<typename B, typename R, tools::proto_max_i<R> MAX>
+void
+Decoder_RSC_BCJR_subblock<B, R, MAX>::compute_gamma(const R* sys, const R* par)
+{
+    const auto n_sections = this->K + this->n_ff;
+
+    // reorder the LLRs: the t-th section of the p-th sub-block is at the position 't * n_sb + p'
+    for (auto p = 0; p < this->n_sb; p++)
+        for (auto t = 0; t < this->sb_len; t++)
+        {
+            const auto k = p * this->sb_len + t;
+            this->sys_sb[t * this->n_sb + p] = k < n_sections ? sys[k] : (R)0;
+            this->par_sb[t * this->n_sb + p] = k < n_sections ? par[k] : (R)0;
+        }
+
+    for (auto i = 0; i < this->sb_len * this->n_sb; i += this->n_sb)
+    {
+        const auto r_sys = mipp::Reg<R>(&this->sys_sb[i]);
+        const auto r_par = mipp::Reg<R>(&this->par_sb[i]);
+
+        // there is a big loss of precision here in fixed point
+        const auto r_g0 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys + r_par);
+        const auto r_g1 = RSC_BCJR_inter_div_or_not<R>::apply(r_sys - r_par);
+
+        r_g0.store(&this->gamma[0][i]);
+        r_g1.store(&this->gamma[1][i]);
+    }
+}
+
+template<typename B, typename R, tools::proto_max_i<R> MAX>
+void
+Decoder_RSC_BCJR_subblock<B, R, MAX>::compute_alpha()
+{
+    const auto stride = this->n_sb;
+
+    // the first sub-block starts in the state 0, the others start from the boundary metrics
+    for (auto j = 0; j < 8; j++)
+        std::copy(&this->alpha_init[j * stride], &this->alpha_init[(j + 1) * stride], &this->alpha[j][0]);
+    RSC_BCJR_subblock_state0<R>(this->alpha, 0);
+
+    // compute alpha values [trellis forward traversal ->]
+    constexpr int idx_a1[8] = { 0, 3, 4, 7, 1, 2, 5, 6 };
+    constexpr int idx_a2[8] = { 1, 2, 5, 6, 0, 3, 4, 7 };
+    constexpr int idx_g1[8] = { 0, 1, 1, 0, 0, 1, 1, 0 };
+    for (auto i = stride; i <= this->sb_len * stride; i += stride)
+    {
+        for (auto j = 0; j < 8; j++)
+        {
+            const auto r_g1 = mipp::Reg<R>(&this->gamma[idx_g1[j]][i - stride]);
+            const auto r_a1 = mipp::Reg<R>(&this->alpha[idx_a1[j]][i - stride]);
+            const auto r_a2 = mipp::Reg<R>(&this->alpha[idx_a2[j]][i - stride]);
+
+            const auto r_a3 = MAX(r_a1 + r_g1, r_a2 - r_g1);
+
+            r_a3.store(&this->alpha[j][i]);
+        }
+
+        RSC_BCJR_inter_std_normalize<R>::apply(this->alpha, i);
+    }
+}
+
+template<typename B, typename R, tools::proto_max_i<R> MAX>
+void
+Decoder_RSC_BCJR_subblock<B, R, MAX>::compute_beta()
+{
+    const auto stride = this->n_sb;
+
+    // the terminated trellis ends in the state 0 in the section 'last_t' of the last sub-block, the padding sections
+    // after it are overwritten when the backward traversal reaches this section
+    const auto n_sections = this->K + this->n_ff;
+    const auto last_sb = (n_sections - 1) / this->sb_len;
+    const auto last_t = n_sections - last_sb * this->sb_len;
+
+    for (auto j = 0; j < 8; j++)
+        std::copy(
+          &this->beta_init[j * stride], &this->beta_init[(j + 1) * stride], &this->beta[j][this->sb_len * stride]);
+    if (last_t == this->sb_len) RSC_BCJR_subblock_state0<R>(this->beta, this->sb_len * stride + last_sb);
+
+    // compute beta values [trellis backward traversal <-]
+    constexpr int idx_b1[8] = { 0, 4, 5, 1, 2, 6, 7, 3 };
+    constexpr int idx_b2[8] = { 4, 0, 1, 5, 6, 2, 3, 7 };
+    constexpr int idx_g2[8] = { 0, 0, 1, 1, 1, 1, 0, 0 };
+    for (auto t = this->sb_len - 1; t >= 0; t--)
+    {
+        const auto i = t * stride;
+        for (auto j = 0; j < 8; j++)
+        {
+            const auto r_g2 = mipp::Reg<R>(&this->gamma[idx_g2[j]][i]);
+            const auto r_b1 = mipp::Reg<R>(&this->beta[idx_b1[j]][i + stride]);
+            const auto r_b2 = mipp::Reg<R>(&this->beta[idx_b2[j]][i + stride]);
+
+            const auto r_b3 = MAX(r_b1 + r_g2, r_b2 - r_g2);
+
+            r_b3.store(&this->beta[j][i]);
+        }
+
+        RSC_BCJR_inter_std_normalize<R>::apply(this->beta, i);
+
+        if (t == last_t) RSC_BCJR_subblock_state0<R>(this->beta, i + last_sb);
+    }
+}
+
+template<typename B, typename R, tools::proto_max_i<R> MAX>
+void
+Decoder_RSC_BCJR_subblock<B, R, MAX>::compute_ext(R* ext)
+{
+    const auto stride = this->n_sb;
+
+    // compute extrinsic values
+    constexpr int idx_b1[8] = { 0, 4, 5, 1, 2, 6, 7, 3 };
+    constexpr int idx_b2[8] = { 4, 0, 1, 5, 6, 2, 3, 7 };
+    constexpr int idx_g2[8] = { 0, 0, 1, 1, 1, 1, 0, 0 };
+    for (auto i = 0; i < this->sb_len * stride; i += stride)
+    {
+        auto r_a = mipp::Reg<R>(&this->alpha[0][i]);
+        auto r_b = mipp::Reg<R>(&this->beta[idx_b1[0]][i + stride]);
+        auto r_g = mipp::Reg<R>(&this->gamma[idx_g2[0]][i]);
+        auto r_max0 = r_a + r_b + r_g;
+        for (auto j = 1; j < 8; j++)
+        {
+            r_a = mipp::Reg<R>(&this->alpha[j][i]);
+            r_b = mipp::Reg<R>(&this->beta[idx_b1[j]][i + stride]);
+            r_g = mipp::Reg<R>(&this->gamma[idx_g2[j]][i]);
+            r_max0 = MAX(r_max0, r_a + r_b + r_g);
+        }
+
+        r_a = mipp::Reg<R>(&this->alpha[0][i]);
+        r_b = mipp::Reg<R>(&this->beta[idx_b2[0]][i + stride]);
+        r_g = mipp::Reg<R>(&this->gamma[idx_g2[0]][i]);
+        auto r_max1 = r_a + r_b - r_g;
+        for (auto j = 1; j < 8; j++)
+        {
+            r_a = mipp::Reg<R>(&this->alpha[j][i]);
+            r_b = mipp::Reg<R>(&this->beta[idx_b2[j]][i + stride]);
+            r_g = mipp::Reg<R>(&this->gamma[idx_g2[j]][i]);
+            r_max1 = MAX(r_max1, r_a + r_b - r_g);
+        }
+
+        const auto r_post = RSC_BCJR_inter_post<R>::compute(r_max0 - r_max1);
+        const auto r_ext = r_post - &this->sys_sb[i];
+        r_ext.store(&this->ext_sb[i]);
+    }
+
+    // put the extrinsic values back in the natural order
+    for (auto p = 0; p < this->n_sb; p++)
+        for (auto t = 0; t < this->sb_len && p * this->sb_len + t < this->K; t++)
+            ext[p * this->sb_len + t] = this->ext_sb[t * stride + p];
+}
+
+template<typename B, typename R, tools::proto_max_i<R> MAX>
+void
+Decoder_RSC_BCJR_subblock<B, R, MAX>::update_boundaries()
+{
+    // next iteration initialization: a sub-block starts from the last alpha values of the previous sub-block and ends
+    // with the first beta values of the next sub-block
+    const auto stride = this->n_sb;
+    for (auto j = 0; j < 8; j++)
+    {
+        for (auto p = 1; p < this->n_sb; p++)
+            this->alpha_init[j * stride + p] = this->alpha[j][this->sb_len * stride + p - 1];
+        for (auto p = 0; p < this->n_sb - 1; p++)
+            this->beta_init[j * stride + p] = this->beta[j][p + 1];
+    }
+}
+
+template<typename B, typename R, tools::proto_max_i<R> MAX>
+int
+Decoder_RSC_BCJR_subblock<B, R, MAX>::_decode_siso_alt(const R* sys, const R* par, R* ext, const size_t frame_id)
+{
+    // first call for this frame: the boundary states are equiprobable
+    if (!this->init_valid)
+    {
+        std::fill(this->alpha_init.begin(), this->alpha_init.end(), (R)0);
+        std::fill(this->beta_init.begin(), this->beta_init.end(), (R)0);
+    }
+
+    this->compute_gamma(sys, par);
+    this->compute_alpha();
+    this->compute_beta();
+    this->compute_ext(ext);
+    this->update_boundaries();
+    this->init_valid = true;
+
+    return 0;
+}
+}
+}
@@ -62,6 +62,7 @@ class Decoder_turbo : public Decoder_SIHO<B, R>
 
   protected:
     virtual void deep_copy(const Decoder_turbo<B, R>& m);
+    virtual void _reset(const size_t frame_id);
     virtual void _load(const R* Y_N, const size_t frame_id);
     virtual void _store(B* V_K) const;
 
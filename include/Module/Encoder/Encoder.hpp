@@ -20,6 +20,7 @@ namespace enc
 enum class tsk : size_t
 {
     encode,
+    encode_packed,
     SIZE
 };
 
@@ -31,6 +32,12 @@ enum class encode : size_t
     X_N,
     status
 };
+enum class encode_packed : size_t
+{
+    U_K,
+    X_N,
+    status
+};
 }
 }
 
@@ -51,6 +58,7 @@ class Encoder
   public:
     inline spu::runtime::Task& operator[](const enc::tsk t);
     inline spu::runtime::Socket& operator[](const enc::sck::encode s);
+    inline spu::runtime::Socket& operator[](const enc::sck::encode_packed s);
 
   protected:
     const int K;                         /*!< Number of information bits in one frame */
@@ -62,6 +70,9 @@ class Encoder
     std::vector<std::vector<B>> U_K_mem;
     std::vector<std::vector<B>> X_N_mem;
 
+    std::vector<B> U_K_unpacked; // default 'encode_packed' implementation: unpacked information bits
+    std::vector<B> X_N_unpacked; // default 'encode_packed' implementation: unpacked codewords
+
   public:
     /*!
      * \brief Constructor.
@@ -106,6 +117,24 @@ class Encoder
 
     void encode(const B* U_K, B* X_N, const int frame_id = -1, const bool managed_memory = true);
 
+    /*!
+     * \brief Task method that encodes a vector of packed information bits.
+     *
+     * The frames are stored in 'tools::packed_size<B>(K)' (input) and 'tools::packed_size<B>(N)' (output) elements
+     * (see Tools/Perf/common/bit_packing.h). By default the bits are unpacked, encoded and packed again, the encoders
+     * that can work directly on the packed bits override '_encode_packed'.
+     *
+     * \param U_K: a vector of packed information bits (a message).
+     * \param X_N: a packed encoded frame with redundancy added (parity bits).
+     */
+    template<class A = std::allocator<B>>
+    void encode_packed(const std::vector<B, A>& U_K,
+                       std::vector<B, A>& X_N,
+                       const int frame_id = -1,
+                       const bool managed_memory = true);
+
+    void encode_packed(const B* U_K, B* X_N, const int frame_id = -1, const bool managed_memory = true);
+
     template<class A = std::allocator<B>>
     bool is_codeword(const std::vector<B, A>& X_N);
 
@@ -130,6 +159,8 @@ class Encoder
   protected:
     virtual void _encode(const B* U_K, B* X_N, const size_t frame_id);
 
+    virtual void _encode_packed(const B* U_K, B* X_N, const size_t frame_id);
+
     void set_sys(const bool sys);
 };
 }
@@ -4,6 +4,7 @@
 #include <string>
 
 #include "Module/Encoder/Encoder.hpp"
+#include "Tools/Perf/common/bit_packing.h"
 
 namespace aff3ct
 {
@@ -24,6 +25,13 @@ Encoder<B>::operator[](const enc::sck::encode s)
     return spu::module::Module::operator[]((size_t)enc::tsk::encode)[(size_t)s];
 }
 
+template<typename B>
+spu::runtime::Socket&
+Encoder<B>::operator[](const enc::sck::encode_packed s)
+{
+    return spu::module::Module::operator[]((size_t)enc::tsk::encode_packed)[(size_t)s];
+}
+
 template<typename B>
 Encoder<B>::Encoder(const int K, const int N)
   : spu::module::Stateful()
@@ -85,6 +93,33 @@ Encoder<B>::Encoder(const int K, const int N)
           return spu::runtime::status_t::SUCCESS;
       });
 
+    auto& p2 = this->create_task("encode_packed");
+    auto p2s_U_K = this->template create_socket_in<B>(p2, "U_K", tools::packed_size<B>(this->K));
+    auto p2s_X_N = this->template create_socket_out<B>(p2, "X_N", tools::packed_size<B>(this->N));
+    this->create_codelet(
+      p2,
+      [p2s_U_K, p2s_X_N](spu::module::Module& m, spu::runtime::Task& t, const size_t frame_id) -> int
+      {
+          auto& enc = static_cast<Encoder<B>&>(m);
+          const auto U_K = static_cast<B*>(t[p2s_U_K].get_dataptr());
+          const auto X_N = static_cast<B*>(t[p2s_X_N].get_dataptr());
+
+          enc._encode_packed(U_K, X_N, frame_id);
+
+          if (enc.is_memorizing())
+          {
+              const auto n_packed_K = tools::packed_size<B>(enc.K);
+              const auto n_packed_N = tools::packed_size<B>(enc.N);
+              for (size_t f = 0; f < enc.get_n_frames_per_wave(); f++)
+              {
+                  tools::unpack_bits(U_K + f * n_packed_K, enc.U_K_mem[frame_id + f].data(), enc.K);
+                  tools::unpack_bits(X_N + f * n_packed_N, enc.X_N_mem[frame_id + f].data(), enc.N);
+              }
+          }
+
+          return spu::runtime::status_t::SUCCESS;
+      });
+
     std::iota(info_bits_pos.begin(), info_bits_pos.end(), 0);
 }
 
@@ -183,6 +218,28 @@ Encoder<B>::encode(const B* U_K, B* X_N, const int frame_id, const bool managed_
     (*this)[enc::tsk::encode].exec(frame_id, managed_memory);
 }
 
+template<typename B>
+template<class A>
+void
+Encoder<B>::encode_packed(const std::vector<B, A>& U_K,
+                          std::vector<B, A>& X_N,
+                          const int frame_id,
+                          const bool managed_memory)
+{
+    (*this)[enc::sck::encode_packed::U_K].bind(U_K);
+    (*this)[enc::sck::encode_packed::X_N].bind(X_N);
+    (*this)[enc::tsk::encode_packed].exec(frame_id, managed_memory);
+}
+
+template<typename B>
+void
+Encoder<B>::encode_packed(const B* U_K, B* X_N, const int frame_id, const bool managed_memory)
+{
+    (*this)[enc::sck::encode_packed::U_K].bind(U_K);
+    (*this)[enc::sck::encode_packed::X_N].bind(X_N);
+    (*this)[enc::tsk::encode_packed].exec(frame_id, managed_memory);
+}
+
 template<typename B>
 template<class A>
 bool
@@ -227,6 +284,26 @@ Encoder<B>::_encode(const B* U_K, B* X_N, const size_t frame_id)
     throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
 }
 
+template<typename B>
+void
+Encoder<B>::_encode_packed(const B* U_K, B* X_N, const size_t frame_id)
+{
+    const auto n_frames_per_wave = this->get_n_frames_per_wave();
+    const auto n_packed_K = tools::packed_size<B>(this->K);
+    const auto n_packed_N = tools::packed_size<B>(this->N);
+
+    this->U_K_unpacked.resize(this->K * n_frames_per_wave);
+    this->X_N_unpacked.resize(this->N * n_frames_per_wave);
+
+    for (size_t f = 0; f < n_frames_per_wave; f++)
+        tools::unpack_bits(U_K + f * n_packed_K, this->U_K_unpacked.data() + f * this->K, this->K);
+
+    this->_encode(this->U_K_unpacked.data(), this->X_N_unpacked.data(), frame_id);
+
+    for (size_t f = 0; f < n_frames_per_wave; f++)
+        tools::pack_bits(this->X_N_unpacked.data() + f * this->N, X_N + f * n_packed_N, this->N);
+}
+
 template<typename B>
 void
 Encoder<B>::set_sys(const bool sys)
@@ -5,10 +5,13 @@
 #ifndef ENCODER_LDPC_FROM_H_HPP_
 #define ENCODER_LDPC_FROM_H_HPP_
 
+#include <cstdint>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "Module/Encoder/LDPC/Encoder_LDPC.hpp"
+#include "Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hpp"
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 
 namespace aff3ct
@@ -16,12 +19,35 @@ namespace aff3ct
 namespace module
 {
 
+/*!
+ * \class Encoder_LDPC_from_H
+ *
+ * \brief Encoder of the LDPC codes defined by a generic H parity matrix.
+ *
+ * With the "IDENTITY" and "LU_DEC" methods a G generator matrix is built from H and the encoding is a (dense)
+ * product by G. With the "RU" method no G is built: H is put once in the approximate lower triangular form of
+ * Richardson and Urbanke, H = [A B T; C D E] with T lower triangular (up to a permutation of the rows and of the
+ * columns), and the parity bits are computed by sparse back-substitutions in T plus a small dense product by the
+ * inverse of phi = E T^-1 B + D (g x g, g being the gap). The cost per frame is linear in the number of ones of H
+ * plus g^2.
+ */
 template<typename B = int>
 class Encoder_LDPC_from_H : public Encoder_LDPC<B>
 {
   private:
     static std::thread::id master_thread_id;
 
+    // approximate lower triangular form of H ("RU" method)
+    bool ALT;
+    std::vector<uint32_t> tri_cols;    // column of the diagonal of each row of T, in the back-substitution order
+    std::vector<uint32_t> tri_offsets; // the other columns of the row 't' of T are in 'tri_links[tri_offsets[t]]' to
+    std::vector<uint32_t> tri_links;   // 'tri_links[tri_offsets[t +1] -1]'
+    std::vector<uint32_t> gap_offsets; // same for the columns of the gap rows
+    std::vector<uint32_t> gap_links;
+    std::vector<uint32_t> p1_cols;  // the parity bits computed from the syndrome of the gap rows
+    tools::GF2_matrix phi_inv;      // rows of the inverse of phi matching 'p1_cols'
+    std::vector<uint64_t> syndrome; // packed syndrome of the gap rows
+
   public:
     Encoder_LDPC_from_H(const int K,
                         const int N,
@@ -32,6 +58,24 @@ class Encoder_LDPC_from_H : public Encoder_LDPC<B>
     virtual ~Encoder_LDPC_from_H() = default;
 
     virtual Encoder_LDPC_from_H<B>* clone() const;
+
+  protected:
+    void _encode(const B* U_K, B* X_N, const size_t frame_id);
+
+  private:
+    /*
+     * Compute the approximate lower triangular form of H (greedy triangulation), select the parity bits and the
+     * information bits and invert phi
+     */
+    void init_ALT();
+    void solve_T(B* X_N) const;
+
+    /*
+     * Load G and the info bits positions from 'G_save_path' if this file has been saved from the same H with the same
+     * method ('H_hash'), return false otherwise
+     */
+    bool load_G(const std::string& G_save_path, const uint64_t H_hash);
+    void save_G(const std::string& G_save_path, const uint64_t H_hash) const;
 };
 
 }
@@ -0,0 +1,58 @@
+/*!
+ * \file
+ * \brief Class module::Encoder_LDPC_NR.
+ */
+#ifndef ENCODER_LDPC_NR_HPP_
+#define ENCODER_LDPC_NR_HPP_
+
+#include <utility>
+#include <vector>
+
+#include "Module/Encoder/LDPC/Encoder_LDPC.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Code/LDPC/Standard/NR/NR_constants.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+
+/*!
+ * \class Encoder_LDPC_NR
+ * \brief Encoder of the 5G NR LDPC codes.
+ *
+ * The four first parity blocks form the double-diagonal core of the base graph: they are computed directly from the
+ * circulant shifts (no generator matrix), the remaining parity blocks are single parity checks (extension rows).
+ * The filler bits (between 'K' and 'K_b' * 'Z') are set to 0.
+ */
+template<typename B = int>
+class Encoder_LDPC_NR : public Encoder_LDPC<B>
+{
+    const tools::nr_values& nr;
+
+    // for each row of the base graph, the (block column, shift value) pairs of the systematic part (and of the
+    // four core parity blocks for the extension rows)
+    std::vector<std::vector<std::pair<int, int>>> rows;
+    std::vector<int> core_shifts; // shift values of the first parity block in the 4 core rows, -1 for a null block
+    int x;                        // shift value of the first parity block that does not cancel in the core rows
+
+    std::vector<B> lambda; // partial parities of the 4 core rows
+
+  public:
+    Encoder_LDPC_NR(const tools::Sparse_matrix& H, const tools::nr_values& nr);
+    virtual ~Encoder_LDPC_NR() = default;
+
+    virtual Encoder_LDPC_NR<B>* clone() const;
+
+  protected:
+    void _encode(const B* U_K, B* X_N, const size_t frame_id);
+    void _check_H_dimensions();
+
+  private:
+    inline void add_shifted(const B* blk, const int s, B* acc) const;
+};
+
+}
+}
+
+#endif /* ENCODER_LDPC_NR_HPP_ */
@@ -24,6 +24,7 @@ class Encoder_NO : public Encoder<B>
 
   protected:
     void _encode(const B* U_K, B* X_K, const size_t frame_id);
+    void _encode_packed(const B* U_K, B* X_K, const size_t frame_id);
 };
 }
 }
@@ -5,6 +5,7 @@
 #ifndef ENCODER_POLAR_HPP_
 #define ENCODER_POLAR_HPP_
 
+#include <cstdint>
 #include <vector>
 
 #include "Module/Encoder/Encoder.hpp"
@@ -23,6 +24,8 @@ class Encoder_polar
     const int m;                   // log_2 of code length
     std::vector<bool> frozen_bits; // true means frozen, false means set to 0/1
     std::vector<B> X_N_tmp;
+    std::vector<uint64_t> X_N_words;       // packed codeword (64 bits per word)
+    std::vector<uint64_t> info_bits_words; // packed mask of the information bits positions
 
   public:
     Encoder_polar(const int& K, const int& N, const std::vector<bool>& frozen_bits);
@@ -39,7 +42,11 @@ class Encoder_polar
 
   protected:
     virtual void _encode(const B* U_K, B* X_N, const size_t frame_id);
+    virtual void _encode_packed(const B* U_K, B* X_N, const size_t frame_id);
     void convert(const B* U_K, B* U_N);
+    void convert_packed(const B* U_K, uint64_t* U_N);
+    void light_encode_packed(uint64_t* words);
+    void store_packed(const uint64_t* words, B* X_N);
 };
 }
 }
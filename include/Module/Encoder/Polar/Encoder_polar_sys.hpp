@@ -24,6 +24,7 @@ class Encoder_polar_sys : public Encoder_polar<B>
 
   protected:
     void _encode(const B* U_K, B* X_N, const size_t frame_id);
+    void _encode_packed(const B* U_K, B* X_N, const size_t frame_id);
 };
 }
 }
@@ -115,17 +115,6 @@ class Interleaver : public spu::module::Stateful
                                         const bool managed_memory = true);
 
     void set_n_frames_per_wave(const size_t n_frames_per_wave);
-
-  private:
-    inline void _interleave(const D* in_vec,
-                            D* out_vec,
-                            const std::vector<T>& lookup_table,
-                            const size_t frame_id) const;
-
-    inline void _interleave_reordering(const D* in_vec,
-                                       D* out_vec,
-                                       const std::vector<T>& lookup_table,
-                                       const size_t frame_id) const;
 };
 }
 }
@@ -1,4 +1,3 @@
-#include <mipp.h>
 #include <sstream>
 #include <string>
 
@@ -62,10 +61,10 @@ Interleaver<D, T>::Interleaver(const tools::Interleaver_core<T>& core)
                          {
                              auto& itl = static_cast<Interleaver<D, T>&>(m);
 
-                             itl._interleave(static_cast<D*>(t[p1s_nat].get_dataptr()),
-                                             static_cast<D*>(t[p1s_itl].get_dataptr()),
-                                             itl.core.get_lut(),
-                                             frame_id);
+                             itl.core.interleave(static_cast<const D*>(t[p1s_nat].get_dataptr()),
+                                                 static_cast<D*>(t[p1s_itl].get_dataptr()),
+                                                 frame_id % itl.get_n_frames(),
+                                                 itl.get_n_frames_per_wave());
 
                              return spu::runtime::status_t::SUCCESS;
                          });
@@ -78,10 +77,10 @@ Interleaver<D, T>::Interleaver(const tools::Interleaver_core<T>& core)
                          {
                              auto& itl = static_cast<Interleaver<D, T>&>(m);
 
-                             itl._interleave_reordering(static_cast<D*>(t[p2s_nat].get_dataptr()),
-                                                        static_cast<D*>(t[p2s_itl].get_dataptr()),
-                                                        itl.core.get_lut(),
-                                                        frame_id);
+                             itl.core.interleave_reordering(static_cast<const D*>(t[p2s_nat].get_dataptr()),
+                                                            static_cast<D*>(t[p2s_itl].get_dataptr()),
+                                                            frame_id % itl.get_n_frames(),
+                                                            itl.get_n_frames_per_wave());
 
                              return spu::runtime::status_t::SUCCESS;
                          });
@@ -94,10 +93,10 @@ Interleaver<D, T>::Interleaver(const tools::Interleaver_core<T>& core)
                          {
                              auto& itl = static_cast<Interleaver<D, T>&>(m);
 
-                             itl._interleave(static_cast<D*>(t[p3s_itl].get_dataptr()),
-                                             static_cast<D*>(t[p3s_nat].get_dataptr()),
-                                             itl.core.get_lut_inv(),
-                                             frame_id);
+                             itl.core.deinterleave(static_cast<const D*>(t[p3s_itl].get_dataptr()),
+                                                   static_cast<D*>(t[p3s_nat].get_dataptr()),
+                                                   frame_id % itl.get_n_frames(),
+                                                   itl.get_n_frames_per_wave());
 
                              return spu::runtime::status_t::SUCCESS;
                          });
@@ -110,10 +109,10 @@ Interleaver<D, T>::Interleaver(const tools::Interleaver_core<T>& core)
                          {
                              auto& itl = static_cast<Interleaver<D, T>&>(m);
 
-                             itl._interleave_reordering(static_cast<D*>(t[p4s_itl].get_dataptr()),
-                                                        static_cast<D*>(t[p4s_nat].get_dataptr()),
-                                                        itl.core.get_lut_inv(),
-                                                        frame_id);
+                             itl.core.deinterleave_reordering(static_cast<const D*>(t[p4s_itl].get_dataptr()),
+                                                              static_cast<D*>(t[p4s_nat].get_dataptr()),
+                                                              frame_id % itl.get_n_frames(),
+                                                              itl.get_n_frames_per_wave());
 
                              return spu::runtime::status_t::SUCCESS;
                          });
@@ -225,78 +224,6 @@ Interleaver<D, T>::deinterleave_reordering(const D* itl, D* nat, const int frame
     (*this)[itl::tsk::deinterleave_reordering].exec(frame_id, managed_memory);
 }
 
-template<typename D, typename T>
-void
-Interleaver<D, T>::_interleave(const D* in_vec,
-                               D* out_vec,
-                               const std::vector<T>& lookup_table,
-                               const size_t frame_id) const
-{
-    if (!this->core.is_uniform())
-    {
-        // TODO: vectorize this code with the new AVX gather instruction
-        for (size_t f = 0; f < this->get_n_frames_per_wave(); f++)
-        {
-            const auto off = f * this->core.get_size();
-            for (auto i = 0; i < this->core.get_size(); i++)
-                out_vec[off + i] = in_vec[off + lookup_table[i]];
-        }
-    }
-    else
-    {
-        auto cur_frame_id = (frame_id % this->get_n_frames()) % this->core.get_n_frames();
-        // TODO: vectorize this code with the new AVX gather instruction
-        for (size_t f = 0; f < this->get_n_frames_per_wave(); f++)
-        {
-            const auto lut = lookup_table.data() + cur_frame_id * this->core.get_size();
-            const auto off = f * this->core.get_size();
-            for (auto i = 0; i < this->core.get_size(); i++)
-                out_vec[off + i] = in_vec[off + lut[i]];
-            cur_frame_id = ((cur_frame_id + 1) % this->get_n_frames()) % this->core.get_n_frames();
-        }
-    }
-}
-
-template<typename D, typename T>
-void
-Interleaver<D, T>::_interleave_reordering(const D* in_vec,
-                                          D* out_vec,
-                                          const std::vector<T>& lookup_table,
-                                          const size_t frame_id) const
-{
-    if (!this->core.is_uniform())
-    {
-        // vectorized interleaving
-        if (this->get_n_frames_per_wave() == (size_t)mipp::nElReg<D>())
-        {
-            for (auto i = 0; i < this->core.get_size(); i++)
-                mipp::store<D>(&out_vec[i * mipp::nElReg<D>()],
-                               mipp::load<D>(&in_vec[lookup_table[i] * mipp::nElReg<D>()]));
-        }
-        else
-        {
-            for (auto i = 0; i < this->core.get_size(); i++)
-            {
-                const auto off1 = i * this->get_n_frames();
-                const auto off2 = lookup_table[i] * this->get_n_frames();
-                for (size_t f = 0; f < this->get_n_frames_per_wave(); f++)
-                    out_vec[off1 + f] = in_vec[off2 + f];
-            }
-        }
-    }
-    else
-    {
-        auto cur_frame_id = (frame_id % this->get_n_frames()) % this->core.get_n_frames();
-        for (size_t f = 0; f < this->get_n_frames_per_wave(); f++)
-        {
-            const auto lut = lookup_table.data() + cur_frame_id * this->core.get_size();
-            for (auto i = 0; i < this->core.get_size(); i++)
-                out_vec[i * this->get_n_frames_per_wave() + f] = in_vec[lut[i] * this->get_n_frames() + f];
-            cur_frame_id = ((cur_frame_id + 1) % this->get_n_frames()) % this->core.get_n_frames();
-        }
-    }
-}
-
 template<typename D, typename T>
 void
 Interleaver<D, T>::set_n_frames_per_wave(const size_t n_frames_per_wave)
@@ -0,0 +1,74 @@
+/*!
+ * \file
+ * \brief Class module::Modem_generic_sector.
+ */
+#ifndef MODEM_GENERIC_SECTOR_HPP_
+#define MODEM_GENERIC_SECTOR_HPP_
+
+#include <vector>
+
+#include "Module/Modem/Generic/Modem_generic_fast.hpp"
+#include "Tools/Constellation/Constellation.hpp"
+#include "Tools/Math/max.h"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Modem_generic_sector
+ *
+ * \brief Max-log demodulator of the PAM and QAM constellations.
+ *
+ * The Gray-coded PAM and QAM constellations are decomposed in independent real dimensions (one for the PAM, the I and
+ * Q parts for the QAM) of 2^m levels. Each dimension is split in 2^(m+1) sectors bounded by the levels and by the
+ * middles between two levels: in a sector the nearest level and, for each bit, the nearest level with the opposite
+ * bit are always the same. The max-log LLR of a bit is then a linear function of the received sample whose
+ * coefficients are precomputed per sector, the demodulation costs O(log M) per symbol instead of O(M log M).
+ *
+ * The PAM and QAM LLRs are always computed with the max-log approximation (whatever 'MAX'), the other constellations
+ * and the demodulations with a channel gain are processed by Modem_generic_fast.
+ */
+template<typename B = int,
+         typename R = float,
+         typename Q = R,
+         tools::proto_max<Q> MAX = tools::max,
+         tools::proto_max_i<Q> MAXI = tools::max_i>
+class Modem_generic_sector : public Modem_generic_fast<B, R, Q, MAX, MAXI>
+{
+  protected:
+    bool sector_demod; // true if the constellation can be decomposed in sectors
+    int n_dims;        // number of real dimensions (1 for the PAM, 2 for the QAM)
+    int bits_per_dim;  // number of bits per dimension
+    int n_sectors;     // number of sectors per dimension
+
+    std::vector<Q> first_level;   // position of the lowest level (per dimension)
+    std::vector<Q> inv_half_step; // inverse of the half distance between two levels (per dimension)
+    std::vector<Q> coef_a;        // LLR slopes, index = (dimension * n_sectors + sector) * bits_per_dim + bit
+    std::vector<Q> coef_c;        // LLR offsets, same index as 'coef_a'
+
+  public:
+    Modem_generic_sector(const int N, const tools::Constellation<R>& cstl, const bool disable_sig2 = false);
+
+    virtual ~Modem_generic_sector() = default;
+
+    virtual Modem_generic_sector<B, R, Q, MAX, MAXI>* clone() const;
+
+    bool is_sector_demod() const;
+
+  protected:
+    void _demodulate_complex(const Q* Y_N1, Q* Y_N2, const size_t frame_id);
+    void _demodulate_real(const Q* Y_N1, Q* Y_N2, const size_t frame_id);
+
+  private:
+    bool init_sectors();
+    void demodulate_sectors(const Q* Y_N1, Q* Y_N2);
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Module/Modem/Generic/Modem_generic_sector.hxx"
+#endif
+
+#endif // MODEM_GENERIC_SECTOR_HPP_
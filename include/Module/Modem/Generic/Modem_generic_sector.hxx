@@ -0,0 +1,275 @@
+#ifndef _USE_MATH_DEFINES
+#define _USE_MATH_DEFINES
+#endif
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <mipp.h>
+#include <numeric>
+#include <streampu.hpp>
+#include <string>
+#include <type_traits>
+
+#include "Module/Modem/Generic/Modem_generic_sector.hpp"
+#include "Tools/Constellation/PAM/Constellation_PAM.hpp"
+#include "Tools/Constellation/QAM/Constellation_QAM.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template<typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAXI>
+Modem_generic_sector<B, R, Q, MAX, MAXI>::Modem_generic_sector(const int N,
+                                                               const tools::Constellation<R>& _cstl,
+                                                               const bool disable_sig2)
+  : Modem_generic_fast<B, R, Q, MAX, MAXI>(N, _cstl, disable_sig2)
+  , sector_demod(false)
+  , n_dims(0)
+  , bits_per_dim(0)
+  , n_sectors(0)
+{
+    const std::string name = "Modem_generic_sector<" + this->cstl.get_name() + ">";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    this->sector_demod = std::is_floating_point<Q>::value && this->init_sectors();
+}
+
+template<typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAXI>
+Modem_generic_sector<B, R, Q, MAX, MAXI>*
+Modem_generic_sector<B, R, Q, MAX, MAXI>::clone() const
+{
+    auto m = new Modem_generic_sector(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAXI>
+bool
+Modem_generic_sector<B, R, Q, MAX, MAXI>::is_sector_demod() const
+{
+    return this->sector_demod;
+}
+
+template<typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAXI>
+bool
+Modem_generic_sector<B, R, Q, MAX, MAXI>::init_sectors()
+{
+    const auto is_pam = dynamic_cast<const tools::Constellation_PAM<R>*>(&this->cstl) != nullptr;
+    const auto is_qam = dynamic_cast<const tools::Constellation_QAM<R>*>(&this->cstl) != nullptr;
+
+    if (!is_pam && !is_qam) return false;
+    if (is_qam && this->bits_per_symbol % 2) return false;
+
+    this->n_dims = is_qam ? 2 : 1;
+    this->bits_per_dim = this->bits_per_symbol / this->n_dims;
+    this->n_sectors = 2 << this->bits_per_dim;
+
+    const auto n_levels = 1 << this->bits_per_dim;
+    this->first_level.resize(this->n_dims);
+    this->inv_half_step.resize(this->n_dims);
+    this->coef_a.resize(this->n_dims * this->n_sectors * this->bits_per_dim);
+    this->coef_c.resize(this->n_dims * this->n_sectors * this->bits_per_dim);
+
+    std::vector<R> levels(n_levels);
+    std::vector<int> order(n_levels);
+    for (auto d = 0; d < this->n_dims; d++)
+    {
+        // the bits of the I part are the first bits of the symbol index and the bits of the Q part are the last ones
+        for (auto v = 0; v < n_levels; v++)
+            levels[v] = d == 0 ? this->cstl.get_real(v) : this->cstl.get_imag(v << this->bits_per_dim);
+
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&levels](const int a, const int b) { return levels[a] < levels[b]; });
+
+        const auto step = levels[order[1]] - levels[order[0]];
+        if (step <= (R)0) return false;
+        for (auto i = 1; i < n_levels; i++)
+            if (std::abs(levels[order[i]] - levels[order[i - 1]] - step) > (R)1e-3 * step) return false;
+
+        this->first_level[d] = (Q)levels[order[0]];
+        this->inv_half_step[d] = (Q)((R)2 / step);
+
+        for (auto s = 0; s < this->n_sectors; s++)
+        {
+            // the nearest level in the sector, the sectors of even index are on its left side
+            const auto o = order[s / 2];
+            const auto a_o = levels[o];
+            const auto y = a_o + (s % 2 ? (R)0.25 : (R)-0.25) * step;
+
+            for (auto b = 0; b < this->bits_per_dim; b++)
+            {
+                const auto own = (o >> b) & 1;
+
+                // the nearest level with the opposite bit is the same in all the sector
+                auto c = -1;
+                for (auto v = 0; v < n_levels; v++)
+                    if (((v >> b) & 1) != own && (c == -1 || std::abs(y - levels[v]) < std::abs(y - levels[c])))
+                        c = v;
+                const auto a_c = levels[c];
+
+                // L0 - L1 = sgn * ((y - a_c)^2 - (y - a_o)^2) = sgn * (a_c^2 - a_o^2 - 2 * y * (a_c - a_o))
+                const auto sgn = own ? (R)-1 : (R)1;
+                const auto idx = (d * this->n_sectors + s) * this->bits_per_dim + b;
+                this->coef_a[idx] = (Q)(sgn * (R)-2 * (a_c - a_o));
+                this->coef_c[idx] = (Q)(sgn * (a_c * a_c - a_o * a_o));
+            }
+        }
+    }
+
+    return true;
+}
+
+template<typename Q>
+struct demodulate_sector_SIMD
+{
+    static int compute(const Q* Y_N1,
+                       Q* Y_N2,
+                       const int n_symbs,
+                       const int n_dims,
+                       const int bits_per_dim,
+                       const int n_sectors,
+                       const std::vector<Q>& first_level,
+                       const std::vector<Q>& inv_half_step,
+                       const std::vector<Q>& coef_a,
+                       const std::vector<Q>& coef_c,
+                       const Q inv_sigma2)
+    {
+        return 0;
+    }
+};
+
+template<>
+struct demodulate_sector_SIMD<float>
+{
+    using Q = float;
+    using I = int32_t;
+    static int compute(const Q* Y_N1,
+                       Q* Y_N2,
+                       const int n_symbs,
+                       const int n_dims,
+                       const int bits_per_dim,
+                       const int n_sectors,
+                       const std::vector<Q>& first_level,
+                       const std::vector<Q>& inv_half_step,
+                       const std::vector<Q>& coef_a,
+                       const std::vector<Q>& coef_c,
+                       const Q inv_sigma2)
+    {
+        const auto size_vec_loop = (n_symbs / mipp::N<Q>()) * mipp::N<Q>();
+        const auto bps = n_dims * bits_per_dim;
+
+        const mipp::Reg<Q> reg_zero = (Q)0;
+        const mipp::Reg<Q> reg_last = (Q)(n_sectors - 1);
+        const mipp::Reg<Q> reg_inv_sigma2 = inv_sigma2;
+
+        I arr_s[mipp::N<Q>()];
+        Q arr_y[mipp::N<Q>()];
+        Q arr_a[mipp::N<Q>()];
+        Q arr_c[mipp::N<Q>()];
+        Q arr_l[mipp::N<Q>()];
+
+        for (auto k = 0; k < size_vec_loop; k += mipp::N<Q>()) // loop upon the symbols
+            for (auto d = 0; d < n_dims; d++)
+            {
+                for (auto i = 0; i < mipp::N<Q>(); i++)
+                    arr_y[i] = Y_N1[(k + i) * n_dims + d];
+                const mipp::Reg<Q> reg_y = arr_y;
+
+                // sector = floor((y - first_level) / half_step) + 1 saturated in [0, n_sectors - 1], the rounding
+                // of 'u' is the floor of 'u + 0.5' and the ties are on the sector bounds where both sectors give the
+                // same LLRs
+                const mipp::Reg<Q> reg_first = first_level[d];
+                const mipp::Reg<Q> reg_inv_half_step = inv_half_step[d];
+                auto reg_u = (reg_y - reg_first) * reg_inv_half_step + (Q)0.5;
+                reg_u = mipp::min(mipp::max(reg_u, reg_zero), reg_last);
+                const auto reg_s = mipp::cvt<Q, I>(mipp::round(reg_u));
+                reg_s.store(arr_s);
+
+                for (auto b = 0; b < bits_per_dim; b++)
+                {
+                    for (auto i = 0; i < mipp::N<Q>(); i++)
+                    {
+                        const auto idx = (d * n_sectors + arr_s[i]) * bits_per_dim + b;
+                        arr_a[i] = coef_a[idx];
+                        arr_c[i] = coef_c[idx];
+                    }
+                    const mipp::Reg<Q> reg_a = arr_a;
+                    const mipp::Reg<Q> reg_c = arr_c;
+
+                    const auto reg_l = mipp::fmadd(reg_a, reg_y, reg_c) * reg_inv_sigma2;
+                    reg_l.store(arr_l);
+
+                    for (auto i = 0; i < mipp::N<Q>(); i++)
+                        Y_N2[(k + i) * bps + d * bits_per_dim + b] = arr_l[i];
+                }
+            }
+
+        return size_vec_loop;
+    }
+};
+
+template<typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAXI>
+void
+Modem_generic_sector<B, R, Q, MAX, MAXI>::demodulate_sectors(const Q* Y_N1, Q* Y_N2)
+{
+    if (!std::is_same<R, Q>::value)
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'R' and 'Q' have to be the same.");
+
+    // the SIMD kernel processes only the symbols with all their bits in the frame
+    const auto n_symbs = (this->N + this->bits_per_symbol - 1) / this->bits_per_symbol;
+    const auto n_full_symbs = this->N / this->bits_per_symbol;
+
+    const auto size_vec_loop = demodulate_sector_SIMD<Q>::compute(Y_N1,
+                                                                  Y_N2,
+                                                                  n_full_symbs,
+                                                                  this->n_dims,
+                                                                  this->bits_per_dim,
+                                                                  this->n_sectors,
+                                                                  this->first_level,
+                                                                  this->inv_half_step,
+                                                                  this->coef_a,
+                                                                  this->coef_c,
+                                                                  (Q)this->inv_sigma2);
+
+    for (auto k = size_vec_loop; k < n_symbs; k++) // loop upon the symbols
+        for (auto d = 0; d < this->n_dims; d++)
+        {
+            const auto y = Y_N1[k * this->n_dims + d];
+
+            auto s = (int)std::floor((y - this->first_level[d]) * this->inv_half_step[d]) + 1;
+            s = std::min(std::max(s, 0), this->n_sectors - 1);
+
+            for (auto b = 0; b < this->bits_per_dim; b++)
+            {
+                const auto n = k * this->bits_per_symbol + d * this->bits_per_dim + b;
+                if (n >= this->N) break;
+
+                const auto idx = (d * this->n_sectors + s) * this->bits_per_dim + b;
+                Y_N2[n] = (this->coef_a[idx] * y + this->coef_c[idx]) * (Q)this->inv_sigma2;
+            }
+        }
+}
+
+template<typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAXI>
+void
+Modem_generic_sector<B, R, Q, MAX, MAXI>::_demodulate_complex(const Q* Y_N1, Q* Y_N2, const size_t frame_id)
+{
+    if (this->sector_demod)
+        this->demodulate_sectors(Y_N1, Y_N2);
+    else
+        Modem_generic_fast<B, R, Q, MAX, MAXI>::_demodulate_complex(Y_N1, Y_N2, frame_id);
+}
+
+template<typename B, typename R, typename Q, tools::proto_max<Q> MAX, tools::proto_max_i<Q> MAXI>
+void
+Modem_generic_sector<B, R, Q, MAX, MAXI>::_demodulate_real(const Q* Y_N1, Q* Y_N2, const size_t frame_id)
+{
+    if (this->sector_demod)
+        this->demodulate_sectors(Y_N1, Y_N2);
+    else
+        Modem_generic_fast<B, R, Q, MAX, MAXI>::_demodulate_real(Y_N1, Y_N2, frame_id);
+}
+}
+}
@@ -23,13 +23,16 @@ namespace module
 template<typename B = int, typename R = float, typename Q = R, tools::proto_psi<Q> PSI = tools::psi_0>
 class Modem_SCMA : public Modem<B, R, Q>
 {
-  private:
+  protected:
     const tools::Codebook<R> CB;
 
+  private:
     tools::Vector_4D<Q> arr_phi;
     tools::Vector_3D<Q> msg_user_to_resources;
     tools::Vector_3D<Q> msg_resource_to_users;
     tools::Vector_2D<Q> guess;
+
+  protected:
     const bool disable_sig2;
     R n0; // 1 / n0 = 179.856115108
     const int n_ite;
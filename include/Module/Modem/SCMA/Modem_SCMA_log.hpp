@@ -0,0 +1,76 @@
+/*!
+ * \file
+ * \brief Class module::Modem_SCMA_log.
+ */
+#ifndef MODEM_SCMA_LOG_HPP_
+#define MODEM_SCMA_LOG_HPP_
+
+#include <complex>
+#include <mipp.h>
+#include <string>
+#include <vector>
+
+#include "Module/Modem/SCMA/Modem_SCMA.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Modem_SCMA_log
+ *
+ * \brief SCMA modem with a log-domain max-log Message Passing Algorithm (MPA) detector.
+ *
+ * The superpositions of the codewords of the users sharing a resource are computed once from the codebook. For each
+ * received symbol the detector computes the distances to all the superpositions and runs the max-log MPA: the
+ * products and the sums of the probability domain MPA (c.f. Modem_SCMA) become sums and max. The symbols are
+ * processed by packs of 'mipp::N<M>()', one symbol per SIMD lane.
+ *
+ * \tparam M: type of the messages, 'float' or 'int16_t' (fixed-point: the metrics are quantized with 3 fractional
+ *            bits and the additions saturate).
+ */
+template<typename B = int, typename R = float, typename Q = R, typename M = float>
+class Modem_SCMA_log : public Modem_SCMA<B, R, Q>
+{
+  private:
+    const int n_cw;    // number of codewords in the codebook of a user
+    const int bpc;     // number of bits per codeword
+    const int n_res;   // number of resources
+    const int n_users; // number of users
+    const int df;      // number of users per resource
+    const int dv;      // number of resources per user
+    const int n_combs; // number of combinations of the codewords of the users sharing a resource (n_cw^df)
+
+    std::vector<int> comb_cw;              // codeword of the 's'-th user of the combination 'c': [c * df + s]
+    std::vector<int> res_slot;             // position of 're' in the resources of its 's'-th user: [re * df + s]
+    std::vector<int> user_slot;            // position of 'u' in the users of its 'r'-th resource: [u * dv + r]
+    std::vector<std::complex<R>> superpos; // sum of the codewords of a combination: [re * n_combs + c]
+    std::vector<std::complex<R>> gains;    // channel gains of the users of a resource
+
+    mipp::vector<M> metric;  // [(re * n_combs + c) * n_lanes + lane]
+    mipp::vector<M> msg_u2r; // user to resource messages: [((u * dv + r) * n_cw + i) * n_lanes + lane]
+    mipp::vector<M> msg_r2u; // resource to user messages: [((re * df + s) * n_cw + i) * n_lanes + lane]
+    mipp::vector<M> guess;   // [(u * n_cw + i) * n_lanes + lane]
+
+  public:
+    Modem_SCMA_log(const int N, const std::string& codebook_path, const bool disable_sig2 = false, const int n_ite = 1);
+    virtual ~Modem_SCMA_log() = default;
+
+    virtual Modem_SCMA_log<B, R, Q, M>* clone() const;
+
+  protected:
+    virtual void _demodulate(const float* CP, const Q* Y_N1, Q* Y_N2, const size_t frame_id);
+    virtual void _demodulate_wg(const float* CP, const R* H_N, const Q* Y_N1, Q* Y_N2, const size_t frame_id);
+
+  private:
+    void compute_metrics(const Q* Y_N1, const R* H_N, const int batch);
+    void demodulate_batches(Q* Y_N2, const int batch);
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Module/Modem/SCMA/Modem_SCMA_log.hxx"
+#endif
+
+#endif /* MODEM_SCMA_LOG_HPP_ */
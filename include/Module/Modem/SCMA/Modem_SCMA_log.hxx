@@ -0,0 +1,303 @@
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+#include <type_traits>
+
+#include "Module/Modem/SCMA/Modem_SCMA_log.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template<typename M>
+struct SCMA_log_msg
+{
+    static M quantize(const float v) { return (M)v; }
+    static float dequantize(const M v) { return (float)v; }
+    static M min() { return -std::numeric_limits<M>::max(); }
+};
+
+template<>
+struct SCMA_log_msg<int16_t>
+{
+    static constexpr int n_frac_bits = 3;
+    static int16_t quantize(const float v)
+    {
+        const auto q = std::round(v * (float)(1 << n_frac_bits));
+        return (int16_t)std::min(std::max(q, (float)min()), (float)std::numeric_limits<int16_t>::max());
+    }
+    static float dequantize(const int16_t v) { return (float)v / (float)(1 << n_frac_bits); }
+    static int16_t min() { return -std::numeric_limits<int16_t>::max(); }
+};
+
+template<typename B, typename R, typename Q, typename M>
+Modem_SCMA_log<B, R, Q, M>::Modem_SCMA_log(const int N,
+                                           const std::string& codebook_path,
+                                           const bool disable_sig2,
+                                           const int n_ite)
+  : Modem_SCMA<B, R, Q>(N, codebook_path, disable_sig2, n_ite)
+  , n_cw(this->CB.get_codebook_size())
+  , bpc((int)std::log2(this->CB.get_codebook_size()))
+  , n_res(this->CB.get_number_of_resources())
+  , n_users(this->CB.get_number_of_users())
+  , df(this->CB.get_number_of_users_per_resource())
+  , dv(this->CB.get_number_of_resources_per_user())
+  , n_combs((int)std::pow(this->CB.get_codebook_size(), this->CB.get_number_of_users_per_resource()))
+  , comb_cw(n_combs * df)
+  , res_slot(n_res * df)
+  , user_slot(n_users * dv)
+  , superpos(n_res * n_combs)
+  , gains(df)
+  , metric(n_res * n_combs * mipp::N<M>())
+  , msg_u2r(n_users * dv * n_cw * mipp::N<M>())
+  , msg_r2u(n_res * df * n_cw * mipp::N<M>())
+  , guess(n_users * n_cw * mipp::N<M>())
+{
+    const std::string name = "Modem_SCMA_log";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    if ((1 << bpc) != n_cw)
+    {
+        std::stringstream message;
+        message << "'n_cw' has to be a power of 2 ('n_cw' = " << n_cw << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    for (auto c = 0; c < n_combs; c++)
+        for (auto s = 0, cw = c; s < df; s++, cw /= n_cw)
+            comb_cw[c * df + s] = cw % n_cw;
+
+    for (auto re = 0; re < n_res; re++)
+        for (auto s = 0; s < df; s++)
+        {
+            const auto u = this->CB.get_resource_to_user(re, s);
+            for (auto r = 0; r < dv; r++)
+                if (this->CB.get_user_to_resource(u, r) == re) res_slot[re * df + s] = r;
+        }
+
+    for (auto u = 0; u < n_users; u++)
+        for (auto r = 0; r < dv; r++)
+        {
+            const auto re = this->CB.get_user_to_resource(u, r);
+            for (auto s = 0; s < df; s++)
+                if (this->CB.get_resource_to_user(re, s) == u) user_slot[u * dv + r] = s;
+        }
+
+    for (auto re = 0; re < n_res; re++)
+        for (auto c = 0; c < n_combs; c++)
+        {
+            std::complex<R> sum = (R)0;
+            for (auto s = 0; s < df; s++)
+                sum += this->CB(this->CB.get_resource_to_user(re, s), re, comb_cw[c * df + s]);
+            superpos[re * n_combs + c] = sum;
+        }
+}
+
+template<typename B, typename R, typename Q, typename M>
+Modem_SCMA_log<B, R, Q, M>*
+Modem_SCMA_log<B, R, Q, M>::clone() const
+{
+    auto m = new Modem_SCMA_log(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R, typename Q, typename M>
+void
+Modem_SCMA_log<B, R, Q, M>::_demodulate(const float* CP, const Q* Y_N1, Q* Y_N2, const size_t frame_id)
+{
+    this->_demodulate_wg(CP, nullptr, Y_N1, Y_N2, frame_id);
+}
+
+template<typename B, typename R, typename Q, typename M>
+void
+Modem_SCMA_log<B, R, Q, M>::_demodulate_wg(const float* CP,
+                                           const R* H_N,
+                                           const Q* Y_N1,
+                                           Q* Y_N2,
+                                           const size_t frame_id)
+{
+    if (!std::is_same<R, Q>::value)
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'R' and 'Q' have to be the same.");
+
+    if (!std::is_floating_point<Q>::value)
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, "Type 'Q' has to be float or double.");
+
+    if (*CP != this->last_channel_param && !this->disable_sig2) this->n0 = ((R)4.0 * *CP * *CP);
+
+    const auto n_batches = (this->N + this->bpc - 1) / this->bpc;
+    for (auto batch = 0; batch < n_batches; batch += mipp::N<M>())
+    {
+        this->compute_metrics(Y_N1, H_N, batch);
+        this->demodulate_batches(Y_N2, batch);
+    }
+}
+
+template<typename B, typename R, typename Q, typename M>
+void
+Modem_SCMA_log<B, R, Q, M>::compute_metrics(const Q* Y_N1, const R* H_N, const int batch)
+{
+    constexpr int n_lanes = mipp::N<M>();
+    const auto n_batches = (this->N + this->bpc - 1) / this->bpc;
+    const auto n_real = this->CB.get_number_of_real_symbols();
+    const auto inv_n0 = (R)1 / this->n0;
+
+    for (auto l = 0; l < n_lanes; l++)
+    {
+        // the lanes after the last batch are computed on a null signal and their LLRs are dropped
+        const auto b = batch + l;
+        const auto valid = b < n_batches;
+
+        for (auto re = 0; re < this->n_res; re++)
+        {
+            const auto y = valid ? std::complex<R>((R)Y_N1[b * n_real + 2 * re], (R)Y_N1[b * n_real + 2 * re + 1])
+                                 : std::complex<R>((R)0, (R)0);
+
+            if (H_N == nullptr || !valid)
+            {
+                for (auto c = 0; c < this->n_combs; c++)
+                {
+                    const auto d = y - this->superpos[re * this->n_combs + c];
+                    this->metric[(re * this->n_combs + c) * n_lanes + l] =
+                      SCMA_log_msg<M>::quantize((float)(-std::norm(d) * inv_n0));
+                }
+            }
+            else
+            {
+                // the channel gains are different for each user so the superpositions have to be recomputed
+                for (auto s = 0; s < this->df; s++)
+                {
+                    const auto off = this->CB.get_resource_to_user(re, s) * this->N_mod + n_real * b + 2 * re;
+                    this->gains[s] = std::complex<R>(H_N[off], H_N[off + 1]);
+                }
+
+                for (auto c = 0; c < this->n_combs; c++)
+                {
+                    auto d = y;
+                    for (auto s = 0; s < this->df; s++)
+                    {
+                        const auto u = this->CB.get_resource_to_user(re, s);
+                        d -= this->gains[s] * this->CB(u, re, this->comb_cw[c * this->df + s]);
+                    }
+                    this->metric[(re * this->n_combs + c) * n_lanes + l] =
+                      SCMA_log_msg<M>::quantize((float)(-std::norm(d) * inv_n0));
+                }
+            }
+        }
+    }
+}
+
+template<typename B, typename R, typename Q, typename M>
+void
+Modem_SCMA_log<B, R, Q, M>::demodulate_batches(Q* Y_N2, const int batch)
+{
+    constexpr int n_lanes = mipp::N<M>();
+    const auto n_batches = (this->N + this->bpc - 1) / this->bpc;
+    const mipp::Reg<M> r_min = SCMA_log_msg<M>::min();
+
+    // the codewords are equiprobable at the beginning
+    std::fill(this->msg_u2r.begin(), this->msg_u2r.end(), (M)0);
+
+    for (auto ite = 0; ite < this->n_ite; ite++)
+    {
+        // resource to user messages: max over the combinations of the metric plus the messages of the other users
+        for (auto re = 0; re < this->n_res; re++)
+        {
+            for (auto s = 0; s < this->df; s++)
+                for (auto i = 0; i < this->n_cw; i++)
+                    r_min.store(&this->msg_r2u[((re * this->df + s) * this->n_cw + i) * n_lanes]);
+
+            for (auto c = 0; c < this->n_combs; c++)
+            {
+                const auto r_metric = mipp::Reg<M>(&this->metric[(re * this->n_combs + c) * n_lanes]);
+                for (auto s = 0; s < this->df; s++)
+                {
+                    auto r_acc = r_metric;
+                    for (auto t = 0; t < this->df; t++)
+                        if (t != s)
+                        {
+                            const auto u = this->CB.get_resource_to_user(re, t);
+                            const auto r = this->res_slot[re * this->df + t];
+                            const auto cw = this->comb_cw[c * this->df + t];
+                            r_acc += mipp::Reg<M>(&this->msg_u2r[((u * this->dv + r) * this->n_cw + cw) * n_lanes]);
+                        }
+
+                    const auto i = this->comb_cw[c * this->df + s];
+                    auto* msg = &this->msg_r2u[((re * this->df + s) * this->n_cw + i) * n_lanes];
+                    mipp::max(mipp::Reg<M>(msg), r_acc).store(msg);
+                }
+            }
+        }
+
+        // user to resource messages: sum of the messages of the other resources, normalized by the most probable
+        // codeword to keep the dynamic small (required in fixed-point)
+        for (auto u = 0; u < this->n_users; u++)
+            for (auto r = 0; r < this->dv; r++)
+            {
+                auto* msg = &this->msg_u2r[(u * this->dv + r) * this->n_cw * n_lanes];
+                auto r_max = r_min;
+                for (auto i = 0; i < this->n_cw; i++)
+                {
+                    mipp::Reg<M> r_acc = (M)0;
+                    for (auto r2 = 0; r2 < this->dv; r2++)
+                        if (r2 != r)
+                        {
+                            const auto re = this->CB.get_user_to_resource(u, r2);
+                            const auto s = this->user_slot[u * this->dv + r2];
+                            r_acc += mipp::Reg<M>(&this->msg_r2u[((re * this->df + s) * this->n_cw + i) * n_lanes]);
+                        }
+                    r_acc.store(&msg[i * n_lanes]);
+                    r_max = mipp::max(r_max, r_acc);
+                }
+                for (auto i = 0; i < this->n_cw; i++)
+                    (mipp::Reg<M>(&msg[i * n_lanes]) - r_max).store(&msg[i * n_lanes]);
+            }
+    }
+
+    // guess at each user and LLRs computation
+    M arr_llr[n_lanes];
+    for (auto u = 0; u < this->n_users; u++)
+    {
+        for (auto i = 0; i < this->n_cw; i++)
+        {
+            mipp::Reg<M> r_acc = (M)0;
+            for (auto r = 0; r < this->dv; r++)
+            {
+                const auto re = this->CB.get_user_to_resource(u, r);
+                const auto s = this->user_slot[u * this->dv + r];
+                r_acc += mipp::Reg<M>(&this->msg_r2u[((re * this->df + s) * this->n_cw + i) * n_lanes]);
+            }
+            r_acc.store(&this->guess[(u * this->n_cw + i) * n_lanes]);
+        }
+
+        for (auto b = 0; b < this->bpc; b++)
+        {
+            auto r_max0 = r_min;
+            auto r_max1 = r_min;
+            for (auto i = 0; i < this->n_cw; i++)
+            {
+                const auto r_guess = mipp::Reg<M>(&this->guess[(u * this->n_cw + i) * n_lanes]);
+                if ((i >> b) & 1)
+                    r_max1 = mipp::max(r_max1, r_guess);
+                else
+                    r_max0 = mipp::max(r_max0, r_guess);
+            }
+            (r_max0 - r_max1).store(arr_llr);
+
+            for (auto l = 0; l < n_lanes && batch + l < n_batches; l++)
+            {
+                const auto n = (batch + l) * this->bpc + b;
+                if (n < this->N) Y_N2[u * this->N + n] = (Q)SCMA_log_msg<M>::dequantize(arr_llr[l]);
+            }
+        }
+    }
+}
+}
+}
@@ -7,6 +7,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <iostream>
 #include <memory>
 #include <vector>
 
@@ -26,6 +27,8 @@ class Monitor_BFER : public Monitor
     inline spu::runtime::Task& operator[](const mnt::tsk t);
     inline spu::runtime::Socket& operator[](const mnt::sck::check_errors s);
     inline spu::runtime::Socket& operator[](const mnt::sck::check_errors2 s);
+    inline spu::runtime::Socket& operator[](const mnt::sck::check_errors_is s);
+    inline spu::runtime::Socket& operator[](const mnt::sck::check_errors_packed s);
 
   protected:
     struct Attributes
@@ -33,6 +36,9 @@ class Monitor_BFER : public Monitor
         unsigned long long n_fra; // the number of checked frames
         unsigned long long n_be;  // the number of wrong bits
         unsigned long long n_fe;  // the number of wrong frames
+        double w_be;              // the sum of the importance sampling weights of the wrong bits
+        double w_fe;              // the sum of the importance sampling weights of the wrong frames
+        double w2_fe;             // the sum of the squared importance sampling weights of the wrong frames
 
         Attributes();
         void reset();
@@ -47,6 +53,8 @@ class Monitor_BFER : public Monitor
       count_unknown_values; // take into account or not the unknown values as wrong values in the checked frames
     bool no_is_done;        // if set to true, is_done() method always return false
 
+    const bool importance_sampling; // weight the errors with the likelihood ratios given to 'check_errors_is'
+
     Attributes vals;
     tools::Histogram<int> err_hist; // the error histogram record
     bool err_hist_activated;
@@ -59,7 +67,8 @@ class Monitor_BFER : public Monitor
     Monitor_BFER(const int K,
                  const unsigned max_fe,
                  const unsigned max_n_frames = 0,
-                 const bool count_unknown_values = false);
+                 const bool count_unknown_values = false,
+                 const bool importance_sampling = false);
 
     virtual ~Monitor_BFER() = default;
 
@@ -105,12 +114,50 @@ class Monitor_BFER : public Monitor
                       const int frame_id = -1,
                       const bool managed_memory = true);
 
+    /*!
+     * \brief Compares two messages and counts the frame and bit errors weighted by the importance sampling weights.
+     *
+     * \param U:  the original message (from the Source or the CRC).
+     * \param V:  the decoded message (from the Decoder).
+     * \param LW: the log-likelihood ratio of each frame (from the Channel 'add_noise_is' task).
+     */
+    template<class A = std::allocator<B>>
+    int check_errors_is(const std::vector<B, A>& U,
+                        const std::vector<B, A>& V,
+                        const std::vector<double>& LW,
+                        const int frame_id = -1,
+                        const bool managed_memory = true);
+
+    int check_errors_is(const B* U,
+                        const B* V,
+                        const double* LW,
+                        const int frame_id = -1,
+                        const bool managed_memory = true);
+
+    /*!
+     * \brief Compares two messages of packed bits and counts the number of frame errors and bit errors.
+     *
+     * The messages are stored in 'tools::packed_size<B>(K)' elements per frame (see Tools/Perf/common/bit_packing.h),
+     * the unknown values cannot be represented and are not counted.
+     *
+     * \param U: the original packed message (from the Source or the CRC).
+     * \param V: the decoded packed message (from the Decoder).
+     */
+    template<class A = std::allocator<B>>
+    int check_errors_packed(const std::vector<B, A>& U,
+                            const std::vector<B, A>& V,
+                            const int frame_id = -1,
+                            const bool managed_memory = true);
+
+    int check_errors_packed(const B* U, const B* V, const int frame_id = -1, const bool managed_memory = true);
+
     bool fe_limit_achieved() const;
     bool frame_limit_achieved() const;
     virtual bool is_done() const;
 
     int get_K() const;
     bool get_count_unknown_values() const;
+    bool is_importance_sampling() const;
     unsigned get_max_fe() const;
     unsigned get_max_n_frames() const;
     unsigned long long get_n_analyzed_fra() const;
@@ -118,6 +165,7 @@ class Monitor_BFER : public Monitor
     unsigned long long get_n_be() const;
     float get_fer() const;
     float get_ber() const;
+    double get_fer_stddev() const; // standard deviation of the FER estimator (importance sampling only)
 
     const tools::Histogram<int>& get_err_hist() const;
     void activate_err_histogram(bool val);
@@ -147,6 +195,20 @@ class Monitor_BFER : public Monitor
 
     void disable_is_done(const bool no_is_done);
 
+    /*!
+     * \brief Writes the counters and the error histogram in a text stream (used by the simulation checkpoints).
+     *
+     * \param stream: the output stream.
+     */
+    void save_state(std::ostream& stream) const;
+
+    /*!
+     * \brief Adds the counters and the error histogram read from a text stream written by 'save_state'.
+     *
+     * \param stream: the input stream.
+     */
+    void load_state(std::istream& stream);
+
   protected:
     const Attributes& get_attributes() const;
 
@@ -161,7 +223,16 @@ class Monitor_BFER : public Monitor
                                float* FER,
                                const size_t frame_id);
 
+    virtual int _check_errors_is(const B* U, const B* V, const double* LW, const size_t frame_id);
+
+    virtual int _check_errors_packed(const B* U, const B* V, const size_t frame_id);
+
     virtual int __check_errors(const B* U, const B* V, const size_t frame_id);
+
+    virtual int __check_errors_packed(const B* U, const B* V, const size_t frame_id);
+
+  private:
+    void add_errors(const int bit_errors_count, const size_t frame_id);
 };
 }
 }
@@ -29,6 +29,20 @@ Monitor_BFER<B>::operator[](const mnt::sck::check_errors2 s)
     return spu::module::Module::operator[]((size_t)mnt::tsk::check_errors2)[(size_t)s];
 }
 
+template<typename B>
+spu::runtime::Socket&
+Monitor_BFER<B>::operator[](const mnt::sck::check_errors_is s)
+{
+    return spu::module::Module::operator[]((size_t)mnt::tsk::check_errors_is)[(size_t)s];
+}
+
+template<typename B>
+spu::runtime::Socket&
+Monitor_BFER<B>::operator[](const mnt::sck::check_errors_packed s)
+{
+    return spu::module::Module::operator[]((size_t)mnt::tsk::check_errors_packed)[(size_t)s];
+}
+
 template<typename B>
 template<class A>
 int
@@ -68,5 +82,37 @@ Monitor_BFER<B>::check_errors2(const std::vector<B, A>& U,
 
     return status[0];
 }
+
+template<typename B>
+template<class A>
+int
+Monitor_BFER<B>::check_errors_is(const std::vector<B, A>& U,
+                                 const std::vector<B, A>& V,
+                                 const std::vector<double>& LW,
+                                 const int frame_id,
+                                 const bool managed_memory)
+{
+    (*this)[mnt::sck::check_errors_is::U].bind(U);
+    (*this)[mnt::sck::check_errors_is::V].bind(V);
+    (*this)[mnt::sck::check_errors_is::LW].bind(LW);
+    const auto& status = (*this)[mnt::tsk::check_errors_is].exec(frame_id, managed_memory);
+
+    return status[0];
+}
+
+template<typename B>
+template<class A>
+int
+Monitor_BFER<B>::check_errors_packed(const std::vector<B, A>& U,
+                                     const std::vector<B, A>& V,
+                                     const int frame_id,
+                                     const bool managed_memory)
+{
+    (*this)[mnt::sck::check_errors_packed::U].bind(U);
+    (*this)[mnt::sck::check_errors_packed::V].bind(V);
+    const auto& status = (*this)[mnt::tsk::check_errors_packed].exec(frame_id, managed_memory);
+
+    return status[0];
+}
 }
 }
@@ -0,0 +1,77 @@
+/*!
+ * \file
+ * \brief Class module::Monitor_latency.
+ */
+#ifndef MONITOR_LATENCY_HPP_
+#define MONITOR_LATENCY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Module/Monitor/Monitor.hpp"
+#include "Tools/Algo/Histogram.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+
+/*!
+ * \class Monitor_latency
+ *
+ * \brief Records the latency of the frames between two points of a pipeline.
+ *
+ * The 'stamp' task writes the current time of each frame in the 'TS' socket. The 'measure' task records the time
+ * elapsed since the 'TS_in' stamp and writes a new stamp in the 'TS_out' socket for the next measure point. The
+ * latencies are recorded in microseconds.
+ */
+class Monitor_latency : public Monitor
+{
+  public:
+    inline spu::runtime::Task& operator[](const mnt::tsk t);
+    inline spu::runtime::Socket& operator[](const mnt::sck::stamp s);
+    inline spu::runtime::Socket& operator[](const mnt::sck::measure s);
+
+  private:
+    const size_t stage_id;          // the pipeline stage measured by this monitor
+    tools::Histogram<int> lat_hist; // the latencies record (in microseconds)
+
+  public:
+    explicit Monitor_latency(const size_t stage_id = 0);
+
+    virtual ~Monitor_latency() = default;
+
+    virtual Monitor_latency* clone() const;
+
+    size_t get_stage_id() const;
+    size_t get_n_values() const;
+
+    /*!
+     * \brief Gets a percentile of the recorded latencies.
+     *
+     * \param p: the percentile in [0, 100].
+     *
+     * \return the latency in microseconds (0 if no latency has been recorded).
+     */
+    int get_percentile(const double p) const;
+
+    const tools::Histogram<int>& get_lat_hist() const;
+
+    virtual bool is_done() const;
+
+    virtual void reset();
+
+    virtual void collect(const Monitor_latency& m);
+
+  protected:
+    virtual int _stamp(int64_t* TS, const size_t frame_id);
+    virtual int _measure(const int64_t* TS_in, int64_t* TS_out, const size_t frame_id);
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Module/Monitor/Latency/Monitor_latency.hxx"
+#endif
+
+#endif /* MONITOR_LATENCY_HPP_ */
@@ -0,0 +1,26 @@
+#include "Module/Monitor/Latency/Monitor_latency.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+
+spu::runtime::Task&
+Monitor_latency::operator[](const mnt::tsk t)
+{
+    return spu::module::Module::operator[]((size_t)t);
+}
+
+spu::runtime::Socket&
+Monitor_latency::operator[](const mnt::sck::stamp s)
+{
+    return spu::module::Module::operator[]((size_t)mnt::tsk::stamp)[(size_t)s];
+}
+
+spu::runtime::Socket&
+Monitor_latency::operator[](const mnt::sck::measure s)
+{
+    return spu::module::Module::operator[]((size_t)mnt::tsk::measure)[(size_t)s];
+}
+}
+}
@@ -21,6 +21,10 @@ enum class tsk : size_t
     check_errors2,
     get_mutual_info,
     check_mutual_info,
+    check_errors_is,
+    stamp,
+    measure,
+    check_errors_packed,
     SIZE
 };
 
@@ -43,6 +47,30 @@ enum class check_errors2 : size_t
     FER,
     status
 };
+enum class check_errors_is : size_t
+{
+    U,
+    V,
+    LW,
+    status
+};
+enum class check_errors_packed : size_t
+{
+    U,
+    V,
+    status
+};
+enum class stamp : size_t
+{
+    TS,
+    status
+};
+enum class measure : size_t
+{
+    TS_in,
+    TS_out,
+    status
+};
 enum class get_mutual_info : size_t
 {
     X,
@@ -0,0 +1,118 @@
+/*!
+ * \file
+ * \brief Class module::Packer.
+ */
+#ifndef PACKER_HPP_
+#define PACKER_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <streampu.hpp>
+#include <vector>
+
+namespace aff3ct
+{
+namespace module
+{
+namespace pkr
+{
+enum class tsk : size_t
+{
+    pack,
+    unpack,
+    SIZE
+};
+
+namespace sck
+{
+enum class pack : size_t
+{
+    in,
+    out,
+    status
+};
+enum class unpack : size_t
+{
+    in,
+    out,
+    status
+};
+}
+}
+
+/*!
+ * \class Packer
+ *
+ * \brief Converts frames of bits between the one bit per element and the packed representations.
+ *
+ * A packed frame of 'size' bits is stored in 'tools::packed_size<B>(size)' elements (see
+ * Tools/Perf/common/bit_packing.h). The packer connects the packed tasks (source, CRC, encoder and BFER monitor) to
+ * the modules which only process one bit per element (puncturer, modem and decoder).
+ *
+ * \tparam B: type of the bits.
+ */
+template<typename B = int>
+class Packer : public spu::module::Stateful
+{
+  public:
+    inline spu::runtime::Task& operator[](const pkr::tsk t);
+    inline spu::runtime::Socket& operator[](const pkr::sck::pack s);
+    inline spu::runtime::Socket& operator[](const pkr::sck::unpack s);
+
+  protected:
+    const int size; /*!< Number of bits in one frame */
+
+  public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param size: number of bits in one frame.
+     */
+    explicit Packer(const int size);
+
+    virtual ~Packer() = default;
+
+    virtual Packer<B>* clone() const;
+
+    int get_size() const;
+
+    /*!
+     * \brief Packs the bits of a frame.
+     *
+     * \param in:  the bits, one per element ('size' elements).
+     * \param out: the packed bits ('tools::packed_size<B>(size)' elements).
+     */
+    template<class A = std::allocator<B>>
+    void pack(const std::vector<B, A>& in,
+              std::vector<B, A>& out,
+              const int frame_id = -1,
+              const bool managed_memory = true);
+
+    void pack(const B* in, B* out, const int frame_id = -1, const bool managed_memory = true);
+
+    /*!
+     * \brief Unpacks the bits of a frame.
+     *
+     * \param in:  the packed bits ('tools::packed_size<B>(size)' elements).
+     * \param out: the bits, one per element ('size' elements).
+     */
+    template<class A = std::allocator<B>>
+    void unpack(const std::vector<B, A>& in,
+                std::vector<B, A>& out,
+                const int frame_id = -1,
+                const bool managed_memory = true);
+
+    void unpack(const B* in, B* out, const int frame_id = -1, const bool managed_memory = true);
+
+  protected:
+    virtual void _pack(const B* in, B* out, const size_t frame_id);
+    virtual void _unpack(const B* in, B* out, const size_t frame_id);
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Module/Packer/Packer.hxx"
+#endif
+
+#endif /* PACKER_HPP_ */
@@ -0,0 +1,49 @@
+#include "Module/Packer/Packer.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+
+template<typename B>
+spu::runtime::Task&
+Packer<B>::operator[](const pkr::tsk t)
+{
+    return spu::module::Module::operator[]((size_t)t);
+}
+
+template<typename B>
+spu::runtime::Socket&
+Packer<B>::operator[](const pkr::sck::pack s)
+{
+    return spu::module::Module::operator[]((size_t)pkr::tsk::pack)[(size_t)s];
+}
+
+template<typename B>
+spu::runtime::Socket&
+Packer<B>::operator[](const pkr::sck::unpack s)
+{
+    return spu::module::Module::operator[]((size_t)pkr::tsk::unpack)[(size_t)s];
+}
+
+template<typename B>
+template<class A>
+void
+Packer<B>::pack(const std::vector<B, A>& in, std::vector<B, A>& out, const int frame_id, const bool managed_memory)
+{
+    (*this)[pkr::sck::pack::in].bind(in);
+    (*this)[pkr::sck::pack::out].bind(out);
+    (*this)[pkr::tsk::pack].exec(frame_id, managed_memory);
+}
+
+template<typename B>
+template<class A>
+void
+Packer<B>::unpack(const std::vector<B, A>& in, std::vector<B, A>& out, const int frame_id, const bool managed_memory)
+{
+    (*this)[pkr::sck::unpack::in].bind(in);
+    (*this)[pkr::sck::unpack::out].bind(out);
+    (*this)[pkr::tsk::unpack].exec(frame_id, managed_memory);
+}
+}
+}
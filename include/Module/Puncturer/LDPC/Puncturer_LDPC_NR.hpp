@@ -0,0 +1,58 @@
+/*!
+ * \file
+ * \brief Class module::Puncturer_LDPC_NR.
+ */
+#ifndef PUNCTURER_LDPC_NR_HPP_
+#define PUNCTURER_LDPC_NR_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include "Module/Puncturer/Puncturer.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Puncturer_LDPC_NR
+ * \brief Rate matching of the 5G NR LDPC codes (TS 38.212 section 5.4.2).
+ *
+ * The 'N' transmitted bits are read from the circular buffer (the codeword without its 2 * 'Z' first bits, limited to
+ * 'N_cb' bits) from the starting position of the redundancy version, the filler bits are skipped. When 'N' is larger
+ * than the number of bits of the circular buffer, the bits are repeated and the depuncturer accumulates their LLRs.
+ */
+template<typename B = int, typename Q = float>
+class Puncturer_LDPC_NR : public Puncturer<B, Q>
+{
+  protected:
+    const int BG;
+    const int Z;
+    const int rv;
+    const int N_cb;
+    const int k0;
+
+    std::vector<uint32_t> positions; // codeword position of each transmitted bit
+
+  public:
+    Puncturer_LDPC_NR(const int& K,
+                      const int& N,
+                      const int& N_cw,
+                      const int& BG,
+                      const int& Z,
+                      const int& rv = 0,
+                      const int& N_cb = 0);
+    virtual ~Puncturer_LDPC_NR() = default;
+
+    virtual Puncturer_LDPC_NR<B, Q>* clone() const;
+
+    int get_k0() const;
+
+  protected:
+    void _puncture(const B* X_N1, B* X_N2, const size_t frame_id) const;
+    void _depuncture(const Q* Y_N1, Q* Y_N2, const size_t frame_id) const;
+};
+}
+}
+
+#endif /* PUNCTURER_LDPC_NR_HPP_ */
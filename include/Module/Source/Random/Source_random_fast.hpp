@@ -13,23 +13,36 @@ namespace aff3ct
 {
 namespace module
 {
+/*!
+ * \class Source_random_fast
+ *
+ * \brief Generates random information bits with a vectorized Mersenne Twister.
+ *
+ * When 'packed' is true, the K bits of a frame are generated in the packed representation and the 'U_K' socket
+ * contains 'tools::packed_size<B>(K)' elements (see Tools/Perf/common/bit_packing.h).
+ */
 template<typename B = int>
 class Source_random_fast : public spu::module::Source<B>
 {
   private:
+    const int K;                           // number of information bits
+    const bool packed;                     // generate packed bits
     tools::PRNG_MT19937 mt19937;           // Mersenne Twister 19937 (scalar)
     tools::PRNG_MT19937_simd mt19937_simd; // Mersenne Twister 19937 (SIMD)
 
   public:
-    Source_random_fast(const int K, const int seed = 0);
+    Source_random_fast(const int K, const int seed = 0, const bool packed = false);
     virtual ~Source_random_fast() = default;
 
     virtual Source_random_fast<B>* clone() const;
 
     virtual void set_seed(const int seed);
 
+    bool is_packed() const;
+
   protected:
     void _generate(B* U_K, const size_t frame_id);
+    void _generate_packed(B* U_K, const size_t frame_id);
 };
 }
 }
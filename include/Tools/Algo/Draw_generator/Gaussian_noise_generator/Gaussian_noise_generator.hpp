@@ -5,6 +5,7 @@
 #ifndef GAUSSIAN_NOISE_GENERATOR_HPP_
 #define GAUSSIAN_NOISE_GENERATOR_HPP_
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -20,6 +21,7 @@ enum class Gaussian_noise_generator_implem
 {
     STD,
     FAST,
+    PHILOX,
     GSL,
     MKL
 };
@@ -28,6 +30,7 @@ enum class Gaussian_noise_generator_implem
 {
     STD,
     FAST,
+    PHILOX,
     GSL
 };
 #elif defined(AFF3CT_CHANNEL_MKL)
@@ -35,13 +38,15 @@ enum class Gaussian_noise_generator_implem
 {
     STD,
     FAST,
+    PHILOX,
     MKL
 };
 #else
 enum class Gaussian_noise_generator_implem
 {
     STD,
-    FAST
+    FAST,
+    PHILOX
 };
 #endif
 
@@ -57,6 +62,14 @@ class Gaussian_noise_generator : public Draw_generator<R>
     void generate(std::vector<R, A>& noise, const R sigma, const R mu = 0.0);
 
     virtual void generate(R* noise, const unsigned length, const R sigma, const R mu = 0.0) = 0;
+
+    /*!
+     * \brief Generates the noise of the frame 'frame_idx'.
+     *
+     * The counter-based generators draw the noise from the frame index, the other generators ignore it and draw the
+     * next numbers of their sequence.
+     */
+    virtual void generate(R* noise, const unsigned length, const R sigma, const R mu, const uint64_t frame_idx);
 };
 
 template<typename R = float>
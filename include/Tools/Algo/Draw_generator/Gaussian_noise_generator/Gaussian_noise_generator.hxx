@@ -11,5 +11,16 @@ Gaussian_noise_generator<R>::generate(std::vector<R, A>& noise, const R sigma, c
 {
     this->generate(noise.data(), (unsigned)noise.size(), sigma, mu);
 }
+
+template<typename R>
+void
+Gaussian_noise_generator<R>::generate(R* noise,
+                                      const unsigned length,
+                                      const R sigma,
+                                      const R mu,
+                                      const uint64_t /*frame_idx*/)
+{
+    this->generate(noise, length, sigma, mu);
+}
 }
 }
@@ -0,0 +1,66 @@
+/*!
+ * \file
+ * \brief Class tools::Gaussian_noise_generator_philox.
+ */
+#ifndef GAUSSIAN_NOISE_GENERATOR_PHILOX_HPP_
+#define GAUSSIAN_NOISE_GENERATOR_PHILOX_HPP_
+
+#include <cstdint>
+#include <mipp.h>
+
+#include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Gaussian_noise_generator.hpp"
+#include "Tools/Algo/PRNG/PRNG_philox.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Gaussian_noise_generator_philox
+ * \brief Gaussian noise generator based on the counter-based Philox PRNG.
+ *
+ * The i-th noise sample of the f-th frame only depends on the (seed, f, i) triplet: the generated noise does not
+ * depend on the order in which the frames are processed nor on the number of frames per call.
+ */
+template<typename R = float>
+class Gaussian_noise_generator_philox : public Gaussian_noise_generator<R>
+{
+  private:
+    tools::PRNG_philox philox;
+    uint64_t next_frame;          // frame drawn when no frame index is given
+    mipp::vector<int32_t> lanes;  // lane indexes of a SIMD register (0, 1, ..., mipp::N<int32_t>() -1)
+    mipp::vector<int32_t> words;  // Philox words, 4 arrays (structure of arrays) of 'n_blocks' words
+    mipp::vector<R> u1, u2;       // uniform numbers
+    mipp::vector<R> gcos, gsin;   // Box-Muller outputs
+
+  public:
+    explicit Gaussian_noise_generator_philox(const int seed = 0);
+    virtual ~Gaussian_noise_generator_philox() = default;
+    virtual Gaussian_noise_generator_philox<R>* clone() const;
+
+    /*!
+     * \brief Sets the key of the generator, the next frame is the frame 0.
+     */
+    virtual void set_seed(const int seed);
+
+    /*!
+     * \brief Generates the noise of the frame following the last generated one.
+     */
+    virtual void generate(R* noise, const unsigned length, const R sigma, const R mu = 0.0);
+
+    /*!
+     * \brief Generates the noise of the frame 'frame_idx'.
+     */
+    virtual void generate(R* noise, const unsigned length, const R sigma, const R mu, const uint64_t frame_idx);
+
+  private:
+    size_t draw_uniforms(const unsigned n_pairs, const uint64_t frame_idx);
+    void draw_words(const size_t n_blocks, const uint64_t frame_idx);
+};
+
+template<typename R = float>
+using Gaussian_gen_philox = Gaussian_noise_generator_philox<R>;
+}
+}
+
+#endif /* GAUSSIAN_NOISE_GENERATOR_PHILOX_HPP_ */
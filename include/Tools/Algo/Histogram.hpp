@@ -97,6 +97,8 @@ class Histogram : public spu::tools::Interface_reset
 
     inline size_t get_n_values() const;
 
+    inline const std::map<int, size_t>& get_hist() const; // the calibrated values and their number of occurrences
+
   private:
     inline int dump_all_values(std::ofstream& hist_file, R hist_min, R hist_max) const;
 
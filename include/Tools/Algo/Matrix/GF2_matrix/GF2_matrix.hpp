@@ -0,0 +1,130 @@
+/*!
+ * \file
+ * \brief Class tools::GF2_matrix.
+ */
+#ifndef GF2_MATRIX_HPP_
+#define GF2_MATRIX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "Tools/Algo/Matrix/Matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Dense binary matrix packed in 64-bit words (the bit 'c' of a row is the bit 'c % 64' of its word 'c / 64'), the
+ * unused bits of the last word of a row are always 0. The rows are accessed through a permutation so the row swaps
+ * and the row erasures do not move any word. Dedicated to the Gaussian eliminations over GF(2): a row addition is a
+ * word-wide XOR. The rows and cols degrees are not tracked.
+ */
+class GF2_matrix : public Matrix
+{
+  public:
+    using Word = uint64_t;
+    static constexpr size_t word_size = sizeof(Word) * 8;
+
+    GF2_matrix(const size_t n_rows = 0, const size_t n_cols = 1);
+
+    explicit GF2_matrix(const Sparse_matrix& matrix);
+
+    virtual ~GF2_matrix() = default;
+
+    /*
+     * Number of words per row
+     */
+    inline size_t get_n_words() const;
+
+    /*
+     * Words of the row 'row_index'
+     */
+    inline Word* get_row(const size_t row_index);
+    inline const Word* get_row(const size_t row_index) const;
+
+    /*
+     * Unchecked version of 'at'
+     */
+    inline bool get(const size_t row_index, const size_t col_index) const;
+
+    /*
+     * Unchecked inversion of the bit ('row_index';'col_index')
+     */
+    inline void flip(const size_t row_index, const size_t col_index);
+
+    /*
+     * Return the 'n_bits' (<= 64) bits of the row 'row_index' from the column 'col_index', the bit 'b' of the returned
+     * value is the column 'col_index + b', the columns out of the matrix are read as 0
+     */
+    inline Word get_bits(const size_t row_index, const size_t col_index, const size_t n_bits) const;
+
+    /*
+     * Add (XOR) the 'words' to the row 'row_index' from its word 'first_word' to the end of the row
+     */
+    inline void xor_row(const size_t row_index, const Word* words, const size_t first_word = 0);
+
+    /*
+     * Add (XOR) the row 'src_row' to the row 'dst_row' from the word 'first_word' to the end of the rows
+     */
+    inline void xor_rows(const size_t dst_row, const size_t src_row, const size_t first_word = 0);
+
+    /*
+     * Return the first column greater or equal to 'col_index' with a connection in the row 'row_index', 'n_cols' if
+     * there is none
+     */
+    inline size_t find_first(const size_t row_index, const size_t col_index = 0) const;
+
+    void swap_rows(const size_t row_index1, const size_t row_index2);
+
+    void swap_cols(const size_t col_index1, const size_t col_index2);
+
+    /*
+     * Erase the row 'row_index', the next rows are shifted up
+     */
+    void erase_row(const size_t row_index);
+
+    /*
+     * return true if there is a connection there
+     */
+    bool at(const size_t row_index, const size_t col_index) const;
+
+    void add_connection(const size_t row_index, const size_t col_index);
+
+    void rm_connection(const size_t row_index, const size_t col_index);
+
+    /*
+     * 'self_resize', 'self_transpose' and 'sort_cols_per_density' throw, the packed matrix is only a workspace for
+     * the eliminations
+     */
+    void self_resize(const size_t n_rows, const size_t n_cols, Origin o);
+    void self_transpose();
+    void sort_cols_per_density(Sort order);
+
+    /*
+     * Print the matrix in its full view with 0s and 1s.
+     * 'transpose' allow the print in its transposed view
+     */
+    void print(bool transpose = false, std::ostream& os = std::cout) const;
+
+    /*
+     * Return the sparse version of this matrix
+     */
+    Sparse_matrix to_sparse_matrix() const;
+
+  private:
+    size_t n_words;
+    std::vector<Word> words;
+    std::vector<size_t> rows; // position of the rows in 'words'
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hxx"
+#endif
+
+#endif /* GF2_MATRIX_HPP_ */
@@ -0,0 +1,92 @@
+#include "Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+inline unsigned
+gf2_ctz(const uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctzll(word);
+#else
+    unsigned n = 0;
+    while (!((word >> n) & 1))
+        n++;
+    return n;
+#endif
+}
+
+size_t
+GF2_matrix ::get_n_words() const
+{
+    return this->n_words;
+}
+
+GF2_matrix::Word*
+GF2_matrix ::get_row(const size_t row_index)
+{
+    return this->words.data() + this->rows[row_index] * this->n_words;
+}
+
+const GF2_matrix::Word*
+GF2_matrix ::get_row(const size_t row_index) const
+{
+    return this->words.data() + this->rows[row_index] * this->n_words;
+}
+
+bool
+GF2_matrix ::get(const size_t row_index, const size_t col_index) const
+{
+    return (this->get_row(row_index)[col_index / word_size] >> (col_index % word_size)) & 1;
+}
+
+void
+GF2_matrix ::flip(const size_t row_index, const size_t col_index)
+{
+    this->get_row(row_index)[col_index / word_size] ^= (Word)1 << (col_index % word_size);
+}
+
+GF2_matrix::Word
+GF2_matrix ::get_bits(const size_t row_index, const size_t col_index, const size_t n_bits) const
+{
+    const auto w = col_index / word_size;
+    const auto o = col_index % word_size;
+    if (w >= this->n_words) return 0;
+
+    const auto row = this->get_row(row_index);
+    auto bits = row[w] >> o;
+    if (o + n_bits > word_size && w + 1 < this->n_words) bits |= row[w + 1] << (word_size - o);
+
+    return n_bits < word_size ? bits & (((Word)1 << n_bits) - 1) : bits;
+}
+
+void
+GF2_matrix ::xor_row(const size_t row_index, const Word* words, const size_t first_word)
+{
+    auto row = this->get_row(row_index);
+    for (auto w = first_word; w < this->n_words; w++)
+        row[w] ^= words[w - first_word];
+}
+
+void
+GF2_matrix ::xor_rows(const size_t dst_row, const size_t src_row, const size_t first_word)
+{
+    this->xor_row(dst_row, this->get_row(src_row) + first_word, first_word);
+}
+
+size_t
+GF2_matrix ::find_first(const size_t row_index, const size_t col_index) const
+{
+    if (col_index >= this->get_n_cols()) return this->get_n_cols();
+
+    const auto row = this->get_row(row_index);
+    auto w = col_index / word_size;
+    auto word = row[w] & (~(Word)0 << (col_index % word_size));
+    while (!word && ++w < this->n_words)
+        word = row[w];
+
+    return word ? w * word_size + gf2_ctz(word) : this->get_n_cols();
+}
+}
+}
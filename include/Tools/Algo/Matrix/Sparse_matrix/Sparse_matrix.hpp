@@ -16,8 +16,12 @@ namespace aff3ct
 {
 namespace tools
 {
+class GF2_matrix;
+
 class Sparse_matrix : public Matrix
 {
+    friend class GF2_matrix;
+
   public:
     using Idx_t = uint32_t;
 
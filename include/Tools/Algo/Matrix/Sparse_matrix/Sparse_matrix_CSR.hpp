@@ -0,0 +1,124 @@
+/*!
+ * \file
+ * \brief Class tools::Sparse_matrix_CSR.
+ */
+#ifndef SPARSE_MATRIX_CSR_HPP_
+#define SPARSE_MATRIX_CSR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "Tools/Algo/Matrix/Matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Read-only compressed version of a Sparse_matrix: the connections of the rows (CSR) and of the columns (CSC) are
+ * stored in two contiguous index arrays with their offset arrays. The order of the connections is the same as in the
+ * Sparse_matrix it has been built from. Dedicated to the hot loops of the decoders: the connections can be traversed
+ * in a single streaming pass.
+ */
+class Sparse_matrix_CSR : public Matrix
+{
+  public:
+    using Idx_t = uint32_t;
+
+    /*
+     * View on the connections of one row or one column (same read interface as a 'std::vector<Idx_t>')
+     */
+    class Slice
+    {
+      private:
+        const Idx_t* first;
+        const Idx_t* last;
+
+      public:
+        Slice(const Idx_t* first, const Idx_t* last);
+
+        inline size_t size() const;
+        inline bool empty() const;
+        inline const Idx_t* data() const;
+        inline const Idx_t* begin() const;
+        inline const Idx_t* end() const;
+        inline const Idx_t& front() const;
+        inline const Idx_t& operator[](const size_t i) const;
+        const Idx_t& at(const size_t i) const;
+    };
+
+    Sparse_matrix_CSR(const size_t n_rows = 0, const size_t n_cols = 1);
+
+    explicit Sparse_matrix_CSR(const Sparse_matrix& matrix);
+
+    virtual ~Sparse_matrix_CSR() = default;
+
+    inline Slice get_cols_from_row(const size_t row_index) const;
+
+    inline Slice get_rows_from_col(const size_t col_index) const;
+
+    inline Slice operator[](const size_t col_index) const;
+
+    /*
+     * Raw CSR arrays: the columns of the row 'r' are in 'row_indices[row_offsets[r]]' to
+     * 'row_indices[row_offsets[r +1] -1]' ('row_offsets' contains 'n_rows' +1 values)
+     */
+    inline const std::vector<Idx_t>& get_row_offsets() const;
+
+    inline const std::vector<Idx_t>& get_row_indices() const;
+
+    /*
+     * Raw CSC arrays: the rows of the column 'c' are in 'col_indices[col_offsets[c]]' to
+     * 'col_indices[col_offsets[c +1] -1]' ('col_offsets' contains 'n_cols' +1 values)
+     */
+    inline const std::vector<Idx_t>& get_col_offsets() const;
+
+    inline const std::vector<Idx_t>& get_col_indices() const;
+
+    /*
+     * return true if there is a connection there
+     */
+    bool at(const size_t row_index, const size_t col_index) const;
+
+    /*
+     * The compressed matrix is read-only: 'add_connection', 'rm_connection', 'self_resize' and
+     * 'sort_cols_per_density' throw, modify the Sparse_matrix and compress it again instead
+     */
+    void add_connection(const size_t row_index, const size_t col_index);
+    void rm_connection(const size_t row_index, const size_t col_index);
+    void self_resize(const size_t n_rows, const size_t n_cols, Origin o);
+    void sort_cols_per_density(Sort order);
+
+    /*
+     * Transpose internally this matrix (swap the CSR and the CSC arrays)
+     */
+    void self_transpose();
+
+    /*
+     * Print the sparsed matrix in its full view with 0s and 1s.
+     * 'transpose' allow the print in its transposed view
+     */
+    void print(bool transpose = false, std::ostream& os = std::cout) const;
+
+    /*
+     * Return the uncompressed (modifiable) version of this matrix
+     */
+    Sparse_matrix to_sparse_matrix() const;
+
+  private:
+    std::vector<Idx_t> row_offsets;
+    std::vector<Idx_t> row_indices;
+    std::vector<Idx_t> col_offsets;
+    std::vector<Idx_t> col_indices;
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hxx"
+#endif
+
+#endif /* SPARSE_MATRIX_CSR_HPP_ */
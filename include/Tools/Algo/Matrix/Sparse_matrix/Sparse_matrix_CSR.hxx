@@ -0,0 +1,93 @@
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+size_t
+Sparse_matrix_CSR::Slice ::size() const
+{
+    return (size_t)(this->last - this->first);
+}
+
+bool
+Sparse_matrix_CSR::Slice ::empty() const
+{
+    return this->last == this->first;
+}
+
+const uint32_t*
+Sparse_matrix_CSR::Slice ::data() const
+{
+    return this->first;
+}
+
+const uint32_t*
+Sparse_matrix_CSR::Slice ::begin() const
+{
+    return this->first;
+}
+
+const uint32_t*
+Sparse_matrix_CSR::Slice ::end() const
+{
+    return this->last;
+}
+
+const uint32_t&
+Sparse_matrix_CSR::Slice ::front() const
+{
+    return *this->first;
+}
+
+const uint32_t&
+Sparse_matrix_CSR::Slice ::operator[](const size_t i) const
+{
+    return this->first[i];
+}
+
+Sparse_matrix_CSR::Slice
+Sparse_matrix_CSR ::get_cols_from_row(const size_t row_index) const
+{
+    return Slice(this->row_indices.data() + this->row_offsets[row_index],
+                 this->row_indices.data() + this->row_offsets[row_index + 1]);
+}
+
+Sparse_matrix_CSR::Slice
+Sparse_matrix_CSR ::get_rows_from_col(const size_t col_index) const
+{
+    return Slice(this->col_indices.data() + this->col_offsets[col_index],
+                 this->col_indices.data() + this->col_offsets[col_index + 1]);
+}
+
+Sparse_matrix_CSR::Slice
+Sparse_matrix_CSR ::operator[](const size_t col_index) const
+{
+    return this->get_rows_from_col(col_index);
+}
+
+const std::vector<uint32_t>&
+Sparse_matrix_CSR ::get_row_offsets() const
+{
+    return this->row_offsets;
+}
+
+const std::vector<uint32_t>&
+Sparse_matrix_CSR ::get_row_indices() const
+{
+    return this->row_indices;
+}
+
+const std::vector<uint32_t>&
+Sparse_matrix_CSR ::get_col_offsets() const
+{
+    return this->col_offsets;
+}
+
+const std::vector<uint32_t>&
+Sparse_matrix_CSR ::get_col_indices() const
+{
+    return this->col_indices;
+}
+}
+}
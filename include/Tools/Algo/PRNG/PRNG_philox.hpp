@@ -0,0 +1,63 @@
+/*!
+ * \file
+ * \brief The Philox4x32-10 counter-based pseudo-random number generator (PRNG).
+ *
+ * Philox is a counter-based PRNG: the output is a bijection of a 128-bit counter keyed by a 64-bit key. There is no
+ * internal state to update, any number of the sequence can be computed directly from its position. This makes the
+ * generated numbers independent of the order in which they are drawn (and thus of the number of threads).
+ *
+ * This implementation follows: J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw, "Parallel random numbers: as
+ * easy as 1, 2, 3", SC'11.
+ *
+ */
+
+#ifndef PRNG_PHILOX_HPP
+#define PRNG_PHILOX_HPP
+
+#include <cstdint>
+#include <mipp.h>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class PRNG_philox
+ * \brief The Philox4x32-10 counter-based pseudo-random number generator (PRNG).
+ */
+class PRNG_philox
+{
+  protected:
+    uint32_t key[2];
+
+  public:
+    explicit PRNG_philox(const uint64_t seed = 0);
+    virtual ~PRNG_philox() = default;
+
+    /*!
+     * \brief Sets the key of the PRNG.
+     *
+     * \param seed: the 64-bit key.
+     */
+    void seed(const uint64_t seed);
+
+    /*!
+     * \brief Computes the four 32-bit random words associated to a counter.
+     *
+     * \param ctr: the 128-bit counter (4 words).
+     * \param out: the 4 random words.
+     */
+    void generate(const uint32_t ctr[4], uint32_t out[4]) const;
+
+    /*!
+     * \brief Computes the four 32-bit random words associated to mipp::N<int32_t>() counters at once (one per lane).
+     *
+     * \param ctr: the 128-bit counters (4 vector registers).
+     * \param out: the 4 vector registers of random words.
+     */
+    void generate(const mipp::Reg<int32_t> ctr[4], mipp::Reg<int32_t> out[4]) const;
+};
+}
+}
+
+#endif // PRNG_PHILOX_HPP
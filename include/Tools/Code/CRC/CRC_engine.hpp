@@ -0,0 +1,72 @@
+/*!
+ * \file
+ * \brief Class tools::CRC_engine.
+ */
+#ifndef CRC_ENGINE_HPP
+#define CRC_ENGINE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class CRC_engine
+ *
+ * \brief Computes CRCs of up to 64 bits on packed data.
+ *
+ * The bits are read as in spu::tools::Bit_packer (the first bit in the LSB of the first byte) and the CRC is returned
+ * in the same order: the i-th bit of the CRC is '(crc >> i) & 1'. The CRC is computed with a null initial value and
+ * without final XOR.
+ *
+ * The CRC state can be saved and resumed at any byte boundary: 'update(update(0, A, 8 * a), B, n)' is the CRC of the
+ * message 'A' followed by 'B'. The bytes are processed by folding with carry-less multiplications when PCLMULQDQ is
+ * available at compile time, and with a slicing-by-16 lookup table otherwise (and for the short messages).
+ */
+class CRC_engine
+{
+  protected:
+    const int size;
+    const uint64_t polynomial_rev; // the polynomial (without the x^size term) with the bits in reverse order
+
+    std::vector<uint64_t> lut; // the slicing-by-16 tables (16 x 256 values)
+    uint64_t k_fold_lo;        // folding constant of the first  64 bits of a block (x^191 mod P')
+    uint64_t k_fold_hi;        // folding constant of the second 64 bits of a block (x^127 mod P')
+
+  public:
+    /*!
+     * \param polynomial: the polynomial without the x^size term (ex: 0x04C11DB7 for the CRC-32 GZIP).
+     * \param size:       the number of bits of the CRC (in [1, 64]).
+     */
+    CRC_engine(const uint64_t polynomial, const int size);
+    virtual ~CRC_engine() = default;
+
+    int get_size() const;
+
+    /*!
+     * \brief Computes the CRC of the 'n_bits' first bits of 'data'.
+     */
+    uint64_t compute(const void* data, const size_t n_bits) const;
+
+    /*!
+     * \brief Resumes a CRC computation from 'state' with the 'n_bits' first bits of 'data'.
+     *
+     * \param state:  the CRC of the previous bits (0 for a new message), their number has to be a multiple of 8.
+     * \param data:   the next bits of the message (packed).
+     * \param n_bits: the number of bits to process, when it is not a multiple of 8 the returned CRC can't be resumed.
+     *
+     * \return the CRC of the previous bits followed by the 'n_bits' bits of 'data'.
+     */
+    uint64_t update(uint64_t state, const void* data, const size_t n_bits) const;
+
+  protected:
+    uint64_t update_lut(uint64_t state, const uint8_t* data, size_t n_bytes) const;
+    uint64_t update_clmul(uint64_t state, const uint8_t* data, size_t n_bytes) const;
+};
+}
+}
+
+#endif /* CRC_ENGINE_HPP */
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "Tools/Algo/Matrix/Full_matrix/Full_matrix.hpp"
+#include "Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hpp"
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 
 namespace aff3ct
@@ -76,6 +77,15 @@ struct LDPC_matrix_handler
      */
     static void form_identity(LDPC_matrix& mat, Matrix::Origin o = Matrix::Origin::TOP_LEFT);
 
+    /*
+     * \brief Same as form_diagonal() then form_identity() from the TOP_LEFT origin on a packed matrix (same pivots,
+     *        same swapped columns and same result). The Method of the Four Russians is used: the pivots are searched
+     *        by blocks of 'k' columns, then all the other rows are reduced at once on the block with a table of the
+     *        2^k combinations of the pivot rows.
+     * \return swapped columns positions pairs. Warning, a column might be swapped several times.
+     */
+    static Positions_pair_vector form_identity_M4R(GF2_matrix& mat, const size_t k = 8);
+
     /*
      * \brief Compute a G matrix related to the given H matrix. This method favors a hallowed generator matrix build.
      *        It uses the LU decomposition. Warning do not work yet with irregular matrices.
@@ -88,7 +98,8 @@ struct LDPC_matrix_handler
 
     /*
      * \brief Compute a G matrix related to the given H matrix. This method builds a matrix by creating an identity on
-     *        the left part of H then taking the parity part to create G.
+     *        the left part of H then taking the parity part to create G. The Sparse_matrix version works on a packed
+     *        copy of H (c.f. form_identity_M4R()).
      * \return G vertical with not necessary an identity.
      * \param info_bits_pos is filled with the positions (between 0 to N-1) of the information bits in G.
      * \param H (in Horizontal way) is the parity matrix from which G is built.
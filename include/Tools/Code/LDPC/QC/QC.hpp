@@ -5,6 +5,7 @@
 #ifndef QC_HPP_
 #define QC_HPP_
 
+#include <cstdint>
 #include <iostream>
 #include <vector>
 
@@ -28,6 +29,19 @@ struct QC
      */
     static void read_matrix_size(std::istream& stream, int& H, int& N);
 
+    /*
+     * get the lifting size Z from the input stream
+     */
+    static int read_lifting_size(std::istream& stream);
+
+    /*
+     * get the base matrix of a quasi-cyclic matrix made of ZxZ circulant permutation blocks
+     * @H is the matrix in the same orientation as the one returned by 'read' (the columns are the check nodes)
+     * @Z is the lifting size
+     * return the shift values of the blocks (-1 for a null block), one row per block of Z check nodes
+     */
+    static std::vector<std::vector<int16_t>> get_base_matrix(const Sparse_matrix& H, const int Z);
+
   private:
     static Sparse_matrix _read(std::istream& stream);
 };
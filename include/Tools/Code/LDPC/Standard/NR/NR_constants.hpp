@@ -0,0 +1,78 @@
+/*!
+ * \file
+ * \brief Struct tools::nr_values.
+ *
+ * 5G NR LDPC codes as defined in the 3GPP TS 38.212 standard (multiplexing and channel coding, section 5.3.2).
+ */
+#ifndef NR_CONSTANTS_HPP_
+#define NR_CONSTANTS_HPP_
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+
+struct nr_values
+{
+    std::vector<std::vector<int16_t>> base; // shift values (V mod Z) of the base graph, -1 for a null block
+    int BG;                                 // base graph (1 or 2)
+    int Z;                                  // lifting size
+    int i_LS;                               // index of the set of the lifting size
+    int K;                                  // number of information bits (without the filler bits)
+    int K_b;                                // number of systematic columns of the base graph (22 or 10)
+    int N_b;                                // number of columns of the base graph (68 or 52)
+    int M_b;                                // number of rows of the base graph (46 or 42)
+    int N;                                  // codeword size (N_b * Z), the 2 * Z first bits are never transmitted
+};
+
+/*
+ * select the base graph from the number of information bits and the code rate (TS 38.212 section 7.2.2)
+ */
+int
+nr_select_base_graph(const int K, const float R);
+
+/*
+ * get the minimum lifting size Z such as 'K_b' * Z >= 'K' (TS 38.212 section 5.2.2)
+ * @i_LS is filled with the index of the set of the lifting size (if not nullptr)
+ */
+int
+nr_lifting_size(const int K, const int BG, int* i_LS = nullptr);
+
+/*
+ * get the codeword size (including the 2 * Z punctured systematic bits)
+ */
+int
+nr_codeword_size(const int K, const int BG);
+
+/*
+ * build the lifted base graph from the shift values of the base graph
+ * @table is one entry per non-null block with the row index 'i', the column index 'j' and the eight shift values
+ *        V_{i,j} (one per set of lifting sizes), all the non-null blocks of the base graph have to be given
+ */
+std::unique_ptr<nr_values>
+build_nr(const int K, const int BG, const std::vector<std::array<int16_t, 10>>& table);
+
+/*
+ * build the lifted base graph from the shift values of the base graph read in a file
+ * @bg_path is a file in the TS 38.212 tables 5.3.2-2/5.3.2-3 layout: one line per non-null block with the row index
+ *          'i', the column index 'j' and the eight shift values V_{i,j} (one per set of lifting sizes), all the
+ *          non-null blocks of the base graph have to be given
+ */
+std::unique_ptr<nr_values>
+build_nr(const int K, const int BG, const std::string& bg_path);
+
+tools::Sparse_matrix
+build_H(const nr_values& nr);
+
+}
+}
+
+#endif // NR_CONSTANTS_HPP_
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hpp"
 
 namespace aff3ct
 {
@@ -27,6 +28,12 @@ struct LDPC_syndrome
 
     template<typename R>
     static inline bool check_soft(const R* Y_N, const Sparse_matrix& H);
+
+    template<typename B>
+    static inline bool check_hard(const B* X_N, const Sparse_matrix_CSR& H);
+
+    template<typename R>
+    static inline bool check_soft(const R* Y_N, const Sparse_matrix_CSR& H);
 };
 }
 }
@@ -75,5 +75,67 @@ LDPC_syndrome ::check_soft(const std::vector<R>& Y_N, const Sparse_matrix& H)
     return LDPC_syndrome::check_soft<R>(Y_N.data(), H);
 }
 
+template<typename B>
+bool
+LDPC_syndrome ::check_hard(const B* X_N, const Sparse_matrix_CSR& H)
+{
+    auto syndrome = false;
+
+    // single pass on the connections of the check nodes
+    const auto* chk_offsets = H.get_col_offsets().data();
+    const auto* chk_to_var = H.get_col_indices().data();
+
+    const auto n_chk_nodes = (int)H.get_n_cols();
+    auto c = 0;
+    while (c < n_chk_nodes && !syndrome)
+    {
+        auto sign = 0;
+
+        for (auto k = chk_offsets[c]; k < chk_offsets[c + 1]; k++)
+        {
+            const auto bit = X_N[chk_to_var[k]];
+            const auto tmp_sign = bit ? -1 : 0;
+
+            sign ^= tmp_sign;
+        }
+
+        syndrome = syndrome || sign;
+        c++;
+    }
+
+    return !syndrome;
+}
+
+template<typename R>
+bool
+LDPC_syndrome ::check_soft(const R* Y_N, const Sparse_matrix_CSR& H)
+{
+    auto syndrome = false;
+
+    // single pass on the connections of the check nodes
+    const auto* chk_offsets = H.get_col_offsets().data();
+    const auto* chk_to_var = H.get_col_indices().data();
+
+    const auto n_chk_nodes = (int)H.get_n_cols();
+    auto c = 0;
+    while (c < n_chk_nodes && !syndrome)
+    {
+        auto sign = 0;
+
+        for (auto k = chk_offsets[c]; k < chk_offsets[c + 1]; k++)
+        {
+            const auto llr = Y_N[chk_to_var[k]];
+            const auto tmp_sign = (llr < 0) ? -1 : 0;
+
+            sign ^= tmp_sign;
+        }
+
+        syndrome = syndrome || sign;
+        c++;
+    }
+
+    return !syndrome;
+}
+
 }
 }
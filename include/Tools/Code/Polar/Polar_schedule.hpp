@@ -0,0 +1,89 @@
+/*!
+ * \file
+ * \brief Class tools::Polar_schedule.
+ */
+#ifndef POLAR_SCHEDULE_HPP
+#define POLAR_SCHEDULE_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+enum class polar_op_t : uint8_t
+{
+    F = 0, // f of a standard or a repetition left node
+    F0,    // f of a rate 0 left node (only the list decoders compute it)
+    G,     // g of a standard node
+    G0,    // g of a rate 0 left node
+    GR,    // g of a repetition left node
+    XO,    // xor of a standard or a repetition left node
+    XO0,   // xor of a rate 0 left node
+    H0,    // rate 0 leaf
+    H,     // rate 1 leaf
+    REP,   // repetition leaf
+    SPC    // single parity check leaf
+};
+
+struct polar_instr_t
+{
+    polar_op_t op;
+    int rev_depth; // reversed depth of the node the operation belongs to
+    int off_l;     // offset of the node in the LLRs (the root is at 0 and a child at 'off_l' + 2^'rev_depth')
+    int off_s;     // offset of the node in the partial sums
+};
+
+/*!
+ * \class Polar_schedule
+ * \brief Flattens the tree of a Pattern_polar_parser into the list of the operations of a fast systematic SC
+ *        decoding, in the order of the recursive tree walk.
+ *
+ * The schedule is compiled once per set of frozen bits, the decoders then execute it in a loop instead of walking
+ * the tree and of switching on the node types for each frame.
+ */
+class Polar_schedule
+{
+  protected:
+    int m;                                   /*!< Tree depth. */
+    std::vector<polar_instr_t> instructions; /*!< Operations in the decoding order. */
+
+  public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param polar_patterns: the parsed polar tree to flatten.
+     */
+    explicit Polar_schedule(const Pattern_polar_parser& polar_patterns);
+
+    virtual ~Polar_schedule() = default;
+
+    /*!
+     * \brief Compiles again the schedule, to call after each change of the frozen bits of the parser.
+     *
+     * \param polar_patterns: the parsed polar tree to flatten.
+     */
+    void build(const Pattern_polar_parser& polar_patterns);
+
+    inline int get_m() const;
+
+    inline const std::vector<polar_instr_t>& get_instructions() const;
+
+  private:
+    void recursive_build(const Pattern_polar_parser& polar_patterns,
+                         const int off_l,
+                         const int off_s,
+                         const int rev_depth,
+                         int& node_id);
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Tools/Code/Polar/Polar_schedule.hxx"
+#endif
+
+#endif /* POLAR_SCHEDULE_HPP */
@@ -0,0 +1,19 @@
+#include "Tools/Code/Polar/Polar_schedule.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+int
+Polar_schedule ::get_m() const
+{
+    return this->m;
+}
+
+const std::vector<polar_instr_t>&
+Polar_schedule ::get_instructions() const
+{
+    return this->instructions;
+}
+}
+}
@@ -14,6 +14,7 @@
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 #include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
 #include "Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants.hpp"
+#include "Tools/Code/LDPC/Standard/NR/NR_constants.hpp"
 #include "Tools/Codec/Codec_SISO.hpp"
 
 namespace aff3ct
@@ -28,6 +29,7 @@ class Codec_LDPC : public Codec_SISO<B, Q>
     std::shared_ptr<Sparse_matrix> G;
     std::shared_ptr<LDPC_matrix_handler::Positions_vector> info_bits_pos;
     std::shared_ptr<dvbs2_values> dvbs2;
+    std::shared_ptr<nr_values> nr;
 
   public:
     Codec_LDPC(const factory::Encoder_LDPC& enc_params,
@@ -41,6 +43,7 @@ class Codec_LDPC : public Codec_SISO<B, Q>
     const Sparse_matrix& get_G() const;
     const LDPC_matrix_handler::Positions_vector& get_info_bits_pos() const;
     const dvbs2_values& get_DVBS2() const;
+    const nr_values& get_NR() const;
 };
 }
 }
@@ -59,12 +59,27 @@ class Dumper
                        std::vector<unsigned> headers = std::vector<unsigned>());
 
     virtual void dump(const std::string& base_path);
-    void add(const unsigned n_err, const size_t frame_id = 0);
+    virtual void add(const unsigned n_err, const size_t frame_id = 0);
     virtual void clear();
 
     void set_write_headers(const bool write_headers);
 
   protected:
+    /*!
+     * \brief Gets the number of frames dumped for a registered data.
+     *
+     * \param i: the index of the registered data.
+     */
+    virtual unsigned get_n_data(const unsigned i) const;
+
+    /*!
+     * \brief Writes the dumped frames of a registered data (without the header).
+     *
+     * \param file: the output file, opened in binary mode if the data has been registered in binary mode.
+     * \param i:    the index of the registered data.
+     */
+    virtual void write_body(std::ofstream& file, const unsigned i);
+
     void write_header_text(std::ofstream& file,
                            const unsigned n_data,
                            const unsigned data_size,
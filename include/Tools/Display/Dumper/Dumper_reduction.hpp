@@ -19,9 +19,10 @@ class Dumper_reduction : Dumper
 {
   protected:
     std::vector<std::unique_ptr<Dumper>>& dumpers;
+    const bool write_index; // write the range of the frames of each dumper in the merged files ('base_path.idx')
 
   public:
-    explicit Dumper_reduction(std::vector<std::unique_ptr<Dumper>>& dumpers);
+    explicit Dumper_reduction(std::vector<std::unique_ptr<Dumper>>& dumpers, const bool write_index = false);
     virtual ~Dumper_reduction() = default;
 
     virtual void dump(const std::string& base_path);
@@ -30,6 +31,7 @@ class Dumper_reduction : Dumper
 
   private:
     void checks();
+    void dump_index(const std::string& base_path);
 };
 }
 }
@@ -0,0 +1,78 @@
+/*!
+ * \file
+ * \brief Class tools::Dumper_stream.
+ */
+#ifndef DUMPER_STREAM_HPP_
+#define DUMPER_STREAM_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Tools/Display/Dumper/Dumper.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Dumper_stream
+ *
+ * \brief Dumper with a bounded memory footprint.
+ *
+ * The dumped frames are copied in fixed-size buffers (one per registered data). When the buffers are full they are
+ * given to a background thread which appends them to binary part files ('part_path.ext.part') while the next frames
+ * are copied in a second set of buffers. The part files are merged in the final files by 'dump' (or by
+ * Dumper_reduction), the memory used does not depend on the number of dumped frames.
+ */
+class Dumper_stream : public Dumper
+{
+  protected:
+    const std::string part_path;
+    const size_t buffer_bytes; // size of the buffers of all the registered data
+
+    std::vector<std::vector<char>> active;  // the frames being dumped, one buffer per registered data
+    std::vector<std::vector<char>> pending; // the frames being written by the writer thread
+    std::vector<std::unique_ptr<std::ofstream>> parts;
+    std::vector<unsigned> n_data;
+    unsigned n_active;         // the number of frames in the 'active' buffers
+    unsigned frames_per_block; // the number of frames in the buffers before they are given to the writer thread
+
+    std::thread writer;
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool writing; // the 'pending' buffers are being written
+    bool stop;
+
+  public:
+    Dumper_stream(const std::string& part_path, const size_t buffer_bytes = 1 << 20);
+    virtual ~Dumper_stream();
+
+    virtual void add(const unsigned n_err, const size_t frame_id = 0);
+    virtual void clear();
+
+    /*!
+     * \brief Gives the frames of the 'active' buffers to the writer thread and waits for all the frames to be written.
+     */
+    void flush();
+
+  protected:
+    virtual unsigned get_n_data(const unsigned i) const;
+    virtual void write_body(std::ofstream& file, const unsigned i);
+
+  private:
+    void open_parts(const bool truncate);
+    void hand_over();
+    void wait_writer();
+    void writer_loop();
+    std::string get_part_path(const unsigned i) const;
+};
+}
+}
+
+#endif /* DUMPER_STREAM_HPP_ */
@@ -71,12 +71,56 @@ class Interleaver_core
 
     virtual void reinitialize();
 
+    /*!
+     * \brief Interleaves frames by a direct call on the lookup table (without the StreamPU task dispatch).
+     *
+     * This is the fast path for the iterative decoders: no socket is bound and no memory is allocated.
+     *
+     * \param nat:      the frames in the natural domain.
+     * \param itl:      the frames in the interleaved domain.
+     * \param frame_id: the index of the first frame (selects the lookup table when the interleaver is uniform).
+     * \param n_frames: the number of consecutive frames to process.
+     */
+    template<typename D>
+    inline void interleave(const D* nat, D* itl, const size_t frame_id = 0, const size_t n_frames = 1) const;
+
+    template<typename D>
+    inline void deinterleave(const D* itl, D* nat, const size_t frame_id = 0, const size_t n_frames = 1) const;
+
+    /*!
+     * \brief Same as 'interleave' but the 'n_frames' frames are reordered (the i-th value of the f-th frame is at the
+     * position 'i * n_frames + f'), the frames are moved with SIMD loads and stores when possible.
+     */
+    template<typename D>
+    inline void interleave_reordering(const D* nat, D* itl, const size_t frame_id = 0, const size_t n_frames = 1) const;
+
+    template<typename D>
+    inline void deinterleave_reordering(const D* itl,
+                                        D* nat,
+                                        const size_t frame_id = 0,
+                                        const size_t n_frames = 1) const;
+
   protected:
     bool is_initialized() const;
 
     void init();
 
     virtual void gen_lut(T* lut, const size_t frame_id) = 0;
+
+  private:
+    template<typename D>
+    inline void _interleave(const D* in_vec,
+                            D* out_vec,
+                            const std::vector<T>& lookup_table,
+                            const size_t frame_id,
+                            const size_t n_frames) const;
+
+    template<typename D>
+    inline void _interleave_reordering(const D* in_vec,
+                                       D* out_vec,
+                                       const std::vector<T>& lookup_table,
+                                       const size_t frame_id,
+                                       const size_t n_frames) const;
 };
 }
 }
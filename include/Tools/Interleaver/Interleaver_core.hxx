@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <mipp.h>
 #include <sstream>
 #include <streampu.hpp>
 #include <utility>
@@ -175,5 +176,113 @@ Interleaver_core<T>::reinitialize()
 {
 }
 
+template<typename T>
+template<typename D>
+void
+Interleaver_core<T>::interleave(const D* nat, D* itl, const size_t frame_id, const size_t n_frames) const
+{
+    this->_interleave(nat, itl, this->get_lut(), frame_id, n_frames);
+}
+
+template<typename T>
+template<typename D>
+void
+Interleaver_core<T>::deinterleave(const D* itl, D* nat, const size_t frame_id, const size_t n_frames) const
+{
+    this->_interleave(itl, nat, this->get_lut_inv(), frame_id, n_frames);
+}
+
+template<typename T>
+template<typename D>
+void
+Interleaver_core<T>::interleave_reordering(const D* nat, D* itl, const size_t frame_id, const size_t n_frames) const
+{
+    this->_interleave_reordering(nat, itl, this->get_lut(), frame_id, n_frames);
+}
+
+template<typename T>
+template<typename D>
+void
+Interleaver_core<T>::deinterleave_reordering(const D* itl, D* nat, const size_t frame_id, const size_t n_frames) const
+{
+    this->_interleave_reordering(itl, nat, this->get_lut_inv(), frame_id, n_frames);
+}
+
+template<typename T>
+template<typename D>
+void
+Interleaver_core<T>::_interleave(const D* in_vec,
+                                 D* out_vec,
+                                 const std::vector<T>& lookup_table,
+                                 const size_t frame_id,
+                                 const size_t n_frames) const
+{
+    // scalar gather: the SIMD gathers need indexes of the width of 'D' and are rarely faster than scalar loads
+    if (!this->uniform)
+    {
+        const auto lut = lookup_table.data();
+        for (size_t f = 0; f < n_frames; f++)
+        {
+            const auto off = f * this->size;
+            for (auto i = 0; i < this->size; i++)
+                out_vec[off + i] = in_vec[off + lut[i]];
+        }
+    }
+    else
+    {
+        auto cur_frame_id = frame_id % this->n_frames;
+        for (size_t f = 0; f < n_frames; f++)
+        {
+            const auto lut = lookup_table.data() + cur_frame_id * this->size;
+            const auto off = f * this->size;
+            for (auto i = 0; i < this->size; i++)
+                out_vec[off + i] = in_vec[off + lut[i]];
+            cur_frame_id = (cur_frame_id + 1) % this->n_frames;
+        }
+    }
+}
+
+template<typename T>
+template<typename D>
+void
+Interleaver_core<T>::_interleave_reordering(const D* in_vec,
+                                            D* out_vec,
+                                            const std::vector<T>& lookup_table,
+                                            const size_t frame_id,
+                                            const size_t n_frames) const
+{
+    if (!this->uniform)
+    {
+        // vectorized interleaving
+        if (n_frames == (size_t)mipp::nElReg<D>())
+        {
+            for (auto i = 0; i < this->size; i++)
+                mipp::store<D>(&out_vec[i * mipp::nElReg<D>()],
+                               mipp::load<D>(&in_vec[lookup_table[i] * mipp::nElReg<D>()]));
+        }
+        else
+        {
+            for (auto i = 0; i < this->size; i++)
+            {
+                const auto off1 = i * n_frames;
+                const auto off2 = lookup_table[i] * n_frames;
+                for (size_t f = 0; f < n_frames; f++)
+                    out_vec[off1 + f] = in_vec[off2 + f];
+            }
+        }
+    }
+    else
+    {
+        auto cur_frame_id = frame_id % this->n_frames;
+        for (size_t f = 0; f < n_frames; f++)
+        {
+            const auto lut = lookup_table.data() + cur_frame_id * this->size;
+            for (auto i = 0; i < this->size; i++)
+                out_vec[i * n_frames + f] = in_vec[lut[i] * n_frames + f];
+            cur_frame_id = (cur_frame_id + 1) % this->n_frames;
+        }
+    }
+}
+
 }
 }
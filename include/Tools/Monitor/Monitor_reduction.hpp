@@ -5,7 +5,9 @@
 #ifndef MONITOR_REDUCTION_HPP_
 #define MONITOR_REDUCTION_HPP_
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <memory>
 #include <thread>
 #include <type_traits>
@@ -17,112 +19,184 @@ namespace aff3ct
 {
 namespace tools
 {
+class Monitor_reduction_base;
 
-class Monitor_reduction_static
+/*!
+ * \class Monitor_reduction_engine
+ *
+ * \brief Registry of the monitor reductions of a simulation.
+ *
+ * The engine is owned by a simulation (several simulations can run in the same process). The reductions are done by
+ * the master thread, the other threads only read the stop flag. Each replica of the monitors can also publish its
+ * number of checked frames, of wrong frames and of mutual information trials in its own counters: the stop decision
+ * of the master thread does not depend on the reduction frequency and does not require to reduce all the replicas.
+ */
+class Monitor_reduction_engine
 {
-  protected:
-    static bool stop_loop;
-    static std::vector<Monitor_reduction_static*> monitors;
-    static std::thread::id master_thread_id;
-    static std::chrono::nanoseconds d_reduce_frequency;
+    friend class Monitor_reduction_base;
+
+  public:
+    static constexpr size_t cache_line_size = 64;
+
+    struct Counters
+    {
+        std::atomic<unsigned long long> n_fra;    // the number of checked frames of a replica
+        std::atomic<unsigned long long> n_fe;     // the number of wrong frames of a replica
+        std::atomic<unsigned long long> n_trials; // the number of checked mutual information trials of a replica
 
-    static std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds> t_last_reduction;
+        // the allocation is not aligned on a cache line in C++11, two lines make sure that the counters of two
+        // replicas (written by different threads) never share a cache line
+        char padding[2 * cache_line_size - 3 * sizeof(std::atomic<unsigned long long>)];
+    };
+
+  protected:
+    std::atomic<bool> stop_loop;
+    std::vector<Monitor_reduction_base*> monitors;
+    std::thread::id master_thread_id;
+    std::chrono::nanoseconds d_reduce_frequency;
+    std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds> t_last_reduction;
+
+    std::unique_ptr<Counters[]> counters;
+    size_t n_counters;
+    unsigned long long max_fe;       // 0 if the wrong frames counters do not stop the simulation
+    unsigned long long max_n_frames; // 0 if the checked frames counters do not stop the simulation
+    unsigned long long max_n_trials; // 0 if the mutual information trials counters do not stop the simulation
 
   public:
+    Monitor_reduction_engine();
+
+    virtual ~Monitor_reduction_engine() = default;
+
     /*
-     * \brief check if any recorded monitor reduction has done after having done a reduction
-     *        if any monitor is done then call 'set_stop_loop()'
-     * \param final is true then call 'last_reduce_all()' else 'reduce_all()'
+     * \brief from the master thread: check if the limits of the counters are reached, if so then call
+     *        'set_stop_loop()'. When the 'd_reduce_frequency' period is not null and is elapsed, the monitors are
+     *        also reduced (to refresh the displayed values) and checked. From the other threads only read the stop
+     *        flag (relaxed atomic read).
      * \param fully call the reduction functions with this parameter
      * \return 'get_stop_loop()' result
      */
-    static bool is_done_all(bool fully = false);
+    bool is_done_all(bool fully = false);
 
     /*
      * \brief call _reduce with 'fully' and 'force' arguments
      */
-    static void reduce_all(bool fully = false, bool force = false);
+    void reduce_all(bool fully = false, bool force = false);
 
     /*
      * \brief loop on a forced reduction until '_reduce' call return 'true' after having call 'set_stop_loop()'
      */
-    static void last_reduce_all(bool fully = true);
+    void last_reduce_all(bool fully = true);
 
     /*
      * \brief throw if all process do not have the same number of monitors to reduce
      */
-    static void check_reducible();
+    void check_reducible();
 
     /*
-     * reset 't_last_mpi_comm', clear 'stop_loop' and call 'reset_mr' on each monitor
+     * reset 't_last_reduction', clear 'stop_loop', clear the counters and call 'reset' on each monitor
      */
-    static void reset_all();
+    void reset_all();
 
-    static void set_master_thread_id(std::thread::id t);
+    void set_master_thread_id(std::thread::id t);
 
-    static void set_reduce_frequency(std::chrono::nanoseconds d);
+    void set_reduce_frequency(std::chrono::nanoseconds d);
 
     /*
-     * \brief reset this monitor
+     * \brief allocate one counters slot per replica of the monitor, the slots are cleared
+     * \param n_replicas the number of replicas (one slot per replica)
+     * \param max_fe stop when the sum of the wrong frames reaches this value (disabled if 0)
+     * \param max_n_frames stop when the sum of the checked frames reaches this value (disabled if 0)
+     * \param max_n_trials stop when the sum of the mutual information trials reaches this value (disabled if 0)
      */
-    virtual void reset() = 0;
+    void init_counters(const size_t n_replicas,
+                       const unsigned max_fe,
+                       const unsigned max_n_frames,
+                       const unsigned max_n_trials = 0);
 
     /*
-     * \brief check if this monitor has done
-     * \return true if has done
+     * \brief get the counters slot of a replica, it has to be written only by the thread running this replica
      */
-    virtual bool is_done();
+    Counters& get_counters(const size_t replica_id);
 
     /*
-     * \brief do the reduction of this monitor
+     * \brief get if the current simulation loop must be stopped or not
+     * \return true if loop must be stopped
      */
-    virtual void reduce(bool fully = true) = 0;
-
-  protected:
-    Monitor_reduction_static();
-
-    virtual ~Monitor_reduction_static();
-
-    virtual bool _is_done() = 0;
+    bool get_stop_loop() const;
 
   private:
     /*
-     * \brief get if the current simulation loop must be stopped or not
-     * \return true if loop must be stopped
+     * \brief set that the current simulation loop must be stopped
      */
-    static bool get_stop_loop();
+    void set_stop_loop();
 
     /*
-     * \brief set that the current simulation loop must be stopped
+     * \brief sum the counters of all the replicas (relaxed atomic reads)
+     * \return true if 'max_fe', 'max_n_frames' or 'max_n_trials' is reached
      */
-    static void set_stop_loop();
+    bool counters_limit_achieved() const;
 
     /*
      * \brief add the monitor in the 'monitors' list
      */
-    static void add_monitor(Monitor_reduction_static*);
+    void add_monitor(Monitor_reduction_base*);
 
-    static void remove_monitor(Monitor_reduction_static*);
+    void remove_monitor(Monitor_reduction_base*);
 
     /*
      * \brief do a reduction of the number of process that are at the final reduce step
      * \return true if all process are at the final reduce step (always true without MPI)
      */
-    static bool reduce_stop_loop();
+    bool reduce_stop_loop();
 
     /*
      * \brief do the reductions of all 'monitors' if the thread calling it is the master thread and if the
-     *        'd_reduce_frequency' criteria is reached.
+     *        'd_reduce_frequency' criteria is reached (a null period always reduces).
      * \param force if set, do the reduction anyway
      * \param fully if set, do a full reduction of all attributes
      * \return the result of the 'reduce_stop_loop()' call after the reductions. If there were not, then return false.
      */
-    static bool _reduce(bool fully, bool force);
+    bool _reduce(bool fully, bool force);
+};
+
+class Monitor_reduction_base
+{
+    friend class Monitor_reduction_engine;
+
+  protected:
+    Monitor_reduction_engine& engine;
+
+  public:
+    /*
+     * \brief reset this monitor
+     */
+    virtual void reset() = 0;
+
+    /*
+     * \brief check if this monitor has done
+     * \return true if has done
+     */
+    virtual bool is_done();
+
+    /*
+     * \brief do the reduction of this monitor
+     */
+    virtual void reduce(bool fully = true) = 0;
+
+  protected:
+    explicit Monitor_reduction_base(Monitor_reduction_engine& engine);
+
+    virtual ~Monitor_reduction_base();
+
+    /*
+     * \brief check if this monitor has done on the values of its last reduction (no reduction is done)
+     */
+    virtual bool _is_done() = 0;
 };
 
 template<class M> // M is the monitor on which must be applied the reduction
 class Monitor_reduction
-  : public Monitor_reduction_static
+  : public Monitor_reduction_base
   , public M
 {
     static_assert(std::is_base_of<module::Monitor, M>::value, "M have to be based on a module::Monitor class.");
@@ -135,10 +209,11 @@ class Monitor_reduction
     /*
      * \brief do reductions upon a monitor list to merge data in this monitor
      * \param monitors is the list of monitors on which the reductions are done
+     * \param engine is the registry in which this reduction is recorded (usually owned by the simulation)
      */
-    explicit Monitor_reduction(const std::vector<M*>& monitors);
-    explicit Monitor_reduction(const std::vector<std::unique_ptr<M>>& monitors);
-    explicit Monitor_reduction(const std::vector<std::shared_ptr<M>>& monitors);
+    Monitor_reduction(const std::vector<M*>& monitors, Monitor_reduction_engine& engine);
+    Monitor_reduction(const std::vector<std::unique_ptr<M>>& monitors, Monitor_reduction_engine& engine);
+    Monitor_reduction(const std::vector<std::shared_ptr<M>>& monitors, Monitor_reduction_engine& engine);
     virtual ~Monitor_reduction() = default;
 
     virtual void reset();
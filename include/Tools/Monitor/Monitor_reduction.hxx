@@ -25,8 +25,8 @@ get_monitor_from_vector(const std::vector<M*>& monitors)
 }
 
 template<class M>
-Monitor_reduction<M>::Monitor_reduction(const std::vector<M*>& _monitors)
-  : Monitor_reduction_static()
+Monitor_reduction<M>::Monitor_reduction(const std::vector<M*>& _monitors, Monitor_reduction_engine& engine)
+  : Monitor_reduction_base(engine)
   , M(get_monitor_from_vector<M>(_monitors))
   , monitors(_monitors)
   , collecter(*this)
@@ -66,14 +66,16 @@ Monitor_reduction<M>::Monitor_reduction(const std::vector<M*>& _monitors)
 }
 
 template<class M>
-Monitor_reduction<M>::Monitor_reduction(const std::vector<std::unique_ptr<M>>& _monitors)
-  : Monitor_reduction(convert_to_ptr<M>(_monitors))
+Monitor_reduction<M>::Monitor_reduction(const std::vector<std::unique_ptr<M>>& _monitors,
+                                        Monitor_reduction_engine& engine)
+  : Monitor_reduction(convert_to_ptr<M>(_monitors), engine)
 {
 }
 
 template<class M>
-Monitor_reduction<M>::Monitor_reduction(const std::vector<std::shared_ptr<M>>& _monitors)
-  : Monitor_reduction(convert_to_ptr<M>(_monitors))
+Monitor_reduction<M>::Monitor_reduction(const std::vector<std::shared_ptr<M>>& _monitors,
+                                        Monitor_reduction_engine& engine)
+  : Monitor_reduction(convert_to_ptr<M>(_monitors), engine)
 {
 }
 
@@ -97,15 +99,6 @@ template<class M>
 bool
 Monitor_reduction<M>::_is_done()
 {
-    // only the master thread can do this
-    if ((std::this_thread::get_id() == Monitor_reduction_static::master_thread_id &&
-         (std::chrono::steady_clock::now() - Monitor_reduction_static::t_last_reduction) >=
-           Monitor_reduction_static::d_reduce_frequency))
-    {
-        this->reduce(false);
-        Monitor_reduction_static::t_last_reduction = std::chrono::steady_clock::now();
-    }
-
     return M::is_done();
 }
 
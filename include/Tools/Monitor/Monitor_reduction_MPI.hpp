@@ -28,9 +28,9 @@ class Monitor_reduction_MPI : public Monitor_reduction<M>
     MPI_Op MPI_Op_reduce_monitors;
 
   public:
-    explicit Monitor_reduction_MPI(const std::vector<M*>& monitors);
-    explicit Monitor_reduction_MPI(const std::vector<std::unique_ptr<M>>& monitors);
-    explicit Monitor_reduction_MPI(const std::vector<std::shared_ptr<M>>& monitors);
+    Monitor_reduction_MPI(const std::vector<M*>& monitors, Monitor_reduction_engine& engine);
+    Monitor_reduction_MPI(const std::vector<std::unique_ptr<M>>& monitors, Monitor_reduction_engine& engine);
+    Monitor_reduction_MPI(const std::vector<std::shared_ptr<M>>& monitors, Monitor_reduction_engine& engine);
     virtual ~Monitor_reduction_MPI();
 
     virtual bool is_done();
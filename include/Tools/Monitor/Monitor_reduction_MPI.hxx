@@ -14,8 +14,8 @@ namespace tools
 {
 
 template<class M>
-Monitor_reduction_MPI<M>::Monitor_reduction_MPI(const std::vector<M*>& monitors)
-  : Monitor_reduction<M>(monitors)
+Monitor_reduction_MPI<M>::Monitor_reduction_MPI(const std::vector<M*>& monitors, Monitor_reduction_engine& engine)
+  : Monitor_reduction<M>(monitors, engine)
 {
     const std::string name = "Monitor_reduction_MPI<" + monitors[0]->get_name() + ">";
     this->set_name(name);
@@ -47,14 +47,16 @@ Monitor_reduction_MPI<M>::Monitor_reduction_MPI(const std::vector<M*>& monitors)
 }
 
 template<class M>
-Monitor_reduction_MPI<M>::Monitor_reduction_MPI(const std::vector<std::unique_ptr<M>>& monitors)
-  : Monitor_reduction_MPI(convert_to_ptr<M>(monitors))
+Monitor_reduction_MPI<M>::Monitor_reduction_MPI(const std::vector<std::unique_ptr<M>>& monitors,
+                                                Monitor_reduction_engine& engine)
+  : Monitor_reduction_MPI(convert_to_ptr<M>(monitors), engine)
 {
 }
 
 template<class M>
-Monitor_reduction_MPI<M>::Monitor_reduction_MPI(const std::vector<std::shared_ptr<M>>& monitors)
-  : Monitor_reduction_MPI(convert_to_ptr<M>(monitors))
+Monitor_reduction_MPI<M>::Monitor_reduction_MPI(const std::vector<std::shared_ptr<M>>& monitors,
+                                                Monitor_reduction_engine& engine)
+  : Monitor_reduction_MPI(convert_to_ptr<M>(monitors), engine)
 {
 }
 
@@ -70,7 +72,7 @@ bool
 Monitor_reduction_MPI<M>::is_done()
 {
     std::stringstream message;
-    message << "'is_done' method is not available in MPI, please use the static 'is_done_all' method instead.";
+    message << "'is_done' method is not available in MPI, please use the 'is_done_all' method of the engine instead.";
     throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__, message.str());
 }
 
@@ -0,0 +1,50 @@
+/*!
+ * \file
+ * \brief Functions for the packed bits representation.
+ *
+ * A packed frame of 'n_bits' bits is stored as in spu::tools::Bit_packer (8 bits per byte, the first bit in the LSB of
+ * the first byte) in an array of 'packed_size<B>(n_bits)' elements of type B. The unused bits of the last element are
+ * set to 0.
+ */
+#ifndef BIT_PACKING_H_
+#define BIT_PACKING_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * return the number of elements of type B required to store 'n_bits' packed bits
+ */
+template<typename B = int32_t>
+inline size_t
+packed_size(const size_t n_bits);
+
+/*
+ * return the number of bits set to 1 in 'word'
+ */
+inline unsigned
+popcount(const uint64_t word);
+
+/*
+ * pack the 'n_bits' bits of 'in' (one bit per element) in 'out' and set the unused bits of the last element to 0
+ */
+template<typename B = int32_t>
+inline void
+pack_bits(const B* in, B* out, const size_t n_bits);
+
+/*
+ * unpack the 'n_bits' packed bits of 'in' in 'out' (one bit per element)
+ */
+template<typename B = int32_t>
+inline void
+unpack_bits(const B* in, B* out, const size_t n_bits);
+}
+}
+
+#include "Tools/Perf/common/bit_packing.hxx"
+
+#endif /* BIT_PACKING_H_ */
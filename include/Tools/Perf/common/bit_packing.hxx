@@ -0,0 +1,49 @@
+#include <algorithm>
+#include <streampu.hpp>
+
+#include "Tools/Perf/common/bit_packing.h"
+
+namespace aff3ct
+{
+namespace tools
+{
+template<typename B>
+size_t
+packed_size(const size_t n_bits)
+{
+    constexpr size_t n_bits_per_elmt = sizeof(B) * 8;
+    return (n_bits + n_bits_per_elmt - 1) / n_bits_per_elmt;
+}
+
+unsigned
+popcount(const uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_popcountll(word);
+#else
+    auto w = word - ((word >> 1) & 0x5555555555555555ULL);
+    w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+    w = (w + (w >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return (unsigned)((w * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+template<typename B>
+void
+pack_bits(const B* in, B* out, const size_t n_bits)
+{
+    auto bytes = (unsigned char*)out;
+    spu::tools::Bit_packer::pack(in, bytes, (int)n_bits);
+
+    const auto n_bytes = (n_bits + 7) / 8;
+    std::fill(bytes + n_bytes, bytes + packed_size<B>(n_bits) * sizeof(B), (unsigned char)0);
+}
+
+template<typename B>
+void
+unpack_bits(const B* in, B* out, const size_t n_bits)
+{
+    spu::tools::Bit_packer::unpack((const unsigned char*)in, out, (int)n_bits);
+}
+}
+}
@@ -79,6 +79,15 @@ hamming_distance_unk_seq(const B* in, const unsigned size);
 template<typename B = int32_t>
 inline size_t
 hamming_distance_unk(const B* in, const unsigned size);
+
+/*
+ * compute the Hamming distance between the packed arrays 'in1' and 'in2' of 'n_bits' bits
+ * (see Tools/Perf/common/bit_packing.h for the packed representation)
+ * Operations are performed on 64-bit words with a population count.
+ */
+template<typename B = int32_t>
+inline size_t
+hamming_distance_packed(const B* in1, const B* in2, const unsigned n_bits);
 }
 }
 
@@ -1,3 +1,6 @@
+#include <cstring>
+
+#include "Tools/Perf/common/bit_packing.h"
 #include "Tools/Perf/distance/Boolean_diff.h"
 #include "Tools/Perf/distance/distance.h"
 #include "Tools/Perf/distance/hamming_distance.h"
@@ -61,5 +64,31 @@ hamming_distance_unk(const B* in, const unsigned size)
 {
     return distance<B, Boolean_diff<B, true>>(in, size);
 }
+
+template<typename B>
+size_t
+hamming_distance_packed(const B* in1, const B* in2, const unsigned n_bits)
+{
+    const auto bytes1 = (const unsigned char*)in1;
+    const auto bytes2 = (const unsigned char*)in2;
+    const auto n_bytes = n_bits / 8;
+
+    size_t dist = 0;
+    unsigned i = 0;
+    for (; i + sizeof(uint64_t) <= n_bytes; i += sizeof(uint64_t))
+    {
+        uint64_t w1, w2;
+        std::memcpy(&w1, bytes1 + i, sizeof(uint64_t));
+        std::memcpy(&w2, bytes2 + i, sizeof(uint64_t));
+        dist += popcount(w1 ^ w2);
+    }
+    for (; i < n_bytes; i++)
+        dist += popcount((uint64_t)(bytes1[i] ^ bytes2[i]));
+
+    const auto rest = n_bits % 8;
+    if (rest) dist += popcount((uint64_t)((bytes1[i] ^ bytes2[i]) & ((1u << rest) - 1)));
+
+    return dist;
+}
+}
 }
-}
\ No newline at end of file
@@ -321,6 +321,9 @@
 #ifndef DECODER_MAXIMUM_LIKELIHOOD_STD_HPP_
 #include <Module/Decoder/Generic/ML/Decoder_maximum_likelihood_std.hpp>
 #endif
+#ifndef DECODER_OSD_STD_HPP_
+#include <Module/Decoder/Generic/OSD/Decoder_OSD_std.hpp>
+#endif
 #ifndef DECODER_LDPC_BIT_FLIPPING_HARD_HPP_
 #include <Module/Decoder/LDPC/BF/Decoder_LDPC_bit_flipping_hard.hpp>
 #endif
@@ -336,6 +339,9 @@
 #ifndef DECODER_LDPC_BP_HPP_
 #include <Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp>
 #endif
+#ifndef DECODER_LDPC_BP_LANE_REFILL_HPP_
+#include <Module/Decoder/LDPC/BP/Decoder_LDPC_BP_lane_refill.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_FLOODING_HPP_
 #include <Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding.hpp>
 #endif
@@ -360,6 +366,9 @@
 #ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_INTER_HPP_
 #include <Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_inter.hpp>
 #endif
+#ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_QC_HPP_
+#include <Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_QC.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_ONMS_INTER_HPP_
 #include <Module/Decoder/LDPC/BP/Horizontal_layered/ONMS/Decoder_LDPC_BP_horizontal_layered_ONMS_inter.hpp>
 #endif
@@ -522,6 +531,9 @@
 #ifndef DECODER_RSC_BCJR_STD_GENERIC_SEQ_JSON_HPP_
 #include <Module/Decoder/RSC/BCJR/Seq_generic/Decoder_RSC_BCJR_seq_generic_std_json.hpp>
 #endif
+#ifndef DECODER_RSC_BCJR_SUBBLOCK_HPP_
+#include <Module/Decoder/RSC/BCJR/Subblock/Decoder_RSC_BCJR_subblock.hpp>
+#endif
 #ifndef DECODER_RSC_DB_BCJR_DVB_RCS1_HPP_
 #include <Module/Decoder/RSC_DB/BCJR/Decoder_RSC_DB_BCJR_DVB_RCS1.hpp>
 #endif
@@ -600,6 +612,9 @@
 #ifndef ENCODER_LDPC_FROM_QC_HPP_
 #include <Module/Encoder/LDPC/From_QC/Encoder_LDPC_from_QC.hpp>
 #endif
+#ifndef ENCODER_LDPC_NR_HPP_
+#include <Module/Encoder/LDPC/NR/Encoder_LDPC_NR.hpp>
+#endif
 #ifndef ENCODER_NO_HPP_
 #include <Module/Encoder/NO/Encoder_NO.hpp>
 #endif
@@ -687,6 +702,9 @@
 #ifndef MODEM_GENERIC_HPP_
 #include <Module/Modem/Generic/Modem_generic.hpp>
 #endif
+#ifndef MODEM_GENERIC_SECTOR_HPP_
+#include <Module/Modem/Generic/Modem_generic_sector.hpp>
+#endif
 #ifndef MODEM_HPP_
 #include <Module/Modem/Modem.hpp>
 #endif
@@ -711,21 +729,33 @@
 #ifndef MODEM_SCMA_HPP_
 #include <Module/Modem/SCMA/Modem_SCMA.hpp>
 #endif
+#ifndef MODEM_SCMA_LOG_HPP_
+#include <Module/Modem/SCMA/Modem_SCMA_log.hpp>
+#endif
 #ifndef MONITOR_BFER_HPP_
 #include <Module/Monitor/BFER/Monitor_BFER.hpp>
 #endif
 #ifndef MONITOR_EXIT_HPP_
 #include <Module/Monitor/EXIT/Monitor_EXIT.hpp>
 #endif
+#ifndef MONITOR_LATENCY_HPP_
+#include <Module/Monitor/Latency/Monitor_latency.hpp>
+#endif
 #ifndef MONITOR_MI_HPP_
 #include <Module/Monitor/MI/Monitor_MI.hpp>
 #endif
 #ifndef MONITOR_HPP_
 #include <Module/Monitor/Monitor.hpp>
 #endif
+#ifndef PACKER_HPP_
+#include <Module/Packer/Packer.hpp>
+#endif
 #ifndef PUNCTURER_LDPC_HPP_
 #include <Module/Puncturer/LDPC/Puncturer_LDPC.hpp>
 #endif
+#ifndef PUNCTURER_LDPC_NR_HPP_
+#include <Module/Puncturer/LDPC/Puncturer_LDPC_NR.hpp>
+#endif
 #ifndef PUNCTURER_NO_HPP_
 #include <Module/Puncturer/NO/Puncturer_NO.hpp>
 #endif
@@ -792,6 +822,9 @@
 #ifndef GAUSSIAN_NOISE_GENERATOR_MKL_HPP_
 #include <Tools/Algo/Draw_generator/Gaussian_noise_generator/MKL/Gaussian_noise_generator_MKL.hpp>
 #endif
+#ifndef GAUSSIAN_NOISE_GENERATOR_PHILOX_HPP_
+#include <Tools/Algo/Draw_generator/Gaussian_noise_generator/Philox/Gaussian_noise_generator_philox.hpp>
+#endif
 #ifndef GAUSSIAN_NOISE_GENERATOR_STD_HPP_
 #include <Tools/Algo/Draw_generator/Gaussian_noise_generator/Standard/Gaussian_noise_generator_std.hpp>
 #endif
@@ -816,6 +849,9 @@
 #ifndef FULL_MATRIX_HPP_
 #include <Tools/Algo/Matrix/Full_matrix/Full_matrix.hpp>
 #endif
+#ifndef GF2_MATRIX_HPP_
+#include <Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hpp>
+#endif
 #ifndef MATRIX_HPP_
 #include <Tools/Algo/Matrix/Matrix.hpp>
 #endif
@@ -825,6 +861,9 @@
 #ifndef SPARSE_MATRIX_HPP_
 #include <Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp>
 #endif
+#ifndef SPARSE_MATRIX_CSR_HPP_
+#include <Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hpp>
+#endif
 #ifndef VECTOR_2D_HPP_
 #include <Tools/Algo/Multidimensional_vector/Vector_2D.hpp>
 #endif
@@ -840,6 +879,9 @@
 #ifndef PRNG_MT19937_SIMD_HPP
 #include <Tools/Algo/PRNG/PRNG_MT19937_simd.hpp>
 #endif
+#ifndef PRNG_PHILOX_HPP
+#include <Tools/Algo/PRNG/PRNG_philox.hpp>
+#endif
 #ifndef LC_SORTER_HPP
 #include <Tools/Algo/Sort/LC_sorter.hpp>
 #endif
@@ -909,6 +951,9 @@
 #ifndef CODEC_RA_HPP_
 #include <Tools/Codec/RA/Codec_RA.hpp>
 #endif
+#ifndef CRC_ENGINE_HPP
+#include <Tools/Code/CRC/CRC_engine.hpp>
+#endif
 #ifndef CODEC_REPETITION_HPP_
 #include <Tools/Codec/Repetition/Codec_repetition.hpp>
 #endif
@@ -951,6 +996,9 @@
 #ifndef DVBS2_CONSTANTS_HPP_
 #include <Tools/Code/LDPC/Standard/DVBS2/DVBS2_constants.hpp>
 #endif
+#ifndef NR_CONSTANTS_HPP_
+#include <Tools/Code/LDPC/Standard/NR/NR_constants.hpp>
+#endif
 #ifndef LDPC_SYNDROME_HPP_
 #include <Tools/Code/LDPC/Syndrome/LDPC_syndrome.hpp>
 #endif
@@ -1017,6 +1065,9 @@
 #ifndef API_POLAR_STATIC_INTRA_32BIT_HPP_
 #include <Tools/Code/Polar/API/API_polar_static_intra_32bit.hpp>
 #endif
+#ifndef API_POLAR_STATIC_INTRA_64BIT_HPP_
+#include <Tools/Code/Polar/API/API_polar_static_intra_64bit.hpp>
+#endif
 #ifndef API_POLAR_STATIC_INTRA_8BIT_HPP_
 #include <Tools/Code/Polar/API/API_polar_static_intra_8bit.hpp>
 #endif
@@ -1083,6 +1134,9 @@
 #ifndef POLAR_CODE_HPP_
 #include <Tools/Code/Polar/Polar_code.hpp>
 #endif
+#ifndef POLAR_SCHEDULE_HPP
+#include <Tools/Code/Polar/Polar_schedule.hpp>
+#endif
 #ifndef RS_POLYNOMIAL_GENERATOR_HPP
 #include <Tools/Code/RS/RS_polynomial_generator.hpp>
 #endif
@@ -1149,6 +1203,9 @@
 #ifndef DUMPER_REDUCTION_HPP_
 #include <Tools/Display/Dumper/Dumper_reduction.hpp>
 #endif
+#ifndef DUMPER_STREAM_HPP_
+#include <Tools/Display/Dumper/Dumper_stream.hpp>
+#endif
 #ifndef FRAME_TRACE_HPP
 #include <Tools/Display/Frame_trace/Frame_trace.hpp>
 #endif
@@ -1254,6 +1311,9 @@
 #ifndef SIGMA_HPP_
 #include <Tools/Noise/Sigma.hpp>
 #endif
+#ifndef BIT_PACKING_H_
+#include <Tools/Perf/common/bit_packing.h>
+#endif
 #ifndef HARD_DECIDE_H_
 #include <Tools/Perf/common/hard_decide.h>
 #endif
@@ -57,7 +57,7 @@ Channel ::get_description(cli::Argument_map_info& args) const
                                                 "USER_BEC",
                                                 "USER_BSC")));
 
-    tools::add_arg(args, p, class_name + "p+implem", cli::Text(cli::Including_set("STD", "FAST")));
+    tools::add_arg(args, p, class_name + "p+implem", cli::Text(cli::Including_set("STD", "FAST", "PHILOX")));
 
 #ifdef AFF3CT_CHANNEL_GSL
     cli::add_options(args.at({ p + "-implem" }), 0, "GSL");
@@ -77,6 +77,10 @@ Channel ::get_description(cli::Argument_map_info& args) const
     tools::add_arg(args, p, class_name + "p+complex", cli::None());
 
     tools::add_arg(args, p, class_name + "p+gain-occur", cli::Integer(cli::Positive(), cli::Non_zero()));
+
+    tools::add_arg(args, p, class_name + "p+is-bias", cli::Text(cli::Including_set("NONE", "SCALE", "SHIFT")));
+
+    tools::add_arg(args, p, class_name + "p+is-factor", cli::Real(cli::Positive()));
 }
 
 void
@@ -93,6 +97,8 @@ Channel ::store(const cli::Argument_map_value& vals)
     if (vals.exist({ p + "-blk-fad" })) this->block_fading = vals.at({ p + "-blk-fad" });
     if (vals.exist({ p + "-add-users" })) this->add_users = true;
     if (vals.exist({ p + "-complex" })) this->complex = true;
+    if (vals.exist({ p + "-is-bias" })) this->is_bias = vals.at({ p + "-is-bias" });
+    if (vals.exist({ p + "-is-factor" })) this->is_factor = vals.to_float({ p + "-is-factor" });
 }
 
 void
@@ -119,6 +125,12 @@ Channel ::get_headers(std::map<std::string, tools::header_list>& headers, const
 
     headers[p].push_back(std::make_pair("Complex", this->complex ? "on" : "off"));
     headers[p].push_back(std::make_pair("Add users", this->add_users ? "on" : "off"));
+
+    if (this->is_bias != "NONE")
+    {
+        headers[p].push_back(std::make_pair("Importance sampling bias", this->is_bias));
+        headers[p].push_back(std::make_pair("Importance sampling factor", std::to_string(this->is_factor)));
+    }
 }
 
 template<typename R>
@@ -156,6 +168,8 @@ Channel ::build_gaussian() const
         impl = tools::Gaussian_noise_generator_implem::STD;
     else if (this->implem == "FAST")
         impl = tools::Gaussian_noise_generator_implem::FAST;
+    else if (this->implem == "PHILOX")
+        impl = tools::Gaussian_noise_generator_implem::PHILOX;
 #ifdef AFF3CT_CHANNEL_MKL
     else if (this->implem == "MKL")
         impl = tools::Gaussian_noise_generator_implem::MKL;
@@ -167,7 +181,15 @@ Channel ::build_gaussian() const
     else
         throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
 
-    if (type == "AWGN") return new module::Channel_AWGN_LLR<R>(this->N, impl, this->seed, this->add_users);
+    if (type == "AWGN")
+    {
+        auto chn = new module::Channel_AWGN_LLR<R>(this->N, impl, this->seed, this->add_users);
+        if (this->is_bias == "SCALE")
+            chn->set_importance_sampling(module::Importance_sampling_bias::SCALE, (R)this->is_factor);
+        else if (this->is_bias == "SHIFT")
+            chn->set_importance_sampling(module::Importance_sampling_bias::SHIFT, (R)this->is_factor);
+        return chn;
+    }
     if (type == "RAYLEIGH")
         return new module::Channel_Rayleigh_LLR<R>(this->N, this->complex, impl, this->seed, this->add_users);
     if (type == "RAYLEIGH_USER")
@@ -5,6 +5,7 @@
 #include "Module/Decoder/Generic/Chase/Decoder_chase_std.hpp"
 #include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_naive.hpp"
 #include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_std.hpp"
+#include "Module/Decoder/Generic/OSD/Decoder_OSD_std.hpp"
 #include "Tools/Documentation/documentation.h"
 
 using namespace aff3ct;
@@ -36,7 +37,7 @@ Decoder ::get_description(cli::Argument_map_info& args) const
     tools::add_arg(
       args, p, class_name + "p+info-bits,K", cli::Integer(cli::Positive(), cli::Non_zero()), cli::arg_rank::REQ);
 
-    tools::add_arg(args, p, class_name + "p+type,D", cli::Text(cli::Including_set("ML", "CHASE")));
+    tools::add_arg(args, p, class_name + "p+type,D", cli::Text(cli::Including_set("ML", "CHASE", "OSD")));
 
     tools::add_arg(args, p, class_name + "p+implem", cli::Text(cli::Including_set("STD", "NAIVE")));
 
@@ -44,6 +45,8 @@ Decoder ::get_description(cli::Argument_map_info& args) const
 
     tools::add_arg(args, p, class_name + "p+flips", cli::Integer(cli::Positive()));
 
+    tools::add_arg(args, p, class_name + "p+order", cli::Integer(cli::Positive()));
+
     tools::add_arg(args, p, class_name + "p+seed", cli::Integer(cli::Positive()));
 }
 
@@ -55,6 +58,7 @@ Decoder ::store(const cli::Argument_map_value& vals)
     if (vals.exist({ p + "-info-bits", "K" })) this->K = vals.to_int({ p + "-info-bits", "K" });
     if (vals.exist({ p + "-cw-size", "N" })) this->N_cw = vals.to_int({ p + "-cw-size", "N" });
     if (vals.exist({ p + "-flips" })) this->flips = vals.to_int({ p + "-flips" });
+    if (vals.exist({ p + "-order" })) this->order = vals.to_int({ p + "-order" });
     if (vals.exist({ p + "-seed" })) this->seed = vals.to_int({ p + "-seed" });
     if (vals.exist({ p + "-type", "D" })) this->type = vals.at({ p + "-type", "D" });
     if (vals.exist({ p + "-implem" })) this->implem = vals.at({ p + "-implem" });
@@ -75,9 +79,10 @@ Decoder ::get_headers(std::map<std::string, tools::header_list>& headers, const
     if (full) headers[p].push_back(std::make_pair("Codeword size (N)", std::to_string(this->N_cw)));
     if (full) headers[p].push_back(std::make_pair("Code rate (R)", std::to_string(this->R)));
     headers[p].push_back(std::make_pair("Systematic", ((this->systematic) ? "yes" : "no")));
-    if (this->type == "ML" || this->type == "CHASE")
+    if (this->type == "ML" || this->type == "CHASE" || this->type == "OSD")
         headers[p].push_back(std::make_pair("Distance", this->hamming ? "Hamming" : "Euclidean"));
     if (this->type == "CHASE") headers[p].push_back(std::make_pair("Max flips", std::to_string(this->flips)));
+    if (this->type == "OSD") headers[p].push_back(std::make_pair("Order", std::to_string(this->order)));
 
     if (full) headers[p].push_back(std::make_pair("Seed", std::to_string(this->seed)));
 }
@@ -100,6 +105,11 @@ Decoder ::build(module::Encoder<B>* encoder) const
             if (this->implem == "STD")
                 return new module::Decoder_chase_std<B, Q>(this->K, this->N_cw, *encoder, this->flips, this->hamming);
         }
+        else if (this->type == "OSD")
+        {
+            if (this->implem == "STD")
+                return new module::Decoder_OSD_std<B, Q>(this->K, this->N_cw, *encoder, this->order, this->hamming);
+        }
     }
 
     throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
@@ -1,3 +1,5 @@
+#include <fstream>
+#include <sstream>
 #include <streampu.hpp>
 #include <utility>
 
@@ -5,6 +7,7 @@
 #include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered.hpp"
 #include "Module/Decoder/LDPC/BP/Vertical_layered/Decoder_LDPC_BP_vertical_layered.hpp"
 #include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
+#include "Tools/Code/LDPC/QC/QC.hpp"
 #include "Tools/Code/LDPC/Update_rule/AMS/Update_rule_AMS.hpp"
 #include "Tools/Code/LDPC/Update_rule/LSPA/Update_rule_LSPA.hpp"
 #include "Tools/Code/LDPC/Update_rule/MS/Update_rule_MS.hpp"
@@ -16,6 +19,7 @@
 #include "Tools/Math/max.h"
 #ifdef __cpp_aligned_new
 #include "Module/Decoder/LDPC/BP/Flooding/Decoder_LDPC_BP_flooding_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_QC.hpp"
 #include "Module/Decoder/LDPC/BP/Horizontal_layered/Decoder_LDPC_BP_horizontal_layered_inter.hpp"
 #include "Module/Decoder/LDPC/BP/Vertical_layered/Decoder_LDPC_BP_vertical_layered_inter.hpp"
 #include "Tools/Code/LDPC/Update_rule/AMS/Update_rule_AMS_simd.hpp"
@@ -119,8 +123,12 @@ Decoder_LDPC ::get_description(cli::Argument_map_info& args) const
 
     tools::add_arg(args, p, class_name + "p+simd", cli::Text(cli::Including_set("INTER", "INTRA")));
 
+    tools::add_arg(args, p, class_name + "p+lane-refill", cli::None());
+
     tools::add_arg(args, p, class_name + "p+min", cli::Text(cli::Including_set("MIN", "MINL", "MINS")));
 
+    tools::add_arg(args, p, class_name + "p+qc-z", cli::Integer(cli::Positive(), cli::Non_zero()));
+
     tools::add_arg(args, p, class_name + "p+h-reorder", cli::Text(cli::Including_set("NONE", "ASC", "DSC")));
 
     tools::add_arg(args, p, class_name + "p+ppbf-proba", cli::List<float, Real_splitter>(cli::Real(), cli::Length(1)));
@@ -141,13 +149,23 @@ Decoder_LDPC ::store(const cli::Argument_map_value& vals)
     if (vals.exist({ p + "-mwbf-factor" })) this->mwbf_factor = vals.to_float({ p + "-mwbf-factor" });
     if (vals.exist({ p + "-norm" })) this->norm_factor = vals.to_float({ p + "-norm" });
     if (vals.exist({ p + "-ppbf-proba" })) this->ppbf_proba = vals.to_list<float>({ p + "-ppbf-proba" });
+    if (vals.exist({ p + "-qc-z" })) this->Z = vals.to_int({ p + "-qc-z" });
     if (vals.exist({ p + "-no-synd" })) this->enable_syndrome = false;
+    if (vals.exist({ p + "-lane-refill" })) this->lane_refill = true;
 
     if (!this->H_path.empty())
     {
         int M;
         tools::LDPC_matrix_handler::read_matrix_size(this->H_path, M, this->N_cw);
         this->K = this->N_cw - M; // considered as regular so M = N - K
+
+        // the lifting size is given by the header of the QC files
+        if (this->Z == 0 &&
+            tools::LDPC_matrix_handler::get_matrix_format(this->H_path) == tools::LDPC_matrix_handler::Matrix_format::QC)
+        {
+            std::ifstream file(this->H_path);
+            this->Z = tools::QC::read_lifting_size(file);
+        }
     }
 
     Decoder::store(vals);
@@ -158,7 +176,7 @@ Decoder_LDPC ::get_headers(std::map<std::string, tools::header_list>& headers, c
 {
     Decoder::get_headers(headers, full);
 
-    if (this->type != "ML" && this->type != "CHASE")
+    if (this->type != "ML" && this->type != "CHASE" && this->type != "OSD")
     {
         auto p = this->get_prefix();
 
@@ -170,6 +188,12 @@ Decoder_LDPC ::get_headers(std::map<std::string, tools::header_list>& headers, c
 
         if (!this->simd_strategy.empty()) headers[p].push_back(std::make_pair("SIMD strategy", this->simd_strategy));
 
+        if (this->type == "BP_HORIZONTAL_LAYERED" && this->simd_strategy == "INTRA")
+            headers[p].push_back(std::make_pair("Lifting size (Z)", std::to_string(this->Z)));
+
+        if (this->simd_strategy == "INTER")
+            headers[p].push_back(std::make_pair("Lane refill", this->lane_refill ? "on" : "off"));
+
         headers[p].push_back(std::make_pair("Num. of iterations (i)", std::to_string(this->n_ite)));
 
         if (this->implem == "NMS")
@@ -201,12 +225,30 @@ Decoder_LDPC ::get_headers(std::map<std::string, tools::header_list>& headers, c
     }
 }
 
+void
+Decoder_LDPC ::check_lane_refill() const
+{
+    // the lane refill mode is implemented in all the inter frame BP decoders (see Decoder_LDPC_BP_lane_refill)
+    const auto supported = this->simd_strategy == "INTER" &&
+                           (this->type == "BP_HORIZONTAL_LAYERED" || this->type == "BP_HORIZONTAL_LAYERED_LEGACY" ||
+                            this->type == "BP_FLOODING" || this->type == "BP_VERTICAL_LAYERED");
+    if (this->lane_refill && !supported)
+    {
+        std::stringstream message;
+        message << "The lane refill mode requires a BP decoder with the 'INTER' SIMD strategy "
+                << "('type' = " << this->type << ", 'simd_strategy' = " << this->simd_strategy << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
 template<typename B, typename Q>
 module::Decoder_SISO<B, Q>*
 Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                           const std::vector<unsigned>& info_bits_pos,
                           module::Encoder<B>* encoder) const
 {
+    this->check_lane_refill();
+
     if (this->type == "BP_FLOODING" && this->simd_strategy.empty())
     {
         const auto max_CN_degree = (unsigned int)H.get_cols_max_degree();
@@ -504,7 +546,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
               info_bits_pos,
               tools::Update_rule_SPA_simd<Q>(max_CN_degree),
               this->enable_syndrome,
-              this->syndrome_depth);
+              this->syndrome_depth,
+              this->lane_refill);
         if (this->implem == "LSPA")
             return new module::Decoder_LDPC_BP_horizontal_layered_inter<B, Q, tools::Update_rule_LSPA_simd<Q>>(
               this->K,
@@ -514,7 +557,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
               info_bits_pos,
               tools::Update_rule_LSPA_simd<Q>(max_CN_degree),
               this->enable_syndrome,
-              this->syndrome_depth);
+              this->syndrome_depth,
+              this->lane_refill);
         if (this->implem == "MS")
             return new module::Decoder_LDPC_BP_horizontal_layered_inter<B, Q, tools::Update_rule_MS_simd<Q>>(
               this->K,
@@ -524,7 +568,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
               info_bits_pos,
               tools::Update_rule_MS_simd<Q>(),
               this->enable_syndrome,
-              this->syndrome_depth);
+              this->syndrome_depth,
+              this->lane_refill);
         if (this->implem == "OMS")
             return new module::Decoder_LDPC_BP_horizontal_layered_inter<B, Q, tools::Update_rule_OMS_simd<Q>>(
               this->K,
@@ -534,7 +579,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
               info_bits_pos,
               tools::Update_rule_OMS_simd<Q>(this->offset),
               this->enable_syndrome,
-              this->syndrome_depth);
+              this->syndrome_depth,
+              this->lane_refill);
         if (this->implem == "NMS")
         {
             if (typeid(Q) == typeid(int16_t) || typeid(Q) == typeid(int8_t))
@@ -549,7 +595,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                         info_bits_pos,
                         tools::Update_rule_NMS_simd<Q, 1>(this->norm_factor),
                         this->enable_syndrome,
-                        this->syndrome_depth);
+                        this->syndrome_depth,
+                        this->lane_refill);
                 if (this->norm_factor == 0.250f)
                     return new module::
                       Decoder_LDPC_BP_horizontal_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 2>>(
@@ -560,7 +607,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                         info_bits_pos,
                         tools::Update_rule_NMS_simd<Q, 2>(this->norm_factor),
                         this->enable_syndrome,
-                        this->syndrome_depth);
+                        this->syndrome_depth,
+                        this->lane_refill);
                 if (this->norm_factor == 0.375f)
                     return new module::
                       Decoder_LDPC_BP_horizontal_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 3>>(
@@ -571,7 +619,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                         info_bits_pos,
                         tools::Update_rule_NMS_simd<Q, 3>(this->norm_factor),
                         this->enable_syndrome,
-                        this->syndrome_depth);
+                        this->syndrome_depth,
+                        this->lane_refill);
                 if (this->norm_factor == 0.500f)
                     return new module::
                       Decoder_LDPC_BP_horizontal_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 4>>(
@@ -582,7 +631,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                         info_bits_pos,
                         tools::Update_rule_NMS_simd<Q, 4>(this->norm_factor),
                         this->enable_syndrome,
-                        this->syndrome_depth);
+                        this->syndrome_depth,
+                        this->lane_refill);
                 if (this->norm_factor == 0.625f)
                     return new module::
                       Decoder_LDPC_BP_horizontal_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 5>>(
@@ -593,7 +643,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                         info_bits_pos,
                         tools::Update_rule_NMS_simd<Q, 5>(this->norm_factor),
                         this->enable_syndrome,
-                        this->syndrome_depth);
+                        this->syndrome_depth,
+                        this->lane_refill);
                 if (this->norm_factor == 0.750f)
                     return new module::
                       Decoder_LDPC_BP_horizontal_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 6>>(
@@ -604,7 +655,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                         info_bits_pos,
                         tools::Update_rule_NMS_simd<Q, 6>(this->norm_factor),
                         this->enable_syndrome,
-                        this->syndrome_depth);
+                        this->syndrome_depth,
+                        this->lane_refill);
                 if (this->norm_factor == 0.875f)
                     return new module::
                       Decoder_LDPC_BP_horizontal_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 7>>(
@@ -615,7 +667,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                         info_bits_pos,
                         tools::Update_rule_NMS_simd<Q, 7>(this->norm_factor),
                         this->enable_syndrome,
-                        this->syndrome_depth);
+                        this->syndrome_depth,
+                        this->lane_refill);
                 if (this->norm_factor == 1.000f)
                     return new module::
                       Decoder_LDPC_BP_horizontal_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 8>>(
@@ -626,7 +679,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                         info_bits_pos,
                         tools::Update_rule_NMS_simd<Q, 8>(this->norm_factor),
                         this->enable_syndrome,
-                        this->syndrome_depth);
+                        this->syndrome_depth,
+                        this->lane_refill);
 
                 return new module::Decoder_LDPC_BP_horizontal_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q>>(
                   this->K,
@@ -636,7 +690,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                   info_bits_pos,
                   tools::Update_rule_NMS_simd<Q>(this->norm_factor),
                   this->enable_syndrome,
-                  this->syndrome_depth);
+                  this->syndrome_depth,
+                  this->lane_refill);
             }
             else
                 return new module::Decoder_LDPC_BP_horizontal_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q>>(
@@ -647,7 +702,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                   info_bits_pos,
                   tools::Update_rule_NMS_simd<Q>(this->norm_factor),
                   this->enable_syndrome,
-                  this->syndrome_depth);
+                  this->syndrome_depth,
+                  this->lane_refill);
         }
         else if (this->implem == "AMS")
         {
@@ -661,7 +717,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                     info_bits_pos,
                     tools::Update_rule_AMS_simd<Q, tools::min_i<Q>>(),
                     this->enable_syndrome,
-                    this->syndrome_depth);
+                    this->syndrome_depth,
+                    this->lane_refill);
             if (this->min == "MINL")
                 return new module::Decoder_LDPC_BP_horizontal_layered_inter<
                   B,
@@ -674,7 +731,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                   info_bits_pos,
                   tools::Update_rule_AMS_simd<Q, tools::min_star_linear2_i<Q>>(),
                   this->enable_syndrome,
-                  this->syndrome_depth);
+                  this->syndrome_depth,
+                  this->lane_refill);
             if (this->min == "MINS")
                 return new module::
                   Decoder_LDPC_BP_horizontal_layered_inter<B, Q, tools::Update_rule_AMS_simd<Q, tools::min_star_i<Q>>>(
@@ -685,7 +743,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                     info_bits_pos,
                     tools::Update_rule_AMS_simd<Q, tools::min_star_i<Q>>(),
                     this->enable_syndrome,
-                    this->syndrome_depth);
+                    this->syndrome_depth,
+                    this->lane_refill);
         }
     }
 #endif
@@ -704,7 +763,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                                                                                    1.f,
                                                                                    (Q)0,
                                                                                    this->enable_syndrome,
-                                                                                   this->syndrome_depth);
+                                                                                   this->syndrome_depth,
+                                                                                   this->lane_refill);
         if (this->implem == "NMS")
             return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, Q>(this->K,
                                                                                    this->N_cw,
@@ -714,7 +774,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                                                                                    this->norm_factor,
                                                                                    (Q)0,
                                                                                    this->enable_syndrome,
-                                                                                   this->syndrome_depth);
+                                                                                   this->syndrome_depth,
+                                                                                   this->lane_refill);
         if (this->implem == "OMS")
             return new module::Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, Q>(this->K,
                                                                                    this->N_cw,
@@ -724,7 +785,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                                                                                    1.f,
                                                                                    (Q)this->offset,
                                                                                    this->enable_syndrome,
-                                                                                   this->syndrome_depth);
+                                                                                   this->syndrome_depth,
+                                                                                   this->lane_refill);
     }
 #ifdef __cpp_aligned_new
     else if (this->type == "BP_FLOODING" && this->simd_strategy == "INTER")
@@ -740,7 +802,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
               info_bits_pos,
               tools::Update_rule_SPA_simd<Q>(max_CN_degree),
               this->enable_syndrome,
-              this->syndrome_depth);
+              this->syndrome_depth,
+              this->lane_refill);
         if (this->implem == "LSPA")
             return new module::Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_LSPA_simd<Q>>(
               this->K,
@@ -750,7 +813,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
               info_bits_pos,
               tools::Update_rule_LSPA_simd<Q>(max_CN_degree),
               this->enable_syndrome,
-              this->syndrome_depth);
+              this->syndrome_depth,
+              this->lane_refill);
         if (this->implem == "MS")
             return new module::Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_MS_simd<Q>>(
               this->K,
@@ -760,7 +824,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
               info_bits_pos,
               tools::Update_rule_MS_simd<Q>(),
               this->enable_syndrome,
-              this->syndrome_depth);
+              this->syndrome_depth,
+              this->lane_refill);
         if (this->implem == "OMS")
             return new module::Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_OMS_simd<Q>>(
               this->K,
@@ -770,7 +835,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
               info_bits_pos,
               tools::Update_rule_OMS_simd<Q>(this->offset),
               this->enable_syndrome,
-              this->syndrome_depth);
+              this->syndrome_depth,
+              this->lane_refill);
         if (this->implem == "NMS")
         {
             if (typeid(Q) == typeid(int16_t) || typeid(Q) == typeid(int8_t))
@@ -784,7 +850,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 1>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 0.250f)
                     return new module::Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_NMS_simd<Q, 2>>(
                       this->K,
@@ -794,7 +861,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 2>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 0.375f)
                     return new module::Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_NMS_simd<Q, 3>>(
                       this->K,
@@ -804,7 +872,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 3>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 0.500f)
                     return new module::Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_NMS_simd<Q, 4>>(
                       this->K,
@@ -814,7 +883,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 4>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 0.625f)
                     return new module::Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_NMS_simd<Q, 5>>(
                       this->K,
@@ -824,7 +894,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 5>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 0.750f)
                     return new module::Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_NMS_simd<Q, 6>>(
                       this->K,
@@ -834,7 +905,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 6>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 0.875f)
                     return new module::Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_NMS_simd<Q, 7>>(
                       this->K,
@@ -844,7 +916,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 7>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 1.000f)
                     return new module::Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_NMS_simd<Q, 8>>(
                       this->K,
@@ -854,7 +927,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 8>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
 
                 return new module::Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_NMS_simd<Q>>(
                   this->K,
@@ -864,7 +938,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                   info_bits_pos,
                   tools::Update_rule_NMS_simd<Q>(this->norm_factor),
                   this->enable_syndrome,
-                  this->syndrome_depth);
+                  this->syndrome_depth,
+                  this->lane_refill);
             }
             else
                 return new module::Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_NMS_simd<Q>>(
@@ -875,7 +950,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                   info_bits_pos,
                   tools::Update_rule_NMS_simd<Q>(this->norm_factor),
                   this->enable_syndrome,
-                  this->syndrome_depth);
+                  this->syndrome_depth,
+                  this->lane_refill);
         }
         else if (this->implem == "AMS")
         {
@@ -889,7 +965,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                     info_bits_pos,
                     tools::Update_rule_AMS_simd<Q, tools::min_i<Q>>(),
                     this->enable_syndrome,
-                    this->syndrome_depth);
+                    this->syndrome_depth,
+                    this->lane_refill);
             if (this->min == "MINL")
                 return new module::
                   Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_AMS_simd<Q, tools::min_star_linear2_i<Q>>>(
@@ -900,7 +977,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                     info_bits_pos,
                     tools::Update_rule_AMS_simd<Q, tools::min_star_linear2_i<Q>>(),
                     this->enable_syndrome,
-                    this->syndrome_depth);
+                    this->syndrome_depth,
+                    this->lane_refill);
             if (this->min == "MINS")
                 return new module::
                   Decoder_LDPC_BP_flooding_inter<B, Q, tools::Update_rule_AMS_simd<Q, tools::min_star_i<Q>>>(
@@ -911,7 +989,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                     info_bits_pos,
                     tools::Update_rule_AMS_simd<Q, tools::min_star_i<Q>>(),
                     this->enable_syndrome,
-                    this->syndrome_depth);
+                    this->syndrome_depth,
+                    this->lane_refill);
         }
     }
 #endif
@@ -929,7 +1008,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
               info_bits_pos,
               tools::Update_rule_SPA_simd<Q>(max_CN_degree),
               this->enable_syndrome,
-              this->syndrome_depth);
+              this->syndrome_depth,
+              this->lane_refill);
         if (this->implem == "LSPA")
             return new module::Decoder_LDPC_BP_vertical_layered_inter<B, Q, tools::Update_rule_LSPA_simd<Q>>(
               this->K,
@@ -939,7 +1019,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
               info_bits_pos,
               tools::Update_rule_LSPA_simd<Q>(max_CN_degree),
               this->enable_syndrome,
-              this->syndrome_depth);
+              this->syndrome_depth,
+              this->lane_refill);
         if (this->implem == "MS")
             return new module::Decoder_LDPC_BP_vertical_layered_inter<B, Q, tools::Update_rule_MS_simd<Q>>(
               this->K,
@@ -949,7 +1030,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
               info_bits_pos,
               tools::Update_rule_MS_simd<Q>(),
               this->enable_syndrome,
-              this->syndrome_depth);
+              this->syndrome_depth,
+              this->lane_refill);
         if (this->implem == "OMS")
             return new module::Decoder_LDPC_BP_vertical_layered_inter<B, Q, tools::Update_rule_OMS_simd<Q>>(
               this->K,
@@ -959,7 +1041,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
               info_bits_pos,
               tools::Update_rule_OMS_simd<Q>(this->offset),
               this->enable_syndrome,
-              this->syndrome_depth);
+              this->syndrome_depth,
+              this->lane_refill);
         if (this->implem == "NMS")
         {
             if (typeid(Q) == typeid(int16_t) || typeid(Q) == typeid(int8_t))
@@ -973,7 +1056,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 1>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 0.250f)
                     return new module::Decoder_LDPC_BP_vertical_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 2>>(
                       this->K,
@@ -983,7 +1067,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 2>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 0.375f)
                     return new module::Decoder_LDPC_BP_vertical_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 3>>(
                       this->K,
@@ -993,7 +1078,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 3>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 0.500f)
                     return new module::Decoder_LDPC_BP_vertical_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 4>>(
                       this->K,
@@ -1003,7 +1089,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 4>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 0.625f)
                     return new module::Decoder_LDPC_BP_vertical_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 5>>(
                       this->K,
@@ -1013,7 +1100,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 5>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 0.750f)
                     return new module::Decoder_LDPC_BP_vertical_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 6>>(
                       this->K,
@@ -1023,7 +1111,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 6>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 0.875f)
                     return new module::Decoder_LDPC_BP_vertical_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 7>>(
                       this->K,
@@ -1033,7 +1122,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 7>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
                 if (this->norm_factor == 1.000f)
                     return new module::Decoder_LDPC_BP_vertical_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q, 8>>(
                       this->K,
@@ -1043,7 +1133,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                       info_bits_pos,
                       tools::Update_rule_NMS_simd<Q, 8>(this->norm_factor),
                       this->enable_syndrome,
-                      this->syndrome_depth);
+                      this->syndrome_depth,
+                      this->lane_refill);
 
                 return new module::Decoder_LDPC_BP_vertical_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q>>(
                   this->K,
@@ -1053,7 +1144,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                   info_bits_pos,
                   tools::Update_rule_NMS_simd<Q>(this->norm_factor),
                   this->enable_syndrome,
-                  this->syndrome_depth);
+                  this->syndrome_depth,
+                  this->lane_refill);
             }
             else
                 return new module::Decoder_LDPC_BP_vertical_layered_inter<B, Q, tools::Update_rule_NMS_simd<Q>>(
@@ -1064,7 +1156,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                   info_bits_pos,
                   tools::Update_rule_NMS_simd<Q>(this->norm_factor),
                   this->enable_syndrome,
-                  this->syndrome_depth);
+                  this->syndrome_depth,
+                  this->lane_refill);
         }
         else if (this->implem == "AMS")
         {
@@ -1078,7 +1171,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                     info_bits_pos,
                     tools::Update_rule_AMS_simd<Q, tools::min_i<Q>>(),
                     this->enable_syndrome,
-                    this->syndrome_depth);
+                    this->syndrome_depth,
+                    this->lane_refill);
             if (this->min == "MINL")
                 return new module::Decoder_LDPC_BP_vertical_layered_inter<
                   B,
@@ -1091,7 +1185,8 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                   info_bits_pos,
                   tools::Update_rule_AMS_simd<Q, tools::min_star_linear2_i<Q>>(),
                   this->enable_syndrome,
-                  this->syndrome_depth);
+                  this->syndrome_depth,
+                  this->lane_refill);
             if (this->min == "MINS")
                 return new module::
                   Decoder_LDPC_BP_vertical_layered_inter<B, Q, tools::Update_rule_AMS_simd<Q, tools::min_star_i<Q>>>(
@@ -1102,7 +1197,118 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                     info_bits_pos,
                     tools::Update_rule_AMS_simd<Q, tools::min_star_i<Q>>(),
                     this->enable_syndrome,
-                    this->syndrome_depth);
+                    this->syndrome_depth,
+                    this->lane_refill);
+        }
+    }
+#ifdef __cpp_aligned_new
+    else if (this->type == "BP_HORIZONTAL_LAYERED" && this->simd_strategy == "INTRA")
+    {
+        const auto max_CN_degree = (unsigned int)H.get_cols_max_degree();
+
+        if (this->implem == "SPA")
+            return new module::Decoder_LDPC_BP_horizontal_layered_QC<B, Q, tools::Update_rule_SPA_simd<Q>>(
+              this->K,
+              this->N_cw,
+              this->n_ite,
+              H,
+              info_bits_pos,
+              this->Z,
+              tools::Update_rule_SPA_simd<Q>(max_CN_degree),
+              this->enable_syndrome,
+              this->syndrome_depth,
+              this->lane_refill);
+        if (this->implem == "LSPA")
+            return new module::Decoder_LDPC_BP_horizontal_layered_QC<B, Q, tools::Update_rule_LSPA_simd<Q>>(
+              this->K,
+              this->N_cw,
+              this->n_ite,
+              H,
+              info_bits_pos,
+              this->Z,
+              tools::Update_rule_LSPA_simd<Q>(max_CN_degree),
+              this->enable_syndrome,
+              this->syndrome_depth,
+              this->lane_refill);
+        if (this->implem == "MS")
+            return new module::Decoder_LDPC_BP_horizontal_layered_QC<B, Q, tools::Update_rule_MS_simd<Q>>(
+              this->K,
+              this->N_cw,
+              this->n_ite,
+              H,
+              info_bits_pos,
+              this->Z,
+              tools::Update_rule_MS_simd<Q>(),
+              this->enable_syndrome,
+              this->syndrome_depth,
+              this->lane_refill);
+        if (this->implem == "OMS")
+            return new module::Decoder_LDPC_BP_horizontal_layered_QC<B, Q, tools::Update_rule_OMS_simd<Q>>(
+              this->K,
+              this->N_cw,
+              this->n_ite,
+              H,
+              info_bits_pos,
+              this->Z,
+              tools::Update_rule_OMS_simd<Q>(this->offset),
+              this->enable_syndrome,
+              this->syndrome_depth,
+              this->lane_refill);
+        if (this->implem == "NMS")
+            return new module::Decoder_LDPC_BP_horizontal_layered_QC<B, Q, tools::Update_rule_NMS_simd<Q>>(
+              this->K,
+              this->N_cw,
+              this->n_ite,
+              H,
+              info_bits_pos,
+              this->Z,
+              tools::Update_rule_NMS_simd<Q>(this->norm_factor),
+              this->enable_syndrome,
+              this->syndrome_depth,
+              this->lane_refill);
+        if (this->implem == "AMS")
+        {
+            if (this->min == "MIN")
+                return new module::
+                  Decoder_LDPC_BP_horizontal_layered_QC<B, Q, tools::Update_rule_AMS_simd<Q, tools::min_i<Q>>>(
+                    this->K,
+                    this->N_cw,
+                    this->n_ite,
+                    H,
+                    info_bits_pos,
+                    this->Z,
+                    tools::Update_rule_AMS_simd<Q, tools::min_i<Q>>(),
+                    this->enable_syndrome,
+                    this->syndrome_depth,
+                    this->lane_refill);
+            if (this->min == "MINL")
+                return new module::Decoder_LDPC_BP_horizontal_layered_QC<
+                  B,
+                  Q,
+                  tools::Update_rule_AMS_simd<Q, tools::min_star_linear2_i<Q>>>(
+                  this->K,
+                  this->N_cw,
+                  this->n_ite,
+                  H,
+                  info_bits_pos,
+                  this->Z,
+                  tools::Update_rule_AMS_simd<Q, tools::min_star_linear2_i<Q>>(),
+                  this->enable_syndrome,
+                  this->syndrome_depth,
+                  this->lane_refill);
+            if (this->min == "MINS")
+                return new module::
+                  Decoder_LDPC_BP_horizontal_layered_QC<B, Q, tools::Update_rule_AMS_simd<Q, tools::min_star_i<Q>>>(
+                    this->K,
+                    this->N_cw,
+                    this->n_ite,
+                    H,
+                    info_bits_pos,
+                    this->Z,
+                    tools::Update_rule_AMS_simd<Q, tools::min_star_i<Q>>(),
+                    this->enable_syndrome,
+                    this->syndrome_depth,
+                    this->lane_refill);
         }
     }
 #endif
@@ -1122,6 +1328,8 @@ Decoder_LDPC ::build(const tools::Sparse_matrix& H,
                      const std::vector<unsigned>& info_bits_pos,
                      module::Encoder<B>* encoder) const
 {
+    this->check_lane_refill();
+
     try
     {
         return Decoder::build<B, Q>(encoder);
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <streampu.hpp>
 #include <utility>
@@ -32,6 +33,7 @@
 #include "Tools/Code/Polar/API/API_polar_static_inter_8bit_bitpacking.hpp"
 #include "Tools/Code/Polar/API/API_polar_static_intra_16bit.hpp"
 #include "Tools/Code/Polar/API/API_polar_static_intra_32bit.hpp"
+#include "Tools/Code/Polar/API/API_polar_static_intra_64bit.hpp"
 #include "Tools/Code/Polar/API/API_polar_static_intra_8bit.hpp"
 #include "Tools/Code/Polar/API/API_polar_static_seq.hpp"
 #endif
@@ -111,7 +113,7 @@ Decoder_polar ::get_headers(std::map<std::string, tools::header_list>& headers,
 {
     Decoder::get_headers(headers, full);
 
-    if (this->type != "ML" && this->type != "CHASE")
+    if (this->type != "ML" && this->type != "CHASE" && this->type != "OSD")
     {
         auto p = this->get_prefix();
 
@@ -310,6 +312,10 @@ Decoder_polar ::build(const std::vector<bool>& frozen_bits,
                 {
                     return _build_scl_fast<B, Q, tools::API_polar_dynamic_intra<B, Q>>(frozen_bits, crc, encoder);
                 }
+                else if (typeid(B) == typeid(int64_t))
+                {
+                    return _build_scl_fast<B, Q, tools::API_polar_dynamic_intra<B, Q>>(frozen_bits, crc, encoder);
+                }
             }
             else if (this->simd_strategy.empty())
             {
@@ -372,6 +378,15 @@ Decoder_polar ::build(const std::vector<bool>& frozen_bits,
                 using API_polar = tools::API_polar_dynamic_intra<B, Q>;
 #else
                 using API_polar = tools::API_polar_static_intra_32bit<B, Q>;
+#endif
+                return _build<B, Q, API_polar>(frozen_bits, crc, encoder);
+            }
+            else if (typeid(B) == typeid(int64_t))
+            {
+#ifdef API_POLAR_DYNAMIC
+                using API_polar = tools::API_polar_dynamic_intra<B, Q>;
+#else
+                using API_polar = tools::API_polar_static_intra_64bit<B, Q>;
 #endif
                 return _build<B, Q, API_polar>(frozen_bits, crc, encoder);
             }
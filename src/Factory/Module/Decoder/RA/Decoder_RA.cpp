@@ -109,7 +109,7 @@ Decoder_RA ::get_headers(std::map<std::string, tools::header_list>& headers, con
 
     if (itl != nullptr) itl->get_headers(headers, full);
 
-    if (this->type != "ML" && this->type != "CHASE")
+    if (this->type != "ML" && this->type != "CHASE" && this->type != "OSD")
     {
         auto p = this->get_prefix();
 
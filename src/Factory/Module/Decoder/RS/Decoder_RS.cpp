@@ -76,7 +76,7 @@ Decoder_RS ::get_headers(std::map<std::string, tools::header_list>& headers, con
 {
     Decoder::get_headers(headers, full);
 
-    if (this->type != "ML" && this->type != "CHASE")
+    if (this->type != "ML" && this->type != "CHASE" && this->type != "OSD")
     {
         auto p = this->get_prefix();
 
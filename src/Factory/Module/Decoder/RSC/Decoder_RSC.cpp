@@ -20,6 +20,7 @@
 #include "Module/Decoder/RSC/BCJR/Seq/Decoder_RSC_BCJR_seq_very_fast.hpp"
 #include "Module/Decoder/RSC/BCJR/Seq_generic/Decoder_RSC_BCJR_seq_generic_std.hpp"
 #include "Module/Decoder/RSC/BCJR/Seq_generic/Decoder_RSC_BCJR_seq_generic_std_json.hpp"
+#include "Module/Decoder/RSC/BCJR/Subblock/Decoder_RSC_BCJR_subblock.hpp"
 #include "Module/Decoder/RSC/Viterbi/Decoder_Viterbi_SIHO.hpp"
 #include "Module/Decoder/RSC/Viterbi_list/Decoder_Viterbi_list_parallel.hpp"
 #include "Tools/Documentation/documentation.h"
@@ -54,7 +55,7 @@ Decoder_RSC ::get_description(cli::Argument_map_info& args) const
     args.erase({ p + "-cw-size", "N" });
 
     cli::add_options(args.at({ p + "-type", "D" }), 0, "BCJR", "VITERBI", "PLVA");
-    cli::add_options(args.at({ p + "-implem" }), 0, "GENERIC", "FAST", "VERY_FAST");
+    cli::add_options(args.at({ p + "-implem" }), 0, "GENERIC", "FAST", "VERY_FAST", "SUBBLOCK");
 
     tools::add_arg(args, p, class_name + "p+simd", cli::Text(cli::Including_set("INTRA", "INTER")));
 
@@ -115,7 +116,7 @@ Decoder_RSC ::get_headers(std::map<std::string, tools::header_list>& headers, co
 {
     Decoder::get_headers(headers, full);
 
-    if (this->type != "ML" && this->type != "CHASE")
+    if (this->type != "ML" && this->type != "CHASE" && this->type != "OSD")
     {
         auto p = this->get_prefix();
 
@@ -170,6 +171,9 @@ template<typename B, typename Q, typename QD, tools::proto_max_i<Q> MAX>
 module::Decoder_SISO<B, Q>*
 Decoder_RSC ::_build_siso_simd(const std::vector<std::vector<int>>& trellis, module::Encoder<B>* encoder) const
 {
+    if (this->type == "BCJR" && this->implem == "SUBBLOCK")
+        return new module::Decoder_RSC_BCJR_subblock<B, Q, MAX>(this->K, trellis, this->buffered);
+
     if (this->type == "BCJR" && this->simd_strategy == "INTER")
     {
         if (this->implem == "STD")
@@ -240,7 +244,7 @@ Decoder_RSC ::build_siso(const std::vector<std::vector<int>>& trellis,
 {
     using QD = typename std::conditional<std::is_same<Q, int8_t>::value, int16_t, Q>::type;
 
-    if (this->simd_strategy.empty())
+    if (this->simd_strategy.empty() && this->implem != "SUBBLOCK")
     {
         if (this->max == "MAX")
             return _build_siso_seq<B, Q, QD, tools::max<Q>, tools::max<QD>>(trellis, stream, n_ite, encoder);
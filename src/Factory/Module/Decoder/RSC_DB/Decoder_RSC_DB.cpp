@@ -63,7 +63,7 @@ Decoder_RSC_DB ::get_headers(std::map<std::string, tools::header_list>& headers,
 {
     Decoder::get_headers(headers, full);
 
-    if (this->type != "ML" && this->type != "CHASE")
+    if (this->type != "ML" && this->type != "CHASE" && this->type != "OSD")
     {
         auto p = this->get_prefix();
 
@@ -54,7 +54,7 @@ Decoder_repetition ::get_headers(std::map<std::string, tools::header_list>& head
 {
     Decoder::get_headers(headers, full);
 
-    if (this->type != "ML" && this->type != "CHASE")
+    if (this->type != "ML" && this->type != "CHASE" && this->type != "OSD")
     {
         auto p = this->get_prefix();
 
@@ -214,7 +214,7 @@ Decoder_turbo_DB ::get_headers(std::map<std::string, tools::header_list>& header
 {
     Decoder::get_headers(headers, full);
 
-    if (this->type != "ML" && this->type != "CHASE")
+    if (this->type != "ML" && this->type != "CHASE" && this->type != "OSD")
     {
         auto p = this->get_prefix();
 
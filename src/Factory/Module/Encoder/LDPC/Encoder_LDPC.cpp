@@ -7,6 +7,7 @@
 #include "Module/Encoder/LDPC/From_H/Encoder_LDPC_from_H.hpp"
 #include "Module/Encoder/LDPC/From_IRA/Encoder_LDPC_from_IRA.hpp"
 #include "Module/Encoder/LDPC/From_QC/Encoder_LDPC_from_QC.hpp"
+#include "Module/Encoder/LDPC/NR/Encoder_LDPC_NR.hpp"
 #include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
 #include "Tools/Display/rang_format/rang_format.h"
 #include "Tools/Documentation/documentation.h"
@@ -37,7 +38,7 @@ Encoder_LDPC ::get_description(cli::Argument_map_info& args) const
     auto p = this->get_prefix();
     const std::string class_name = "factory::Encoder_LDPC::";
 
-    cli::add_options(args.at({ p + "-type" }), 0, "LDPC", "LDPC_H", "LDPC_DVBS2", "LDPC_QC", "LDPC_IRA");
+    cli::add_options(args.at({ p + "-type" }), 0, "LDPC", "LDPC_H", "LDPC_DVBS2", "LDPC_QC", "LDPC_IRA", "LDPC_NR");
 
     tools::add_arg(args, p, class_name + "p+h-path", cli::File(cli::openmode::read));
 
@@ -52,9 +53,13 @@ Encoder_LDPC ::get_description(cli::Argument_map_info& args) const
 
     tools::add_arg(args, p, class_name + "p+h-reorder", cli::Text(cli::Including_set("NONE", "ASC", "DSC")));
 
-    tools::add_arg(args, p, class_name + "p+g-method", cli::Text(cli::Including_set("IDENTITY", "LU_DEC")));
+    tools::add_arg(args, p, class_name + "p+g-method", cli::Text(cli::Including_set("IDENTITY", "LU_DEC", "RU")));
 
-    tools::add_arg(args, p, class_name + "p+g-save-path", cli::File(cli::openmode::write));
+    tools::add_arg(args, p, class_name + "p+g-save-path", cli::File(cli::openmode::read_write));
+
+    tools::add_arg(args, p, class_name + "p+nr-bg", cli::Integer(cli::Including_set(1, 2)));
+
+    tools::add_arg(args, p, class_name + "p+nr-bg-path", cli::File(cli::openmode::read));
 }
 
 void
@@ -67,6 +72,8 @@ Encoder_LDPC ::store(const cli::Argument_map_value& vals)
     if (vals.exist({ p + "-h-reorder" })) this->H_reorder = vals.at({ p + "-h-reorder" });
     if (vals.exist({ p + "-g-method" })) this->G_method = vals.at({ p + "-g-method" });
     if (vals.exist({ p + "-g-save-path" })) this->G_save_path = vals.at({ p + "-g-save-path" });
+    if (vals.exist({ p + "-nr-bg" })) this->NR_BG = vals.to_int({ p + "-nr-bg" });
+    if (vals.exist({ p + "-nr-bg-path" })) this->NR_bg_path = vals.to_file({ p + "-nr-bg-path" });
 
     if (!this->G_path.empty())
     {
@@ -102,6 +109,12 @@ Encoder_LDPC ::get_headers(std::map<std::string, tools::header_list>& headers, c
         headers[p].push_back(std::make_pair("G build method", this->G_method));
         if (this->G_save_path != "") headers[p].push_back(std::make_pair("G save path", this->G_save_path));
     }
+
+    if (this->type == "LDPC_NR")
+    {
+        headers[p].push_back(std::make_pair("Base graph", this->NR_BG ? std::to_string(this->NR_BG) : "auto"));
+        headers[p].push_back(std::make_pair("Base graph path", this->NR_bg_path));
+    }
 }
 
 template<typename B>
@@ -128,6 +141,15 @@ Encoder_LDPC ::build(const tools::Sparse_matrix& G,
     return build<B>(G, H);
 }
 
+template<typename B>
+module::Encoder_LDPC<B>*
+Encoder_LDPC ::build(const tools::Sparse_matrix& G, const tools::Sparse_matrix& H, const tools::nr_values& nr) const
+{
+    if (this->type == "LDPC_NR") return new module::Encoder_LDPC_NR<B>(H, nr);
+
+    return build<B>(G, H);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -160,6 +182,23 @@ template aff3ct::module::Encoder_LDPC<B_64>*
 aff3ct::factory::Encoder_LDPC::build<B_64>(const aff3ct::tools::Sparse_matrix&,
                                            const aff3ct::tools::Sparse_matrix&,
                                            const tools::dvbs2_values&) const;
+
+template aff3ct::module::Encoder_LDPC<B_8>*
+aff3ct::factory::Encoder_LDPC::build<B_8>(const aff3ct::tools::Sparse_matrix&,
+                                          const aff3ct::tools::Sparse_matrix&,
+                                          const tools::nr_values&) const;
+template aff3ct::module::Encoder_LDPC<B_16>*
+aff3ct::factory::Encoder_LDPC::build<B_16>(const aff3ct::tools::Sparse_matrix&,
+                                           const aff3ct::tools::Sparse_matrix&,
+                                           const tools::nr_values&) const;
+template aff3ct::module::Encoder_LDPC<B_32>*
+aff3ct::factory::Encoder_LDPC::build<B_32>(const aff3ct::tools::Sparse_matrix&,
+                                           const aff3ct::tools::Sparse_matrix&,
+                                           const tools::nr_values&) const;
+template aff3ct::module::Encoder_LDPC<B_64>*
+aff3ct::factory::Encoder_LDPC::build<B_64>(const aff3ct::tools::Sparse_matrix&,
+                                           const aff3ct::tools::Sparse_matrix&,
+                                           const tools::nr_values&) const;
 #else
 template aff3ct::module::Encoder_LDPC<B>*
 aff3ct::factory::Encoder_LDPC::build<B>(const aff3ct::tools::Sparse_matrix&, const aff3ct::tools::Sparse_matrix&) const;
@@ -168,5 +207,10 @@ template aff3ct::module::Encoder_LDPC<B>*
 aff3ct::factory::Encoder_LDPC::build<B>(const aff3ct::tools::Sparse_matrix&,
                                         const aff3ct::tools::Sparse_matrix&,
                                         const tools::dvbs2_values&) const;
+
+template aff3ct::module::Encoder_LDPC<B>*
+aff3ct::factory::Encoder_LDPC::build<B>(const aff3ct::tools::Sparse_matrix&,
+                                        const aff3ct::tools::Sparse_matrix&,
+                                        const tools::nr_values&) const;
 #endif
 // ==================================================================================== explicit template instantiation
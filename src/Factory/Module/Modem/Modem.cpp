@@ -9,12 +9,14 @@
 #include "Module/Modem/CPM/Modem_CPM.hpp"
 #include "Module/Modem/Generic/Modem_generic.hpp"
 #include "Module/Modem/Generic/Modem_generic_fast.hpp"
+#include "Module/Modem/Generic/Modem_generic_sector.hpp"
 #include "Module/Modem/OOK/Modem_OOK_AWGN.hpp"
 #include "Module/Modem/OOK/Modem_OOK_BEC.hpp"
 #include "Module/Modem/OOK/Modem_OOK_BSC.hpp"
 #include "Module/Modem/OOK/Modem_OOK_optical.hpp"
 #include "Module/Modem/OOK/Modem_OOK_optical_rop_estimate.hpp"
 #include "Module/Modem/SCMA/Modem_SCMA.hpp"
+#include "Module/Modem/SCMA/Modem_SCMA_log.hpp"
 #include "Tools/Code/SCMA/Codebook.hpp"
 #include "Tools/Code/SCMA/modem_SCMA_functions.hpp"
 #include "Tools/Constellation/PAM/Constellation_PAM.hpp"
@@ -55,7 +57,7 @@ Modem ::get_description(cli::Argument_map_info& args) const
                    class_name + "p+type",
                    cli::Text(cli::Including_set("BPSK", "OOK", "PSK", "PAM", "QAM", "CPM", "USER", "SCMA")));
 
-    tools::add_arg(args, p, class_name + "p+implem", cli::Text(cli::Including_set("STD", "FAST")));
+    tools::add_arg(args, p, class_name + "p+implem", cli::Text(cli::Including_set("STD", "FAST", "SECTOR")));
 
     tools::add_arg(args, p, class_name + "p+bps", cli::Integer(cli::Positive(), cli::Non_zero()));
 
@@ -86,6 +88,8 @@ Modem ::get_description(cli::Argument_map_info& args) const
 
     tools::add_arg(args, p, class_name + "p+ite", cli::Integer(cli::Positive(), cli::Non_zero()));
 
+    tools::add_arg(args, p, class_name + "p+fxp", cli::None());
+
     tools::add_arg(args, p, class_name + "p+rop-est", cli::Integer(cli::Positive()));
 }
 
@@ -167,6 +171,7 @@ Modem ::store(const cli::Argument_map_value& vals)
     if (vals.exist({ p + "-ite" })) this->n_ite = vals.to_int({ p + "-ite" });
     if (vals.exist({ p + "-max" })) this->max = vals.at({ p + "-max" });
     if (vals.exist({ p + "-psi" })) this->psi = vals.at({ p + "-psi" });
+    if (vals.exist({ p + "-fxp" })) this->fxp = true;
 }
 
 void
@@ -204,7 +209,10 @@ Modem ::get_headers(std::map<std::string, tools::header_list>& headers, const bo
     if (this->type == "SCMA")
     {
         headers[p].push_back(std::make_pair("Number of iterations", demod_ite));
-        headers[p].push_back(std::make_pair("Psi function", demod_psi));
+        if (this->implem == "FAST")
+            headers[p].push_back(std::make_pair("Fixed-point messages", this->fxp ? "on" : "off"));
+        else
+            headers[p].push_back(std::make_pair("Psi function", demod_psi));
         headers[p].push_back(std::make_pair("Codebook", codebook_path));
     }
 
@@ -252,6 +260,8 @@ Modem ::_build(const tools::Constellation<R>* cstl) const
     {
         if (this->implem == "FAST")
             return new module::Modem_generic_fast<B, R, Q, MAX, MAXI>(N, *cstl, this->no_sig2);
+        else if (this->implem == "SECTOR")
+            return new module::Modem_generic_sector<B, R, Q, MAX, MAXI>(N, *cstl, this->no_sig2);
         else
             return new module::Modem_generic<B, R, Q, MAX>(N, *cstl, this->no_sig2);
     }
@@ -287,6 +297,14 @@ Modem ::build(const tools::Constellation<R>* cstl) const
     {
         return _build_scma<B, R, Q>();
     }
+    else if (this->type == "SCMA" && this->implem == "FAST")
+    {
+        if (this->fxp)
+            return new module::Modem_SCMA_log<B, R, Q, int16_t>(
+              this->N, this->codebook_path, this->no_sig2, this->n_ite);
+        else
+            return new module::Modem_SCMA_log<B, R, Q, float>(this->N, this->codebook_path, this->no_sig2, this->n_ite);
+    }
     else if (this->type == "OOK" && this->implem == "STD")
     {
         if (channel_type == "AWGN") return new module::Modem_OOK_AWGN<B, R, Q>(this->N, this->no_sig2);
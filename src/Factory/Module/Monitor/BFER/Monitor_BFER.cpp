@@ -71,10 +71,11 @@ Monitor_BFER ::get_headers(std::map<std::string, tools::header_list>& headers, c
 
 template<typename B>
 module::Monitor_BFER<B>*
-Monitor_BFER ::build(bool count_unknown_values) const
+Monitor_BFER ::build(bool count_unknown_values, bool importance_sampling) const
 {
     if (this->type == "STD")
-        return new module::Monitor_BFER<B>(this->K, this->n_frame_errors, this->max_frame, count_unknown_values);
+        return new module::Monitor_BFER<B>(
+          this->K, this->n_frame_errors, this->max_frame, count_unknown_values, importance_sampling);
 
     throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -83,14 +84,14 @@ Monitor_BFER ::build(bool count_unknown_values) const
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
 template aff3ct::module::Monitor_BFER<B_8>*
-aff3ct::factory::Monitor_BFER::build<B_8>(bool) const;
+aff3ct::factory::Monitor_BFER::build<B_8>(bool, bool) const;
 template aff3ct::module::Monitor_BFER<B_16>*
-aff3ct::factory::Monitor_BFER::build<B_16>(bool) const;
+aff3ct::factory::Monitor_BFER::build<B_16>(bool, bool) const;
 template aff3ct::module::Monitor_BFER<B_32>*
-aff3ct::factory::Monitor_BFER::build<B_32>(bool) const;
+aff3ct::factory::Monitor_BFER::build<B_32>(bool, bool) const;
 template aff3ct::module::Monitor_BFER<B_64>*
-aff3ct::factory::Monitor_BFER::build<B_64>(bool) const;
+aff3ct::factory::Monitor_BFER::build<B_64>(bool, bool) const;
 #else
 template aff3ct::module::Monitor_BFER<B>*
-aff3ct::factory::Monitor_BFER::build<B>(bool) const;
+aff3ct::factory::Monitor_BFER::build<B>(bool, bool) const;
 #endif
\ No newline at end of file
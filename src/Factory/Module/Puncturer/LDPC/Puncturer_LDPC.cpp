@@ -5,6 +5,7 @@
 
 #include "Factory/Module/Puncturer/LDPC/Puncturer_LDPC.hpp"
 #include "Module/Puncturer/LDPC/Puncturer_LDPC.hpp"
+#include "Module/Puncturer/LDPC/Puncturer_LDPC_NR.hpp"
 #include "Module/Puncturer/NO/Puncturer_NO.hpp"
 #include "Tools/Documentation/documentation.h"
 #include "Tools/general_utils.h"
@@ -38,9 +39,13 @@ Puncturer_LDPC ::get_description(cli::Argument_map_info& args) const
     tools::add_arg(
       args, p, class_name + "p+cw-size,N_cw", cli::Integer(cli::Positive(), cli::Non_zero()), cli::arg_rank::REQ);
 
-    cli::add_options(args.at({ p + "-type" }), 0, "LDPC");
+    cli::add_options(args.at({ p + "-type" }), 0, "LDPC", "LDPC_NR");
 
     tools::add_arg(args, p, class_name + "p+pattern", cli::Text());
+
+    tools::add_arg(args, p, class_name + "p+rv", cli::Integer(cli::Including_set(0, 1, 2, 3)));
+
+    tools::add_arg(args, p, class_name + "p+cb-size", cli::Integer(cli::Positive(), cli::Non_zero()));
 }
 
 std::vector<bool>
@@ -84,6 +89,8 @@ Puncturer_LDPC ::store(const cli::Argument_map_value& vals)
     }
 
     if (vals.exist({ p + "-cw-size", "N_cw" })) this->N_cw = vals.to_int({ p + "-cw-size", "N_cw" });
+    if (vals.exist({ p + "-rv" })) this->NR_rv = vals.to_int({ p + "-rv" });
+    if (vals.exist({ p + "-cb-size" })) this->NR_N_cb = vals.to_int({ p + "-cb-size" });
 
     if (this->N == this->N_cw) this->type = "NO";
 }
@@ -95,7 +102,13 @@ Puncturer_LDPC ::get_headers(std::map<std::string, tools::header_list>& headers,
 
     auto p = this->get_prefix();
 
-    if (this->type != "NO")
+    if (this->type == "LDPC_NR")
+    {
+        headers[p].push_back(std::make_pair(std::string("Redundancy version"), std::to_string(this->NR_rv)));
+        headers[p].push_back(std::make_pair(std::string("Circular buffer size"),
+                                            this->NR_N_cb ? std::to_string(this->NR_N_cb) : std::string("full")));
+    }
+    else if (this->type != "NO")
     {
         std::stringstream pat;
         for (auto p : this->pattern)
@@ -110,6 +123,9 @@ module::Puncturer<B, Q>*
 Puncturer_LDPC ::build() const
 {
     if (this->type == "LDPC") return new module::Puncturer_LDPC<B, Q>(this->K, this->N, this->N_cw, this->pattern);
+    if (this->type == "LDPC_NR")
+        return new module::Puncturer_LDPC_NR<B, Q>(
+          this->K, this->N, this->N_cw, this->NR_BG, this->NR_Z, this->NR_rv, this->NR_N_cb);
 
     throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
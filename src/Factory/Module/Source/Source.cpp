@@ -84,14 +84,17 @@ template<typename B>
 spu::module::Source<B>*
 Source ::build() const
 {
+    // only the fast random source can generate packed bits
     if (this->type == "RAND")
     {
-        if (this->implem == "STD")
+        if (this->implem == "STD" && !this->packed)
             return new spu::module::Source_random<B>(this->K, this->seed);
         else if (this->implem == "FAST")
-            return new module::Source_random_fast<B>(this->K, this->seed);
+            return new module::Source_random_fast<B>(this->K, this->seed, this->packed);
     }
 
+    if (this->packed) throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
+
     if (this->type == "AZCW") return new spu::module::Source_AZCW<B>(this->K);
     if (this->type == "USER") return new spu::module::Source_user<B>(this->K, this->path, this->start_idx);
 
@@ -225,8 +225,15 @@ BFER ::get_description(cli::Argument_map_info& args) const
     tools::add_arg(
       args, p, class_name + "p+err-trk-thold", cli::Integer(cli::Positive(), cli::Non_zero()), cli::arg_rank::ADV);
 
+    tools::add_arg(
+      args, p, class_name + "p+err-trk-buff", cli::Integer(cli::Positive(), cli::Non_zero()), cli::arg_rank::ADV);
+
     tools::add_arg(args, p, class_name + "p+coded", cli::None());
 
+#ifndef AFF3CT_MPI
+    tools::add_arg(args, p, class_name + "p+conc-noise", cli::Integer(cli::Positive(), cli::Non_zero()));
+#endif
+
     auto pter = ter->get_prefix();
 
     tools::add_arg(args, pter, class_name + "p+sigma", cli::None());
@@ -244,6 +251,15 @@ BFER ::get_description(cli::Argument_map_info& args) const
 #endif
 
     tools::add_arg(args, p, class_name + "p+sequence-path", cli::File(cli::openmode::write), cli::arg_rank::ADV);
+
+    tools::add_arg(args, p, class_name + "p+chkpt-path", cli::File(cli::openmode::read_write), cli::arg_rank::ADV);
+
+    tools::add_arg(
+      args, p, class_name + "p+chkpt-freq", cli::Integer(cli::Positive(), cli::Non_zero()), cli::arg_rank::ADV);
+
+    tools::add_arg(args, p, class_name + "p+resume", cli::None(), cli::arg_rank::ADV);
+
+    tools::add_arg(args, p, class_name + "p+cache-path", cli::File(cli::openmode::read_write), cli::arg_rank::ADV);
 }
 
 void
@@ -258,6 +274,7 @@ BFER ::store(const cli::Argument_map_value& vals)
 
     if (vals.exist({ p + "-err-trk-path" })) this->err_track_path = vals.at({ p + "-err-trk-path" });
     if (vals.exist({ p + "-err-trk-thold" })) this->err_track_threshold = vals.to_int({ p + "-err-trk-thold" });
+    if (vals.exist({ p + "-err-trk-buff" })) this->err_track_buffer = vals.to_int({ p + "-err-trk-buff" });
     if (vals.exist({ p + "-err-trk-rev" })) this->err_track_revert = true;
     if (vals.exist({ p + "-err-trk" })) this->err_track_enable = true;
     if (vals.exist({ p + "-coset", "c" })) this->coset = true;
@@ -267,6 +284,13 @@ BFER ::store(const cli::Argument_map_value& vals)
         this->coded_monitoring = true;
 
     if (vals.exist({ p + "-sequence-path" })) this->sequence_path = vals.at({ p + "-sequence-path" });
+    if (vals.exist({ p + "-chkpt-path" })) this->chkpt_path = vals.at({ p + "-chkpt-path" });
+    if (vals.exist({ p + "-chkpt-freq" })) this->chkpt_freq = seconds(vals.to_int({ p + "-chkpt-freq" }));
+    if (vals.exist({ p + "-resume" })) this->resume = true;
+    if (vals.exist({ p + "-cache-path" })) this->cache_path = vals.at({ p + "-cache-path" });
+#ifndef AFF3CT_MPI
+    if (vals.exist({ p + "-conc-noise" })) this->conc_noise = vals.to_int({ p + "-conc-noise" });
+#endif
 
     if (this->err_track_revert)
     {
@@ -274,6 +298,8 @@ BFER ::store(const cli::Argument_map_value& vals)
         this->n_threads = 1;
     }
 
+    if (this->conc_noise > this->n_threads) this->conc_noise = this->n_threads;
+
     auto pter = ter->get_prefix();
 
     if (vals.exist({ pter + "-sigma" })) this->ter_sigma = true;
@@ -320,6 +346,10 @@ BFER ::get_headers(std::map<std::string, tools::header_list>& headers, const boo
 
     headers[p].push_back(std::make_pair("Coset approach (c)", this->coset ? "yes" : "no"));
     headers[p].push_back(std::make_pair("Coded monitoring", this->coded_monitoring ? "yes" : "no"));
+#ifndef AFF3CT_MPI
+    if (this->conc_noise > 1)
+        headers[p].push_back(std::make_pair("Concurrent noise points", std::to_string(this->conc_noise)));
+#endif
 
     std::string enable_track = (this->err_track_enable) ? "on" : "off";
     headers[p].push_back(std::make_pair("Bad frames tracking", enable_track));
@@ -330,6 +360,15 @@ BFER ::get_headers(std::map<std::string, tools::header_list>& headers, const boo
     if (!this->sequence_path.empty())
         headers[p].push_back(std::make_pair("Path export sequence (dot)", this->sequence_path));
 
+    if (!this->chkpt_path.empty())
+    {
+        headers[p].push_back(std::make_pair("Checkpoint path", this->chkpt_path));
+        headers[p].push_back(std::make_pair("Checkpoint freq. (s)", std::to_string(this->chkpt_freq.count())));
+        headers[p].push_back(std::make_pair("Resume", this->resume ? "on" : "off"));
+    }
+
+    if (!this->cache_path.empty()) headers[p].push_back(std::make_pair("Result cache path", this->cache_path));
+
     if (this->err_track_threshold)
         headers[p].push_back(std::make_pair("Bad frames threshold", std::to_string(this->err_track_threshold)));
 
@@ -339,6 +378,11 @@ BFER ::get_headers(std::map<std::string, tools::header_list>& headers, const boo
         headers[p].push_back(std::make_pair("Bad frames base path", path));
     }
 
+    if (this->err_track_enable)
+    {
+        headers[p].push_back(std::make_pair("Bad frames buffer (KB)", std::to_string(this->err_track_buffer)));
+    }
+
     if (this->src != nullptr && this->cdc != nullptr)
     {
         const auto bit_rate = (float)this->src->K / (float)this->cdc->N;
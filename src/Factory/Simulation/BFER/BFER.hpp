@@ -32,13 +32,19 @@ class BFER : public Simulation
     // optional parameters
     std::string err_track_path = "error_tracker";
     std::string sequence_path = "";
+    std::string chkpt_path = "";
+    std::chrono::seconds chkpt_freq = std::chrono::seconds(60);
+    std::string cache_path = "";
     int err_track_threshold = 0;
+    int err_track_buffer = 1024;
+    int conc_noise = 1;
     bool err_track_revert = false;
     bool err_track_enable = false;
     bool coset = false;
     bool coded_monitoring = false;
     bool ter_sigma = false;
     bool mnt_mutinfo = false;
+    bool resume = false;
 
 #ifdef AFF3CT_MPI
     std::chrono::milliseconds mnt_mpi_comm_freq = std::chrono::milliseconds(1000);
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <sstream>
+
 #include "Factory/Simulation/BFER/BFER_std.hpp"
 #include "Simulation/BFER/Standard/Simulation_BFER_std.hpp"
 
@@ -22,18 +25,65 @@ void
 BFER_std ::get_description(cli::Argument_map_info& args) const
 {
     BFER::get_description(args);
+
+    auto p = this->get_prefix();
+    const std::string class_name = "factory::BFER_std::";
+
+    tools::add_arg(args, p, class_name + "p+pipeline", cli::None(), cli::arg_rank::ADV);
+
+    tools::add_arg(args,
+                   p,
+                   class_name + "p+pipeline-threads",
+                   cli::List<int>(cli::Integer(cli::Positive(), cli::Non_zero()), cli::Length(3, 3)),
+                   cli::arg_rank::ADV);
+
+    tools::add_arg(
+      args, p, class_name + "p+pipeline-buffer", cli::Integer(cli::Positive(), cli::Non_zero()), cli::arg_rank::ADV);
+
+    tools::add_arg(args, p, class_name + "p+packed", cli::None(), cli::arg_rank::ADV);
 }
 
 void
 BFER_std ::store(const cli::Argument_map_value& vals)
 {
     BFER::store(vals);
+
+    auto p = this->get_prefix();
+
+    if (vals.exist({ p + "-pipeline" })) this->pipeline = true;
+    if (vals.exist({ p + "-pipeline-threads" }))
+    {
+        this->pipeline = true;
+        this->pipeline_threads = vals.to_list<int>({ p + "-pipeline-threads" });
+    }
+    if (vals.exist({ p + "-pipeline-buffer" })) this->pipeline_buffer = vals.to_int({ p + "-pipeline-buffer" });
+    if (vals.exist({ p + "-packed" })) this->packed = true;
+
+    // by default the decoding stage gets all the threads that are not used by the transmitter and the monitor
+    if (this->pipeline && this->pipeline_threads.empty())
+        this->pipeline_threads = { 1, std::max(1, this->n_threads - 2), 1 };
 }
 
 void
 BFER_std ::get_headers(std::map<std::string, tools::header_list>& headers, const bool full) const
 {
     BFER::get_headers(headers, full);
+
+    auto p = this->get_prefix();
+
+    headers[p].push_back(std::make_pair("Pipeline", this->pipeline ? "on" : "off"));
+    if (this->pipeline)
+    {
+        std::stringstream threads_str;
+        threads_str << "{";
+        for (size_t s = 0; s < this->pipeline_threads.size(); s++)
+            threads_str << this->pipeline_threads[s] << (s == this->pipeline_threads.size() - 1 ? "" : ", ");
+        threads_str << "}";
+
+        headers[p].push_back(std::make_pair("Pipeline threads", threads_str.str()));
+        headers[p].push_back(std::make_pair("Pipeline buffer size", std::to_string(this->pipeline_buffer)));
+    }
+    headers[p].push_back(std::make_pair("Packed bits", this->packed ? "on" : "off"));
 }
 
 const Codec_SIHO*
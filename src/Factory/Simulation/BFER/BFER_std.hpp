@@ -4,6 +4,7 @@
 #include <cli.hpp>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "Factory/Simulation/BFER/BFER.hpp"
 #include "Factory/Tools/Codec/Codec_SIHO.hpp"
@@ -26,6 +27,12 @@ class BFER_std : public BFER
 {
   public:
     // ----------------------------------------------------------------------------------------------------- PARAMETERS
+    // optional parameters
+    bool pipeline = false;
+    std::vector<int> pipeline_threads; // number of threads of the transmitter, receiver and monitor stages
+    int pipeline_buffer = 16;
+    bool packed = false; // pack the bits from the source to the encoder and at the input of the monitor
+
     // module parameters
     // Codec_SIHO *cdc = nullptr;
 
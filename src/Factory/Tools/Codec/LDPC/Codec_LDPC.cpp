@@ -47,6 +47,10 @@ Codec_LDPC ::get_description(cli::Argument_map_info& args) const
     args.add_link({ pdec + "-h-path" }, { penc + "-info-bits", "K" });
     args.add_link({ pdec + "-h-path" }, { penc + "-cw-size", "N" });
 
+    // the 5G NR codes are defined by their base graph and the number of information bits
+    args.add_link({ penc + "-nr-bg-path" }, { pdec + "-h-path" });
+    args.add_link({ penc + "-nr-bg-path" }, { penc + "-cw-size", "N" });
+
     if (pct != nullptr)
     {
         pct->get_description(args);
@@ -72,7 +76,21 @@ Codec_LDPC ::store(const cli::Argument_map_value& vals)
     enc->store(vals);
     dec->store(vals);
 
-    if (enc->type == "LDPC_DVBS2" || enc->type == "LDPC")
+    if (enc->type == "LDPC_NR")
+    {
+        // the base graph is selected from the code rate after rate matching (the puncturer frame size)
+        auto E = enc->K;
+        if (pct != nullptr && vals.exist({ pct->get_prefix() + "-fra-size", "N" }))
+            E = vals.to_int({ pct->get_prefix() + "-fra-size", "N" });
+
+        if (enc_ldpc->NR_BG == 0) enc_ldpc->NR_BG = tools::nr_select_base_graph(enc->K, (float)enc->K / (float)E);
+
+        enc->N_cw = tools::nr_codeword_size(enc->K, enc_ldpc->NR_BG);
+        dec->N_cw = enc->N_cw;
+        dec->K = enc->K;
+        dec_ldpc->Z = tools::nr_lifting_size(enc->K, enc_ldpc->NR_BG);
+    }
+    else if (enc->type == "LDPC_DVBS2" || enc->type == "LDPC")
         dec->N_cw = enc->N_cw; // then the encoder knows the N_cw
     else
         enc->N_cw = dec->N_cw; // then the decoder knows the N_cw
@@ -103,6 +121,14 @@ Codec_LDPC ::store(const cli::Argument_map_value& vals)
         pct->N_cw = enc->N_cw;
 
         pct->store(vals);
+
+        if (enc->type == "LDPC_NR")
+        {
+            auto pct_ldpc = dynamic_cast<Puncturer_LDPC*>(pct.get());
+            pct_ldpc->type = "LDPC_NR";
+            pct_ldpc->NR_BG = enc_ldpc->NR_BG;
+            pct_ldpc->NR_Z = dec_ldpc->Z;
+        }
     }
 
     K = enc->K;
@@ -83,6 +83,7 @@ BFER_std<B, R, Q>::store_args()
     params.store(this->arg_vals);
 
     params.src->seed = params.local_seed;
+    params.src->packed = params.packed;
 
     params.src->store(this->arg_vals);
 
@@ -2,7 +2,9 @@
 #include <string>
 
 #include "Module/CRC/NO/CRC_NO.hpp"
+#include "Tools/Perf/common/bit_packing.h"
 
+using namespace aff3ct;
 using namespace aff3ct::module;
 
 template<typename B>
@@ -59,6 +61,13 @@ CRC_NO<B>::_check_packed(const B* V_K, const size_t frame_id)
     return false;
 }
 
+template<typename B>
+void
+CRC_NO<B>::_build_packed(const B* U_K1, B* U_K2, const size_t frame_id)
+{
+    std::copy(U_K1, U_K1 + tools::packed_size<B>(this->K), U_K2);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -5,6 +5,7 @@
 
 #include "Module/CRC/Polynomial/CRC_polynomial.hpp"
 #include "Tools/Display/rang_format/rang_format.h"
+#include "Tools/Perf/common/bit_packing.h"
 
 using namespace aff3ct;
 using namespace aff3ct::module;
@@ -92,13 +93,13 @@ CRC_polynomial<B>::get_name(const std::string& poly_key)
 }
 
 template<typename B>
-unsigned
+uint64_t
 CRC_polynomial<B>::get_value(const std::string& poly_key)
 {
     if (known_polynomials.find(poly_key) != known_polynomials.end())
         return std::get<0>(known_polynomials.at(poly_key));
     else if (poly_key.length() > 2 && poly_key[0] == '0' && poly_key[1] == 'x')
-        return (unsigned)std::stoul(poly_key, 0, 16);
+        return (uint64_t)std::stoull(poly_key, 0, 16);
     else
         return 0;
 }
@@ -161,6 +162,17 @@ CRC_polynomial<B>::_check_packed(const B* V_K, const size_t frame_id)
     return _check(V_K_unpack.data(), frame_id);
 }
 
+template<typename B>
+void
+CRC_polynomial<B>::_build_packed(const B* U_K1, B* U_K2, const size_t frame_id)
+{
+    std::vector<B> U_K1_unpack(this->K);
+    std::vector<B> U_K2_unpack(this->K + this->size);
+    tools::unpack_bits(U_K1, U_K1_unpack.data(), this->K);
+    this->_build(U_K1_unpack.data(), U_K2_unpack.data(), frame_id);
+    tools::pack_bits(U_K2_unpack.data(), U_K2, this->K + this->size);
+}
+
 template<typename B>
 void
 CRC_polynomial<B>::set_n_frames(const size_t n_frames)
@@ -1,8 +1,8 @@
 #include <algorithm>
-#include <sstream>
 #include <streampu.hpp>
 
 #include "Module/CRC/Polynomial/CRC_polynomial_fast.hpp"
+#include "Tools/Perf/common/bit_packing.h"
 
 using namespace aff3ct;
 using namespace aff3ct::module;
@@ -10,37 +10,16 @@ using namespace aff3ct::module;
 template<typename B>
 CRC_polynomial_fast<B>::CRC_polynomial_fast(const int K, const std::string& poly_key, const int size)
   : CRC_polynomial<B>(K, poly_key, size)
-  , lut_crc32(256)
-  , polynomial_packed_rev(0)
+  , engine(this->polynomial_packed, this->size)
+  , inc_V_K(K)
+  , inc_bytes((K + 127) / 128 * 16)
+  , inc_states((K + 127) / 128 + 1, 0)
+  , inc_valid(false)
 {
     const std::string name = "CRC_polynomial_fast";
     this->set_name(name);
     for (auto& t : this->tasks)
         t->set_replicability(true);
-
-    if (this->size > 32)
-    {
-        std::stringstream message;
-        message << "'size' has to be equal or smaller than 32 ('size' = " << this->size << ").";
-        throw spu::tools::length_error(__FILE__, __LINE__, __func__, message.str());
-    }
-
-    // reverse the order of the bits in the bitpacked polynomial
-    for (auto i = 0; i < (int)sizeof(this->polynomial_packed) * 8; i++)
-    {
-        polynomial_packed_rev <<= 1;
-        polynomial_packed_rev |= (this->polynomial_packed >> i) & 1;
-    }
-    polynomial_packed_rev >>= (sizeof(this->polynomial_packed) * 8) - (this->size);
-
-    // precompute a lookup table pour the v3 implem. of the CRC
-    for (auto i = 0; i < 256; i++)
-    {
-        unsigned crc = i;
-        for (unsigned int j = 0; j < 8; j++)
-            crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
-        lut_crc32[i] = crc;
-    }
 }
 
 template<typename B>
@@ -56,21 +35,39 @@ template<typename B>
 void
 CRC_polynomial_fast<B>::_build(const B* U_K1, B* U_K2, const size_t frame_id)
 {
-#if __BYTE_ORDER != __LITTLE_ENDIAN
-    throw spu::tools::runtime_error(
-      __FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
-#endif
-
     const auto data = (unsigned char*)this->buff_crc.data();
     spu::tools::Bit_packer::pack(U_K1, data, this->K);
 
-    const auto crc = this->compute_crc_v3((void*)data, this->K);
+    const auto crc = this->engine.compute((const void*)data, this->K);
 
     std::copy(U_K1, U_K1 + this->K, U_K2);
     for (auto i = 0; i < this->size; i++)
         U_K2[this->K + i] = (crc >> i) & 1;
 }
 
+template<typename B>
+void
+CRC_polynomial_fast<B>::_build_packed(const B* U_K1, B* U_K2, const size_t frame_id)
+{
+    const auto crc = this->engine.compute((const void*)U_K1, this->K);
+
+    // the information bits are already packed: copy them and append the CRC bits after the K-th bit
+    const auto in = (const unsigned char*)U_K1;
+    const auto out = (unsigned char*)U_K2;
+    const auto n_bytes_in = (this->K + 7) / 8;
+    std::copy(in, in + n_bytes_in, out);
+    std::fill(out + n_bytes_in, out + tools::packed_size<B>(this->K + this->size) * sizeof(B), (unsigned char)0);
+
+    const auto rest = this->K % 8;
+    if (rest) out[this->K / 8] &= (unsigned char)((1 << rest) - 1);
+
+    for (auto i = 0; i < this->size; i++)
+    {
+        const auto pos = this->K + i;
+        out[pos / 8] |= (unsigned char)(((crc >> i) & 1) << (pos % 8));
+    }
+}
+
 template<typename B>
 bool
 CRC_polynomial_fast<B>::_check(const B* V_K, const size_t frame_id)
@@ -83,148 +80,58 @@ template<typename B>
 bool
 CRC_polynomial_fast<B>::_check_packed(const B* V_K, const size_t frame_id)
 {
-#if __BYTE_ORDER != __LITTLE_ENDIAN
-    throw spu::tools::runtime_error(
-      __FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
-#endif
-
-    const auto crc_size = this->size;
-    const auto rest = this->K % 8;
-
-    unsigned char* bytes = (unsigned char*)V_K;
-
-    unsigned crc_invalid = 0;
-
-    const auto data = bytes;
-    const auto crc = this->compute_crc_v3((void*)data, this->K);
-
-    auto n_bits_crc = crc_size;
-    auto current = data + (this->K / 8);
-
-    unsigned crc_ref = 0;
-    if (rest)
-    {
-        auto cur = *current++;
-        for (auto j = rest; j < 8 && n_bits_crc > 0; j++)
-            crc_ref |= ((cur >> j) & 1) << (crc_size - n_bits_crc--);
-    }
-    while (n_bits_crc)
-    {
-        auto cur = *current++;
-        for (auto j = 0; j < 8 && n_bits_crc > 0; j++)
-            crc_ref |= ((cur >> j) & 1) << (crc_size - n_bits_crc--);
-    }
-
-    crc_invalid |= crc ^ crc_ref;
-
-    return !crc_invalid;
+    const auto bytes = (const uint8_t*)V_K;
+    return this->engine.compute((const void*)bytes, this->K) == this->extract_crc(bytes);
 }
 
-// Source of inspiration: http://create.stephan-brumme.com/crc32/ (Fastest Bitwise CRC32)
 template<typename B>
-unsigned
-CRC_polynomial_fast<B>::compute_crc_v1(const void* data, const int n_bits)
+bool
+CRC_polynomial_fast<B>::check_incremental(const B* V_K)
 {
-#if __BYTE_ORDER != __LITTLE_ENDIAN
-    throw spu::tools::runtime_error(
-      __FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
-#endif
+    constexpr size_t blk_bits = 128; // the CRC states are saved every 16 bytes
 
-    unsigned crc = 0;
+    const auto K = (size_t)this->K;
+    const auto first_diff =
+      this->inc_valid ? (size_t)(std::mismatch(V_K, V_K + K, this->inc_V_K.begin()).first - V_K) : (size_t)0;
+    std::copy(V_K + first_diff, V_K + K, this->inc_V_K.begin() + first_diff);
 
-    auto current = (unsigned char*)data;
-    auto length = n_bits / 8;
-    while (length--)
-    {
-        crc ^= *current++;
-        for (auto j = 0; j < 8; j++)
-            //			crc = (crc & 1) ? (crc >> 1) ^ polynomial_packed_rev : crc >> 1;
-            crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
-    }
+    // resume the CRC from the last saved state before the first bit that differs from the previous frame
+    const auto first_blk = first_diff / blk_bits;
+    const auto offset = first_blk * blk_bits;
+    if (offset < K) spu::tools::Bit_packer::pack(V_K + offset, this->inc_bytes.data() + offset / 8, (int)(K - offset));
 
-    auto rest = n_bits % 8;
-    if (rest != 0)
+    auto crc = this->inc_states[first_blk];
+    for (auto b = first_blk; b * blk_bits < K; b++)
     {
-        auto cur = *current;
-        cur <<= 8 - rest;
-        cur >>= 8 - rest;
-
-        crc ^= cur;
-        for (auto j = 0; j < rest; j++)
-            //			crc = (crc & 1) ? (crc >> 1) ^ polynomial_packed_rev : crc >> 1;
-            crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
+        const auto n_bits = std::min(blk_bits, K - b * blk_bits);
+        crc = this->engine.update(crc, (const void*)(this->inc_bytes.data() + b * (blk_bits / 8)), n_bits);
+        if (n_bits == blk_bits) this->inc_states[b + 1] = crc;
     }
+    this->inc_valid = true;
 
-    return crc;
+    for (auto i = 0; i < this->size; i++)
+        if (((crc >> i) & 1) != (uint64_t)(V_K[K + i] != 0)) return false;
+
+    return true;
 }
 
-// Source of inspiration: http://create.stephan-brumme.com/crc32/ (Fastest Bitwise CRC32)
 template<typename B>
-unsigned
-CRC_polynomial_fast<B>::compute_crc_v2(const void* data, const int n_bits)
+void
+CRC_polynomial_fast<B>::reset_incremental()
 {
-#if __BYTE_ORDER != __LITTLE_ENDIAN
-    throw spu::tools::runtime_error(
-      __FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
-#endif
-
-    unsigned crc = 0;
-
-    auto current = (unsigned int*)data;
-    auto length = n_bits / 32;
-    while (length--)
-    {
-        crc ^= *current++;
-        for (auto j = 0; j < 32; j++)
-            //			crc = (crc & 1) ? (crc >> 1) ^ polynomial_packed_rev : crc >> 1;
-            crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
-    }
-
-    auto rest = n_bits % 32;
-    if (rest != 0)
-    {
-        auto cur = *current;
-        cur <<= 32 - rest;
-        cur >>= 32 - rest;
-
-        crc ^= cur;
-        for (auto j = 0; j < rest; j++)
-            //			crc = (crc & 1) ? (crc >> 1) ^ polynomial_packed_rev : crc >> 1;
-            crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
-    }
-
-    return crc;
+    this->inc_valid = false;
 }
 
-// Source of inspiration: http://create.stephan-brumme.com/crc32/ (Standard Implementation)
 template<typename B>
-unsigned
-CRC_polynomial_fast<B>::compute_crc_v3(const void* data, const int n_bits)
+uint64_t
+CRC_polynomial_fast<B>::extract_crc(const uint8_t* bytes) const
 {
-#if __BYTE_ORDER != __LITTLE_ENDIAN
-    throw spu::tools::runtime_error(
-      __FILE__, __LINE__, __func__, "The code of the fast CRC works only on little endian CPUs.");
-#endif
-
-    unsigned crc = 0;
-
-    auto current = (unsigned char*)data;
-    auto length = n_bits / 8;
-    while (length--)
-        crc = (crc >> 8) ^ lut_crc32[(crc & 0xFF) ^ *current++];
-
-    auto rest = n_bits % 8;
-    if (rest != 0)
+    uint64_t crc = 0;
+    for (auto i = 0; i < this->size; i++)
     {
-        auto cur = *current;
-        cur <<= 8 - rest;
-        cur >>= 8 - rest;
-
-        crc ^= cur;
-        for (auto j = 0; j < rest; j++)
-            crc = (crc >> 1) ^ (-int(crc & 1) & polynomial_packed_rev);
+        const auto pos = this->K + i;
+        crc |= (uint64_t)((bytes[pos / 8] >> (pos % 8)) & 1) << i;
     }
-
     return crc;
 }
 
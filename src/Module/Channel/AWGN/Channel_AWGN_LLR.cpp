@@ -1,8 +1,11 @@
 #include <algorithm>
+#include <cmath>
+#include <sstream>
 #include <streampu.hpp>
 #include <string>
 
 #include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Fast/Gaussian_noise_generator_fast.hpp"
+#include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Philox/Gaussian_noise_generator_philox.hpp"
 #include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Standard/Gaussian_noise_generator_std.hpp"
 #include "Tools/Noise/Noise.hpp"
 #ifdef AFF3CT_CHANNEL_GSL
@@ -23,6 +26,8 @@ Channel_AWGN_LLR<R>::Channel_AWGN_LLR(const int N,
   : Channel<R>(N)
   , add_users(add_users)
   , gaussian_generator(gaussian_generator.clone())
+  , is_bias(Importance_sampling_bias::SCALE)
+  , is_factor((R)1)
 {
     const std::string name = "Channel_AWGN_LLR";
     this->set_name(name);
@@ -44,6 +49,9 @@ create_gaussian_generator(const tools::Gaussian_noise_generator_implem implem, c
         case tools::Gaussian_noise_generator_implem::FAST:
             return new tools::Gaussian_noise_generator_fast<R>(seed);
             break;
+        case tools::Gaussian_noise_generator_implem::PHILOX:
+            return new tools::Gaussian_noise_generator_philox<R>(seed);
+            break;
 #ifdef AFF3CT_CHANNEL_GSL
         case tools::Gaussian_noise_generator_implem::GSL:
             return new tools::Gaussian_noise_generator_GSL<R>(seed);
@@ -69,6 +77,8 @@ Channel_AWGN_LLR<R>::Channel_AWGN_LLR(const int N,
   : Channel<R>(N)
   , add_users(add_users)
   , gaussian_generator(create_gaussian_generator<R>(implem, seed))
+  , is_bias(Importance_sampling_bias::SCALE)
+  , is_factor((R)1)
 {
     const std::string name = "Channel_AWGN_LLR";
     this->set_name(name);
@@ -100,6 +110,22 @@ void
 Channel_AWGN_LLR<R>::set_seed(const int seed)
 {
     this->gaussian_generator->set_seed(seed);
+    this->frame_counter = 0;
+}
+
+template<typename R>
+void
+Channel_AWGN_LLR<R>::set_importance_sampling(const Importance_sampling_bias bias, const R factor)
+{
+    if (bias == Importance_sampling_bias::SCALE && factor <= (R)0)
+    {
+        std::stringstream message;
+        message << "'factor' has to be greater than 0 ('factor' = " << factor << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->is_bias = bias;
+    this->is_factor = factor;
 }
 
 template<typename R>
@@ -108,7 +134,7 @@ Channel_AWGN_LLR<R>::_add_noise(const float* CP, const R* X_N, R* Y_N, const siz
 {
     if (add_users && this->n_frames > 1) // n_frames_per_wave = n_frames
     {
-        gaussian_generator->generate(this->noised_data.data(), this->N, (R)*CP);
+        gaussian_generator->generate(this->noised_data.data(), this->N, (R)*CP, (R)0, this->next_frame_index(1));
 
         std::fill(Y_N, Y_N + this->N, (R)0);
         for (size_t f = 0; f < this->n_frames; f++)
@@ -120,13 +146,61 @@ Channel_AWGN_LLR<R>::_add_noise(const float* CP, const R* X_N, R* Y_N, const siz
     }
     else // n_frames_per_wave = 1
     {
-        gaussian_generator->generate(this->noised_data.data() + frame_id * this->N, this->N, (R)*CP);
+        const auto frame_idx = this->next_frame_index(this->n_frames);
+        gaussian_generator->generate(this->noised_data.data() + frame_id * this->N, this->N, (R)*CP, (R)0, frame_idx);
 
         for (auto n = 0; n < this->N; n++)
             Y_N[n] = X_N[n] + this->noised_data[frame_id * this->N + n];
     }
 }
 
+template<typename R>
+void
+Channel_AWGN_LLR<R>::_add_noise_is(const float* CP, const R* X_N, R* Y_N, double* LW, const size_t frame_id)
+{
+    if (add_users && this->n_frames > 1)
+    {
+        std::stringstream message;
+        message << "The importance sampling is not supported when the users are added.";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    const auto sigma = (double)*CP;
+    auto noise = this->noised_data.data() + frame_id * this->N;
+    const auto frame_idx = this->next_frame_index(this->n_frames);
+
+    // log(p(n) / q(n)) where p is the density of the true noise and q the density of the biased one
+    double log_w = 0.;
+    if (this->is_bias == Importance_sampling_bias::SCALE)
+    {
+        gaussian_generator->generate(noise, this->N, (R)(sigma * this->is_factor), (R)0, frame_idx);
+
+        double energy = 0.;
+        for (auto n = 0; n < this->N; n++)
+            energy += (double)noise[n] * (double)noise[n];
+
+        const auto a2 = (double)this->is_factor * (double)this->is_factor;
+        log_w = this->N * std::log((double)this->is_factor) - energy / (2. * sigma * sigma) * (1. - 1. / a2);
+    }
+    else // Importance_sampling_bias::SHIFT
+    {
+        gaussian_generator->generate(noise, this->N, (R)sigma, (R)0, frame_idx);
+
+        const auto mu = (double)this->is_factor;
+        for (auto n = 0; n < this->N; n++)
+        {
+            const auto s = (double)((X_N[n] > (R)0) - (X_N[n] < (R)0));
+            noise[n] -= (R)(mu * s);
+            log_w += (2. * mu * s * (double)noise[n] + mu * mu * s * s) / (2. * sigma * sigma);
+        }
+    }
+
+    for (auto n = 0; n < this->N; n++)
+        Y_N[n] = X_N[n] + noise[n];
+
+    *LW = log_w;
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
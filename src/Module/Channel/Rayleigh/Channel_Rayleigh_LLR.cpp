@@ -5,6 +5,7 @@
 #include <string>
 
 #include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Fast/Gaussian_noise_generator_fast.hpp"
+#include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Philox/Gaussian_noise_generator_philox.hpp"
 #include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Standard/Gaussian_noise_generator_std.hpp"
 #include "Tools/Noise/Noise.hpp"
 #ifdef AFF3CT_CHANNEL_GSL
@@ -56,6 +57,9 @@ create_gaussian_generator(const tools::Gaussian_noise_generator_implem implem, c
         case tools::Gaussian_noise_generator_implem::FAST:
             return new tools::Gaussian_noise_generator_fast<R>(seed);
             break;
+        case tools::Gaussian_noise_generator_implem::PHILOX:
+            return new tools::Gaussian_noise_generator_philox<R>(seed);
+            break;
 #ifdef AFF3CT_CHANNEL_GSL
         case tools::Gaussian_noise_generator_implem::GSL:
             return new tools::Gaussian_noise_generator_GSL<R>(seed);
@@ -122,16 +126,21 @@ void
 Channel_Rayleigh_LLR<R>::set_seed(const int seed)
 {
     this->gaussian_generator->set_seed(seed);
+    this->frame_counter = 0;
 }
 
 template<typename R>
 void
 Channel_Rayleigh_LLR<R>::_add_noise_wg(const float* CP, const R* X_N, R* H_N, R* Y_N, const size_t frame_id)
 {
+    // the gains and the noise of a frame are two distinct draws of the generator
+    const auto frame_idx = 2 * this->next_frame_index(add_users && this->n_frames > 1 ? 1 : this->n_frames);
+
     if (add_users && this->n_frames > 1) // n_frames_per_wave = n_frames
     {
-        gaussian_generator->generate(this->gains, (R)1 / (R)std::sqrt((R)2));
-        gaussian_generator->generate(this->noised_data.data(), this->N, (R)*CP);
+        gaussian_generator->generate(
+          this->gains.data(), (unsigned)this->gains.size(), (R)1 / (R)std::sqrt((R)2), (R)0, frame_idx + 0);
+        gaussian_generator->generate(this->noised_data.data(), this->N, (R)*CP, (R)0, frame_idx + 1);
 
         std::fill(Y_N, Y_N + this->N, (R)0);
 
@@ -169,8 +178,10 @@ Channel_Rayleigh_LLR<R>::_add_noise_wg(const float* CP, const R* X_N, R* H_N, R*
     else // n_frames_per_wave = 1
     {
         const auto gains_size = this->complex ? this->N : 2 * this->N;
-        gaussian_generator->generate(this->gains.data() + frame_id * this->N, gains_size, (R)1 / (R)std::sqrt((R)2));
-        gaussian_generator->generate(this->noised_data.data() + frame_id * this->N, this->N, (R)*CP);
+        gaussian_generator->generate(
+          this->gains.data() + frame_id * this->N, gains_size, (R)1 / (R)std::sqrt((R)2), (R)0, frame_idx + 0);
+        gaussian_generator->generate(
+          this->noised_data.data() + frame_id * this->N, this->N, (R)*CP, (R)0, frame_idx + 1);
 
         if (this->complex)
         {
@@ -5,6 +5,7 @@
 #include <string>
 
 #include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Fast/Gaussian_noise_generator_fast.hpp"
+#include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Philox/Gaussian_noise_generator_philox.hpp"
 #include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Standard/Gaussian_noise_generator_std.hpp"
 #include "Tools/Noise/Noise.hpp"
 #ifdef AFF3CT_CHANNEL_GSL
@@ -65,6 +66,9 @@ create_gaussian_generator(const tools::Gaussian_noise_generator_implem implem, c
         case tools::Gaussian_noise_generator_implem::FAST:
             return new tools::Gaussian_noise_generator_fast<R>(seed);
             break;
+        case tools::Gaussian_noise_generator_implem::PHILOX:
+            return new tools::Gaussian_noise_generator_philox<R>(seed);
+            break;
 #ifdef AFF3CT_CHANNEL_GSL
         case tools::Gaussian_noise_generator_implem::GSL:
             return new tools::Gaussian_noise_generator_GSL<R>(seed);
@@ -139,6 +143,7 @@ void
 Channel_Rayleigh_LLR_user<R>::set_seed(const int seed)
 {
     this->gaussian_generator->set_seed(seed);
+    this->frame_counter = 0;
 }
 
 template<typename R>
@@ -190,8 +195,12 @@ Channel_Rayleigh_LLR_user<R>::_add_noise_wg(const float* CP, const R* X_N, R* H_
         }
     }
 
-    // generate the noise
-    gaussian_generator->generate(this->noised_data, (R)*CP);
+    // generate the noise, frame by frame
+    for (size_t f = 0; f < this->n_frames; f++)
+    {
+        const auto frame_idx = this->next_frame_index(this->n_frames);
+        gaussian_generator->generate(this->noised_data.data() + f * this->N, this->N, (R)*CP, (R)0, frame_idx);
+    }
 
     // use the noise and the gain to modify the signal
     for (size_t i = 0; i < this->N * this->n_frames; i++)
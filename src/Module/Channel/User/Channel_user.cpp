@@ -1,10 +1,17 @@
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <ios>
 #include <limits>
 #include <sstream>
 #include <streampu.hpp>
 #include <string>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "Module/Channel/User/Channel_user.hpp"
 
@@ -16,6 +23,8 @@ Channel_user<R>::Channel_user(const int N, const std::string& filename, const bo
   : Channel<R>(N)
   , add_users(add_users)
   , noise_counter(0)
+  , noise_mapped(nullptr)
+  , n_noise_mapped(0)
 {
     const std::string name = "Channel_user";
     this->set_name(name);
@@ -25,7 +34,7 @@ Channel_user<R>::Channel_user(const int N, const std::string& filename, const bo
     if (filename.empty())
         throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, "'filename' should not be empty.");
 
-    read_noise_file(filename, this->N, this->noise_buff);
+    if (!this->map_binary(filename)) read_noise_file(filename, this->N, this->noise_buff);
 
     if (add_users) this->set_single_wave(true);
 }
@@ -61,6 +70,15 @@ template<typename R>
 void
 Channel_user<R>::set_noise(const size_t frame_id)
 {
+    if (this->noise_map != nullptr)
+    {
+        const auto frame = this->noise_mapped + (size_t)this->noise_counter * this->N;
+        std::copy(frame, frame + this->N, this->noised_data.data() + frame_id * this->N);
+
+        this->noise_counter = (this->noise_counter + 1) % (int)this->n_noise_mapped;
+        return;
+    }
+
     std::copy(this->noise_buff[this->noise_counter].begin(),
               this->noise_buff[this->noise_counter].end(),
               this->noised_data.data() + frame_id * this->N);
@@ -68,6 +86,48 @@ Channel_user<R>::set_noise(const size_t frame_id)
     this->noise_counter = (this->noise_counter + 1) % (int)this->noise_buff.size();
 }
 
+template<typename R>
+bool
+Channel_user<R>::map_binary(const std::string& filename)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) || (size_t)st.st_size < sizeof(unsigned) + sizeof(int))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    const auto length = (size_t)st.st_size;
+    void* addr = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) return false;
+
+    std::shared_ptr<const char> map((const char*)addr, [length](const char* p) { munmap((void*)p, length); });
+
+    unsigned n_fra = 0;
+    int fra_size = 0;
+    std::memcpy(&n_fra, map.get(), sizeof(n_fra));
+    std::memcpy(&fra_size, map.get() + sizeof(n_fra), sizeof(fra_size));
+
+    // the text files and the binary files written with another type are read by 'read_noise_file'
+    const auto header = sizeof(n_fra) + sizeof(fra_size);
+    if (n_fra == 0 || fra_size != this->N || length != header + (size_t)n_fra * fra_size * sizeof(R)) return false;
+
+    madvise(addr, length, MADV_SEQUENTIAL);
+
+    this->noise_map = map;
+    this->noise_mapped = (const R*)(map.get() + header);
+    this->n_noise_mapped = n_fra;
+    return true;
+#else
+    return false;
+#endif
+}
+
 template<typename R>
 void
 Channel_user<R>::read_noise_file(const std::string& filename, const int N, std::vector<std::vector<R>>& noise_buffer)
@@ -0,0 +1,303 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Decoder/Generic/OSD/Decoder_OSD_std.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template<typename B, typename R>
+Decoder_OSD_std<B, R>::Decoder_OSD_std(const int K,
+                                       const int N,
+                                       const Encoder<B>& encoder,
+                                       const int order,
+                                       const bool hamming)
+  : Decoder_SIHO<B, R>(K, N)
+  , encoder(encoder.clone())
+  , order(order)
+  , hamming(hamming)
+  , G(K, ((N + tools::GF2_matrix::word_size - 1) / tools::GF2_matrix::word_size) * tools::GF2_matrix::word_size + K)
+  , G_sh(G)
+  , n_words_N((N + tools::GF2_matrix::word_size - 1) / tools::GF2_matrix::word_size)
+  , sorted_pos(N)
+  , mrip(K)
+  , weights(N)
+  , hard_Y_N(n_words_N)
+  , candidates((order + 1) * G.get_n_words())
+  , best(G.get_n_words())
+  , min_cost(std::numeric_limits<float>::max())
+{
+    const std::string name = "Decoder_OSD_std";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    if (encoder.get_K() != K)
+    {
+        std::stringstream message;
+        message << "'encoder.get_K()' has to be equal to 'K' ('encoder.get_K()' = " << encoder.get_K()
+                << ", 'K' = " << K << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (encoder.get_N() != N)
+    {
+        std::stringstream message;
+        message << "'encoder.get_N()' has to be equal to 'N' ('encoder.get_N()' = " << encoder.get_N()
+                << ", 'N' = " << N << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (order < 0 || order > K)
+    {
+        std::stringstream message;
+        message << "'order' has to be positive and smaller or equal to 'K' ('order' = " << order << ", 'K' = " << K
+                << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->build_G();
+}
+
+template<typename B, typename R>
+Decoder_OSD_std<B, R>*
+Decoder_OSD_std<B, R>::clone() const
+{
+    auto m = new Decoder_OSD_std(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R>
+void
+Decoder_OSD_std<B, R>::deep_copy(const Decoder_OSD_std<B, R>& m)
+{
+    spu::module::Stateful::deep_copy(m);
+    if (m.encoder != nullptr) this->encoder.reset(m.encoder->clone());
+}
+
+template<typename B, typename R>
+tools::Interface_get_set_frozen_bits&
+Decoder_OSD_std<B, R>::get_fb_encoder() const
+{
+    auto fb_encoder = dynamic_cast<tools::Interface_get_set_frozen_bits*>(this->encoder.get());
+    if (fb_encoder == nullptr)
+    {
+        std::stringstream message;
+        message << "The encoder has no frozen bits ('encoder.get_name()' = " << this->encoder->get_name() << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    return *fb_encoder;
+}
+
+template<typename B, typename R>
+void
+Decoder_OSD_std<B, R>::set_frozen_bits(const std::vector<bool>& frozen_bits)
+{
+    // the frozen bits change the code: the generator matrix has to be deduced again
+    this->get_fb_encoder().set_frozen_bits(frozen_bits);
+    this->build_G();
+}
+
+template<typename B, typename R>
+const std::vector<bool>&
+Decoder_OSD_std<B, R>::get_frozen_bits() const
+{
+    return this->get_fb_encoder().get_frozen_bits();
+}
+
+template<typename B, typename R>
+void
+Decoder_OSD_std<B, R>::build_G()
+{
+    constexpr auto word_size = tools::GF2_matrix::word_size;
+
+    for (auto k = 0; k < this->K; k++)
+        std::fill(this->G.get_row(k), this->G.get_row(k) + this->G.get_n_words(), (Word)0);
+
+    // deduce the generator matrix from the encoder: the row 'k' is the codeword of the k-th unit information vector
+    std::vector<B> U_K(this->K, (B)0), X_N(this->N);
+    const auto info_col = this->n_words_N * word_size;
+    for (auto k = 0; k < this->K; k++)
+    {
+        U_K[k] = (B)1;
+        this->encoder->encode(U_K.data(), X_N.data(), 0);
+        U_K[k] = (B)0;
+
+        for (auto n = 0; n < this->N; n++)
+            if (X_N[n]) this->G.flip(k, n);
+        this->G.flip(k, info_col + k);
+    }
+
+    // the MRIP can only be found if the rows of the generator matrix are linearly independent
+    std::iota(this->sorted_pos.begin(), this->sorted_pos.end(), 0);
+    this->reduce_on_mrip();
+}
+
+template<typename B, typename R>
+void
+Decoder_OSD_std<B, R>::reduce_on_mrip()
+{
+    this->G_sh = this->G;
+
+    // Gauss-Jordan elimination on the columns taken by decreasing reliability
+    int rank = 0;
+    for (auto t = 0; t < this->N && rank < this->K; t++)
+    {
+        const auto col = this->sorted_pos[t];
+
+        auto pivot = rank;
+        while (pivot < this->K && !this->G_sh.get(pivot, col))
+            pivot++;
+        if (pivot == this->K) continue; // linearly dependent on the previous MRIP
+
+        this->G_sh.swap_rows(rank, pivot);
+        for (auto r = 0; r < this->K; r++)
+            if (r != rank && this->G_sh.get(r, col)) this->G_sh.xor_rows(r, rank);
+
+        this->mrip[rank++] = col;
+    }
+
+    if (rank != this->K)
+    {
+        std::stringstream message;
+        message << "The generator matrix deduced from the encoder is not full rank ('rank' = " << rank
+                << ", 'K' = " << this->K << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
+template<typename B, typename R>
+float
+Decoder_OSD_std<B, R>::compute_cost(const Word* candidate) const
+{
+    // sum of the weights of the positions where the candidate disagrees with the hard decisions, 64 positions at once
+    float cost = 0.f;
+    for (size_t w = 0; w < this->n_words_N && cost < this->min_cost; w++)
+    {
+        auto diff = candidate[w] ^ this->hard_Y_N[w];
+        while (diff)
+        {
+            cost += this->weights[w * tools::GF2_matrix::word_size + tools::gf2_ctz(diff)];
+            diff &= diff - 1;
+        }
+    }
+
+    return cost;
+}
+
+template<typename B, typename R>
+void
+Decoder_OSD_std<B, R>::reprocess(const int level, const int last_mrip, const float mrip_cost)
+{
+    const auto n_words = this->G_sh.get_n_words();
+    const auto prev = this->candidates.data() + (level - 1) * n_words;
+    const auto cur = this->candidates.data() + level * n_words;
+
+    // the MRIP are sorted by decreasing reliability: flipping the i-th MRIP costs more and more when 'i' decreases, the
+    // remaining patterns of this level can't beat the best candidate once the MRIP cost alone reaches it
+    for (auto i = last_mrip - 1; i >= 0; i--)
+    {
+        const auto cost_i = mrip_cost + this->weights[this->mrip[i]];
+        if (cost_i >= this->min_cost) break;
+
+        const auto row = this->G_sh.get_row(i);
+        for (size_t w = 0; w < n_words; w++)
+            cur[w] = prev[w] ^ row[w];
+
+        const auto cost = this->compute_cost(cur);
+        if (cost < this->min_cost)
+        {
+            this->min_cost = cost;
+            std::copy(cur, cur + n_words, this->best.begin());
+        }
+
+        if (level < this->order) this->reprocess(level + 1, i, cost_i);
+    }
+}
+
+template<typename B, typename R>
+void
+Decoder_OSD_std<B, R>::_decode(const R* Y_N)
+{
+    constexpr auto word_size = tools::GF2_matrix::word_size;
+
+    std::fill(this->hard_Y_N.begin(), this->hard_Y_N.end(), (Word)0);
+    for (auto n = 0; n < this->N; n++)
+    {
+        this->weights[n] = this->hamming ? 1.f : (float)std::abs(Y_N[n]);
+        if (Y_N[n] < 0) this->hard_Y_N[n / word_size] |= (Word)1 << (n % word_size);
+    }
+
+    std::iota(this->sorted_pos.begin(), this->sorted_pos.end(), 0);
+    std::stable_sort(this->sorted_pos.begin(),
+                     this->sorted_pos.end(),
+                     [&Y_N](const uint32_t i1, const uint32_t i2) { return std::abs(Y_N[i1]) > std::abs(Y_N[i2]); });
+
+    this->reduce_on_mrip();
+
+    // order 0: re-encode the hard decisions of the MRIP
+    const auto n_words = this->G_sh.get_n_words();
+    std::fill(this->candidates.begin(), this->candidates.begin() + n_words, (Word)0);
+    for (auto k = 0; k < this->K; k++)
+        if ((this->hard_Y_N[this->mrip[k] / word_size] >> (this->mrip[k] % word_size)) & 1)
+        {
+            const auto row = this->G_sh.get_row(k);
+            for (size_t w = 0; w < n_words; w++)
+                this->candidates[w] ^= row[w];
+        }
+
+    this->min_cost = std::numeric_limits<float>::max();
+    this->min_cost = this->compute_cost(this->candidates.data());
+    std::copy(this->candidates.begin(), this->candidates.begin() + n_words, this->best.begin());
+
+    // order 1 to 'order'
+    if (this->order > 0) this->reprocess(1, this->K, 0.f);
+}
+
+template<typename B, typename R>
+int
+Decoder_OSD_std<B, R>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_id)
+{
+    constexpr auto word_size = tools::GF2_matrix::word_size;
+
+    this->_decode(Y_N);
+
+    const auto info = this->best.data() + this->n_words_N;
+    for (auto k = 0; k < this->K; k++)
+        V_K[k] = (B)((info[k / word_size] >> (k % word_size)) & 1);
+
+    return 0;
+}
+
+template<typename B, typename R>
+int
+Decoder_OSD_std<B, R>::_decode_siho_cw(const R* Y_N, B* V_N, const size_t frame_id)
+{
+    constexpr auto word_size = tools::GF2_matrix::word_size;
+
+    this->_decode(Y_N);
+
+    for (auto n = 0; n < this->N; n++)
+        V_N[n] = (B)((this->best[n / word_size] >> (n % word_size)) & 1);
+
+    return 0;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_OSD_std<B_8, Q_8>;
+template class aff3ct::module::Decoder_OSD_std<B_16, Q_16>;
+template class aff3ct::module::Decoder_OSD_std<B_32, Q_32>;
+template class aff3ct::module::Decoder_OSD_std<B_64, Q_64>;
+#else
+template class aff3ct::module::Decoder_OSD_std<B, Q>;
+#endif
+// ==================================================================================== explicit template instantiation
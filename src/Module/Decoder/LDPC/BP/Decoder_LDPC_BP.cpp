@@ -39,4 +39,4 @@ Decoder_LDPC_BP ::Decoder_LDPC_BP(const int K,
                 << ", 'H.get_n_rows()' = " << this->H.get_n_rows() << ").";
         throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
     }
-}
\ No newline at end of file
+}
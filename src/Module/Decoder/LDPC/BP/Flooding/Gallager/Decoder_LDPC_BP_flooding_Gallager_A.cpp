@@ -39,34 +39,29 @@ Decoder_LDPC_BP_flooding_Gallager_A<B, R>::Decoder_LDPC_BP_flooding_Gallager_A(
 
     std::vector<unsigned char> connections(this->H.get_n_rows(), 0);
 
-    const auto& chk_to_var_id = this->H.get_col_to_rows();
-    const auto& var_to_chk_id = this->H.get_row_to_cols();
+    // the branches are stored per check node in 'transpose' and per variable node in the messages: the branches of
+    // the variable node 'var_id' start at 'var_to_chk_off[var_id]'
+    const auto& chk_to_var_id = this->H.get_col_indices();
+    const auto& var_to_chk_off = this->H.get_row_offsets();
 
-    auto k = 0;
-    for (auto i = 0; i < (int)chk_to_var_id.size(); i++)
+    for (size_t k = 0; k < chk_to_var_id.size(); k++)
     {
-        for (auto j = 0; j < (int)chk_to_var_id[i].size(); j++)
-        {
-            auto var_id = chk_to_var_id[i][j];
-
-            auto branch_id = 0;
-            for (auto ii = 0; ii < (int)var_id; ii++)
-                branch_id += (int)var_to_chk_id[ii].size();
-            branch_id += connections[var_id];
-            connections[var_id]++;
+        const auto var_id = chk_to_var_id[k];
+        const auto var_degree = (int)(var_to_chk_off[var_id + 1] - var_to_chk_off[var_id]);
 
-            if (connections[var_id] > (int)var_to_chk_id[var_id].size())
-            {
-                std::stringstream message;
-                message << "'connections[var_id]' has to be equal or smaller than 'var_to_chk_id[var_id].size()' "
-                        << "('var_id' = " << var_id << ", 'connections[var_id]' = " << connections[var_id]
-                        << ", 'var_to_chk_id[var_id].size()' = " << var_to_chk_id[var_id].size() << ").";
-                throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-            }
+        const auto branch_id = (int)var_to_chk_off[var_id] + connections[var_id];
+        connections[var_id]++;
 
-            transpose[k] = branch_id;
-            k++;
+        if (connections[var_id] > var_degree)
+        {
+            std::stringstream message;
+            message << "'connections[var_id]' has to be equal or smaller than 'var_degree' "
+                    << "('var_id' = " << var_id << ", 'connections[var_id]' = " << connections[var_id]
+                    << ", 'var_degree' = " << var_degree << ").";
+            throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
         }
+
+        transpose[k] = branch_id;
     }
 }
 
@@ -260,7 +255,7 @@ Decoder_LDPC_BP_flooding_Gallager_A<B, R>::_initialize_var_to_chk(const B* Y_N,
     const auto n_var_nodes = (int)this->H.get_n_rows();
     for (auto v = 0; v < n_var_nodes; v++)
     {
-        const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+        const auto var_degree = (int)this->H.get_cols_from_row(v).size();
         const auto cur_state = (int8_t)Y_N[v];
 
         if (first_ite)
@@ -297,7 +292,7 @@ Decoder_LDPC_BP_flooding_Gallager_A<B, R>::_decode_single_ite(const std::vector<
     const auto n_chk_nodes = (int)this->H.get_n_cols();
     for (auto c = 0; c < n_chk_nodes; c++)
     {
-        const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
+        const auto chk_degree = (int)this->H.get_rows_from_col(c).size();
 
         auto acc = 0;
         for (auto v = 0; v < chk_degree; v++)
@@ -320,7 +315,7 @@ Decoder_LDPC_BP_flooding_Gallager_A<B, R>::_make_majority_vote(const B* Y_N, std
     const auto n_var_nodes = (int)this->H.get_n_rows();
     for (auto v = 0; v < n_var_nodes; v++)
     {
-        const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+        const auto var_degree = (int)this->H.get_cols_from_row(v).size();
         const auto cur_state = Y_N[v];
         const auto n_ones = std::accumulate(chk_to_var_ptr, chk_to_var_ptr + var_degree, (int)0);
         const auto n_zero = var_degree - n_ones;
@@ -329,7 +324,7 @@ Decoder_LDPC_BP_flooding_Gallager_A<B, R>::_make_majority_vote(const B* Y_N, std
         chk_to_var_ptr += var_degree;
 
         // // naive version of the majority vote
-        // const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+        // const auto var_degree = (int)this->H.get_cols_from_row(v).size();
         // auto count = 0;
         // for (auto c = 0; c < var_degree; c++)
         // 	count += chk_to_var_ptr[c] ? 1 : -1;
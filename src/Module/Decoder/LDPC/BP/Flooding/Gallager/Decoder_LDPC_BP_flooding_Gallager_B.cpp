@@ -50,7 +50,7 @@ Decoder_LDPC_BP_flooding_Gallager_B<B, R>::_initialize_var_to_chk(const B* Y_N,
     const auto n_var_nodes = (int)this->H.get_n_rows();
     for (auto v = 0; v < n_var_nodes; v++)
     {
-        const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+        const auto var_degree = (int)this->H.get_cols_from_row(v).size();
         const auto cur_state = (int8_t)Y_N[v];
 
         if (first_ite)
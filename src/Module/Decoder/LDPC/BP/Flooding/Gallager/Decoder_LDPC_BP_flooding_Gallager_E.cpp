@@ -73,7 +73,7 @@ Decoder_LDPC_BP_flooding_Gallager_E<B, R>::_initialize_var_to_chk(const B* Y_N,
     const auto n_var_nodes = (int)this->H.get_n_rows();
     for (auto v = 0; v < n_var_nodes; v++)
     {
-        const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+        const auto var_degree = (int)this->H.get_cols_from_row(v).size();
         const auto cur_state = (int8_t)Y_N[v];
 
         if (first_ite)
@@ -109,7 +109,7 @@ Decoder_LDPC_BP_flooding_Gallager_E<B, R>::_decode_single_ite(const std::vector<
     const auto n_chk_nodes = (int)this->H.get_n_cols();
     for (auto c = 0; c < n_chk_nodes; c++)
     {
-        const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
+        const auto chk_degree = (int)this->H.get_rows_from_col(c).size();
 
         for (auto v = 0; v < chk_degree; v++)
         {
@@ -134,7 +134,7 @@ Decoder_LDPC_BP_flooding_Gallager_E<B, R>::_make_majority_vote(const B* Y_N, std
     const auto n_var_nodes = (int)this->H.get_n_rows();
     for (auto v = 0; v < n_var_nodes; v++)
     {
-        const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+        const auto var_degree = (int)this->H.get_cols_from_row(v).size();
         const auto cur_state = Y_N[v];
 
         auto sum = std::accumulate(chk_to_var_ptr, chk_to_var_ptr + var_degree, (int)0);
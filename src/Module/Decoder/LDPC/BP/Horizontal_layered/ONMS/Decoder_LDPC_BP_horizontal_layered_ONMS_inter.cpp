@@ -22,9 +22,10 @@ Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::Decoder_LDPC_BP_horizontal_
   const float normalize_factor,
   const R offset,
   const bool enable_syndrome,
-  const int syndrome_depth)
+  const int syndrome_depth,
+  const bool lane_refill)
   : Decoder_SISO<B, R>(K, N)
-  , Decoder_LDPC_BP(K, N, n_ite, _H, enable_syndrome, syndrome_depth)
+  , Decoder_LDPC_BP_lane_refill<B, R>(K, N, n_ite, _H, enable_syndrome, syndrome_depth)
   , normalize_factor(normalize_factor)
   , offset(offset)
   , contributions(this->H.get_cols_max_degree())
@@ -54,6 +55,7 @@ Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::Decoder_LDPC_BP_horizontal_
         throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
+    this->set_lane_refill(lane_refill);
     this->reset();
 }
 
@@ -98,6 +100,13 @@ Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::_decode_siso(const R* Y_N1,
                                                                   R* Y_N2,
                                                                   const size_t frame_id)
 {
+    if (this->lane_refill)
+    {
+        std::stringstream message;
+        message << "The lane refill mode is not supported by the 'decode_siso' task.";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
     // memory zones initialization
     this->_load(Y_N1, frame_id);
 
@@ -159,6 +168,8 @@ Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::_decode_siho(const R* Y_N,
                                                                   B* V_K,
                                                                   const size_t frame_id)
 {
+    if (this->lane_refill) return this->_decode_lane_refill(Y_N, CWD, V_K, (int)this->get_n_frames(), false);
+
     //	auto t_load = std::chrono::steady_clock::now(); // -----------------------------------------------------------
     // LOAD
     this->_load(Y_N, frame_id);
@@ -236,6 +247,8 @@ Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::_decode_siho_cw(const R* Y_
                                                                      B* V_N,
                                                                      const size_t frame_id)
 {
+    if (this->lane_refill) return this->_decode_lane_refill(Y_N, CWD, V_N, (int)this->get_n_frames(), true);
+
     //	auto t_load = std::chrono::steady_clock::now(); // -----------------------------------------------------------
     // LOAD
     this->_load(Y_N, frame_id);
@@ -430,17 +443,18 @@ Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::_decode_single_ite(mipp::ve
 
     const auto zero_msk = mipp::Msk<mipp::N<B>()>(false);
     const auto zero = mipp::Reg<R>((R)0);
-    const auto n_chk_nodes = (int)H.get_n_cols();
+    const auto n_chk_nodes = (int)this->H.get_n_cols();
     for (auto c = 0; c < n_chk_nodes; c++)
     {
         auto sign = zero_msk;
         auto min1 = mipp::Reg<R>(std::numeric_limits<R>::max());
         auto min2 = mipp::Reg<R>(std::numeric_limits<R>::max());
 
-        const auto chk_degree = (int)this->H[c].size();
+        const auto chk_vars = this->H.get_rows_from_col(c);
+        const auto chk_degree = (int)chk_vars.size();
         for (auto v = 0; v < chk_degree; v++)
         {
-            contributions[v] = var_nodes[this->H[c][v]] - branches[kr++];
+            contributions[v] = var_nodes[chk_vars[v]] - branches[kr++];
             const auto var_abs = mipp::abs(contributions[v]);
             const auto var_sign = mipp::sign(contributions[v]);
             const auto tmp = min1;
@@ -465,7 +479,7 @@ Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::_decode_single_ite(mipp::ve
             const auto res = mipp::copysign(res_abs, res_sng);
 
             branches[kw++] = res;
-            var_nodes[this->H[c][v]] = contributions[v] + res;
+            var_nodes[chk_vars[v]] = contributions[v] + res;
         }
     }
 }
@@ -478,16 +492,17 @@ Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::_check_syndrome(const size_
     const auto zero = mipp::Msk<mipp::N<B>()>(false);
     auto syndrome = zero;
 
-    auto n_chk_nodes = (int)H.get_n_cols();
+    auto n_chk_nodes = (int)this->H.get_n_cols();
     auto c = 0;
     auto syndrome_scalar = true;
     while (c < n_chk_nodes && (syndrome_scalar = mipp::testz(syndrome)))
     {
         auto sign = zero;
-        const auto chk_degree = (int)this->H[c].size();
+        const auto chk_vars = this->H.get_rows_from_col(c);
+        const auto chk_degree = (int)chk_vars.size();
         for (auto v = 0; v < chk_degree; v++)
         {
-            const auto value = this->var_nodes[cur_wave][this->H[c][v]];
+            const auto value = this->var_nodes[cur_wave][chk_vars[v]];
             sign ^= mipp::sign(value);
         }
 
@@ -506,16 +521,17 @@ Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::_check_syndrome_status(cons
     const auto zero = mipp::Msk<mipp::N<B>()>(false);
     auto syndrome = zero;
 
-    auto n_chk_nodes = (int)H.get_n_cols();
+    auto n_chk_nodes = (int)this->H.get_n_cols();
     auto c = 0;
     auto syndrome_scalar = true;
     while (c < n_chk_nodes)
     {
         auto sign = zero;
-        const auto chk_degree = (int)this->H[c].size();
+        const auto chk_vars = this->H.get_rows_from_col(c);
+        const auto chk_degree = (int)chk_vars.size();
         for (auto v = 0; v < chk_degree; v++)
         {
-            const auto value = this->var_nodes[cur_wave][this->H[c][v]];
+            const auto value = this->var_nodes[cur_wave][chk_vars[v]];
             sign ^= mipp::sign(value);
         }
 
@@ -556,6 +572,93 @@ Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::set_n_frames(const size_t n
     }
 }
 
+template<typename B, typename R>
+void
+Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::set_lane_refill(const bool lane_refill)
+{
+    this->lane_refill = lane_refill;
+    this->set_single_wave(lane_refill);
+}
+
+template<typename B, typename R>
+void
+Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::_load_lane(const R* Y_N, const int frame, const int lane)
+{
+    const auto n_lanes = (size_t)mipp::N<R>();
+    R* var_nodes = (R*)this->var_nodes[0].data();
+    R* branches = (R*)this->branches[0].data();
+
+    if (frame >= 0)
+        for (size_t v = 0; v < (size_t)this->N; v++)
+            var_nodes[v * n_lanes + lane] = Y_N[frame * this->N + v];
+    else
+        for (size_t v = 0; v < (size_t)this->N; v++)
+            var_nodes[v * n_lanes + lane] = (R)0;
+
+    const auto n_connections = this->branches[0].size();
+    for (size_t e = 0; e < n_connections; e++)
+        branches[e * n_lanes + lane] = (R)0;
+}
+
+template<typename B, typename R>
+void
+Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::_store_lane(B* V,
+                                                                 const int frame,
+                                                                 const int lane,
+                                                                 const bool codeword)
+{
+    const auto n_lanes = (size_t)mipp::N<R>();
+    const R* var_nodes = (const R*)this->var_nodes[0].data();
+
+    if (codeword)
+        for (size_t v = 0; v < (size_t)this->N; v++)
+            V[frame * this->N + v] = (B)(var_nodes[v * n_lanes + lane] < 0);
+    else
+        for (size_t k = 0; k < (size_t)this->K; k++)
+            V[frame * this->K + k] = (B)(var_nodes[this->info_bits_pos[k] * n_lanes + lane] < 0);
+}
+
+template<typename B, typename R>
+mipp::Msk<mipp::N<R>()>
+Decoder_LDPC_BP_horizontal_layered_ONMS_inter<B, R>::_decode_single_ite_lanes(const int ite)
+{
+    if (typeid(R) == typeid(short) || typeid(R) == typeid(signed char))
+    {
+        if (normalize_factor == 0.125f)
+            this->_decode_single_ite<1>(this->var_nodes[0], this->branches[0]);
+        else if (normalize_factor == 0.250f)
+            this->_decode_single_ite<2>(this->var_nodes[0], this->branches[0]);
+        else if (normalize_factor == 0.375f)
+            this->_decode_single_ite<3>(this->var_nodes[0], this->branches[0]);
+        else if (normalize_factor == 0.500f)
+            this->_decode_single_ite<4>(this->var_nodes[0], this->branches[0]);
+        else if (normalize_factor == 0.625f)
+            this->_decode_single_ite<5>(this->var_nodes[0], this->branches[0]);
+        else if (normalize_factor == 0.750f)
+            this->_decode_single_ite<6>(this->var_nodes[0], this->branches[0]);
+        else if (normalize_factor == 0.875f)
+            this->_decode_single_ite<7>(this->var_nodes[0], this->branches[0]);
+        else if (normalize_factor == 1.000f)
+            this->_decode_single_ite<8>(this->var_nodes[0], this->branches[0]);
+        else
+        {
+            std::stringstream message;
+            message << "'normalize_factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f"
+                    << " ('normalize_factor' = " << normalize_factor << ").";
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+    }
+    else // float or double
+    {
+        if (normalize_factor == 1.000f)
+            this->_decode_single_ite<8>(this->var_nodes[0], this->branches[0]);
+        else
+            this->_decode_single_ite<0>(this->var_nodes[0], this->branches[0]);
+    }
+
+    return this->_check_syndrome_soft_lanes(this->var_nodes[0]);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -20,6 +20,7 @@ Decoder_LDPC_BP_peeling<B, R>::Decoder_LDPC_BP_peeling(const int K,
   : Decoder_SIHO<B, R>(K, N)
   , Decoder_LDPC_BP(K, N, n_ite, _H, enable_syndrome, syndrome_depth)
   , info_bits_pos(info_bits_pos)
+  , H_links(_H)
   , var_nodes(N)
   , check_nodes(this->H.get_n_cols())
 {
@@ -45,7 +46,7 @@ bool
 Decoder_LDPC_BP_peeling<B, R>::_decode(const size_t frame_id)
 {
     this->cur_syndrome_depth = 0;
-    auto links = this->H;
+    auto links = this->H_links;
 
     auto& CN = this->check_nodes;
     auto& VN = this->var_nodes;
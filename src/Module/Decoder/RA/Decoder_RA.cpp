@@ -117,7 +117,7 @@ Decoder_RA<B, R>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_id)
             Tu[i] = check_node(Fw[i - 1] + Y_N[i - 1], Bw[i] + Y_N[i]);
 
         // Deinterleave
-        interleaver->deinterleave(Tu.data(), Wu.data(), frame_id, false);
+        interleaver->get_core().deinterleave(Tu.data(), Wu.data(), frame_id, interleaver->get_n_frames_per_wave());
 
         // U computation
         R tmp;
@@ -132,7 +132,7 @@ Decoder_RA<B, R>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_id)
         }
 
         // Interleaving
-        interleaver->interleave(Wd.data(), Td.data(), frame_id, false);
+        interleaver->get_core().interleave(Wd.data(), Td.data(), frame_id, interleaver->get_n_frames_per_wave());
     }
     //	auto d_decod = std::chrono::steady_clock::now() - t_decod;
 
@@ -52,6 +52,10 @@ Decoder_turbo<B, R>::Decoder_turbo(const int& K,
     (*this->pi.get())[itl::tsk::interleave_reordering].set_fast(true);
     (*this->pi.get())[itl::tsk::deinterleave_reordering].set_fast(true);
 
+    // the SISO decoders can keep a state between the iterations of a frame, it is reset by the turbo decoder
+    this->siso_n->set_auto_reset(false);
+    this->siso_i->set_auto_reset(false);
+
     if (siso_n.get_K() != K)
     {
         std::stringstream message;
@@ -125,6 +129,14 @@ Decoder_turbo<B, R>::clone() const
     throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
 }
 
+template<typename B, typename R>
+void
+Decoder_turbo<B, R>::_reset(const size_t frame_id)
+{
+    this->siso_n->reset((int)frame_id);
+    this->siso_i->reset((int)frame_id);
+}
+
 template<typename B, typename R>
 void
 Decoder_turbo<B, R>::deep_copy(const Decoder_turbo<B, R>& m)
@@ -167,7 +179,7 @@ Decoder_turbo<B, R>::buffered_load(const R* Y_N, const size_t frame_id)
         std::copy(Y_N + siso_n->get_K() + siso_n->tail_length() / 2, Y_N + siso_n->get_N(), l_pn.begin());
         std::copy(Y_N + siso_n->get_N(), Y_N + siso_n->get_N() + siso_i->tail_length() / 2, l_si.begin() + this->K);
         std::copy(Y_N + siso_n->get_N() + siso_i->tail_length() / 2, Y_N + this->N, l_pi.begin());
-        pi->interleave(l_sn.data(), l_si.data(), frame_id, false);
+        pi->get_core().interleave(l_sn.data(), l_si.data(), frame_id, pi->get_n_frames_per_wave());
     }
     else
     {
@@ -190,7 +202,7 @@ Decoder_turbo<B, R>::buffered_load(const R* Y_N, const size_t frame_id)
             frames[f] = Y_N + f * this->N + siso_n->get_N() + siso_i->tail_length() / 2;
         tools::Reorderer<R>::apply(frames, l_pi.data(), siso_i->get_K() + siso_i->tail_length() / 2);
 
-        pi->interleave_reordering(l_sn.data(), l_si.data(), frame_id, false);
+        pi->get_core().interleave_reordering(l_sn.data(), l_si.data(), frame_id, pi->get_n_frames_per_wave());
     }
     std::fill(l_e1n.begin(), l_e1n.end(), (R)0);
 }
@@ -210,7 +222,7 @@ Decoder_turbo<B, R>::standard_load(const R* Y_N, const size_t frame_id)
             l_pn[i] = Y_N[i * 3 + 1];
             l_pi[i] = Y_N[i * 3 + 2];
         }
-        pi->interleave(l_sn.data(), l_si.data(), frame_id, false);
+        pi->get_core().interleave(l_sn.data(), l_si.data(), frame_id, pi->get_n_frames_per_wave());
 
         // tails bit in the natural domain
         for (auto i = 0; i < tail_n / 2; i++)
@@ -239,7 +251,7 @@ Decoder_turbo<B, R>::standard_load(const R* Y_N, const size_t frame_id)
                 l_pi[i * n_frames + j] = Y_N[j * ((this->K * 3) + tail_n + tail_i) + i * 3 + 2];
             }
         }
-        pi->interleave_reordering(l_sn.data(), l_si.data(), frame_id, false);
+        pi->get_core().interleave_reordering(l_sn.data(), l_si.data(), frame_id, pi->get_n_frames_per_wave());
 
         // tails bit in the natural domain
         for (auto i = 0; i < tail_n / 2; i++)
@@ -55,7 +55,7 @@ Decoder_turbo_fast<B, R>::_load(const R* Y_N, const size_t frame_id)
                 frames[f] = Y_N + f * this->N + this->siso_n->get_N() + tail_i / 2;
             tools::Reorderer_static<R, n_frames>::apply(frames, this->l_pi.data(), this->siso_i->get_K() + tail_i / 2);
 
-            this->pi->interleave_reordering(this->l_sn.data(), this->l_si.data(), frame_id, false);
+            this->pi->get_core().interleave_reordering(this->l_sn.data(), this->l_si.data(), frame_id, n_frames);
         }
         else
         {
@@ -78,7 +78,7 @@ Decoder_turbo_fast<B, R>::_load(const R* Y_N, const size_t frame_id)
                 frames[f] = Y_N + f * this->N + this->siso_n->get_N() + tail_i / 2;
             tools::Reorderer_static<R, n_frames>::apply(frames, this->l_pi.data(), this->siso_i->get_K() + tail_i / 2);
 
-            this->pi->interleave_reordering(this->l_sn.data(), this->l_si.data(), frame_id, false);
+            this->pi->get_core().interleave_reordering(this->l_sn.data(), this->l_si.data(), frame_id, n_frames);
         }
 
         std::fill(this->l_e1n.begin(), this->l_e1n.end(), (R)0);
@@ -139,9 +139,9 @@ Decoder_turbo_fast<B, R>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_
         {
             // make the interleaving
             if (n_frames > 1)
-                this->pi->interleave_reordering(this->l_e2n.data(), this->l_e1i.data(), frame_id, false);
+                this->pi->get_core().interleave_reordering(this->l_e2n.data(), this->l_e1i.data(), frame_id, n_frames);
             else
-                this->pi->interleave(this->l_e2n.data(), this->l_e1i.data(), frame_id, false);
+                this->pi->get_core().interleave(this->l_e2n.data(), this->l_e1i.data(), frame_id, n_frames);
 
             // l_se = sys + ext
             for (size_t i = 0; i < this->K * n_frames; i += mipp::nElReg<R>())
@@ -172,9 +172,10 @@ Decoder_turbo_fast<B, R>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_
 
             // make the deinterleaving
             if (n_frames > 1)
-                this->pi->deinterleave_reordering(this->l_e2i.data(), this->l_e1n.data(), frame_id, false);
+                this->pi->get_core().deinterleave_reordering(
+                  this->l_e2i.data(), this->l_e1n.data(), frame_id, n_frames);
             else
-                this->pi->deinterleave(this->l_e2i.data(), this->l_e1n.data(), frame_id, false);
+                this->pi->get_core().deinterleave(this->l_e2i.data(), this->l_e1n.data(), frame_id, n_frames);
 
             // compute the hard decision only if we are in the last iteration
             if (ite == this->n_ite || stop) tools::hard_decide(this->l_e1n.data(), this->s.data(), this->K * n_frames);
@@ -71,9 +71,9 @@ Decoder_turbo_std<B, R>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_i
         {
             // make the interleaving
             if (n_frames > 1)
-                this->pi->interleave_reordering(this->l_e2n.data(), this->l_e1i.data(), frame_id, false);
+                this->pi->get_core().interleave_reordering(this->l_e2n.data(), this->l_e1i.data(), frame_id, n_frames);
             else
-                this->pi->interleave(this->l_e2n.data(), this->l_e1i.data(), frame_id, false);
+                this->pi->get_core().interleave(this->l_e2n.data(), this->l_e1i.data(), frame_id, n_frames);
 
             // sys + ext
             for (size_t i = 0; i < this->K * n_frames; i++)
@@ -98,9 +98,10 @@ Decoder_turbo_std<B, R>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_i
 
             // make the deinterleaving
             if (n_frames > 1)
-                this->pi->deinterleave_reordering(this->l_e2i.data(), this->l_e1n.data(), frame_id, false);
+                this->pi->get_core().deinterleave_reordering(
+                  this->l_e2i.data(), this->l_e1n.data(), frame_id, n_frames);
             else
-                this->pi->deinterleave(this->l_e2i.data(), this->l_e1n.data(), frame_id, false);
+                this->pi->get_core().deinterleave(this->l_e2i.data(), this->l_e1n.data(), frame_id, n_frames);
 
             // compute the hard decision only if we are in the last iteration
             if (ite == this->n_ite || stop) tools::hard_decide(this->l_e1n.data(), this->s.data(), this->K * n_frames);
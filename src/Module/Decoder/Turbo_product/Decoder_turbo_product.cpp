@@ -210,11 +210,17 @@ Decoder_turbo_product<B, R>::_decode(const R* Y_N_cha, const size_t frame_id, in
     const int n_cols = cp_r->get_N();
     const int n_rows = cp_c->get_N();
 
-    pi->interleave(Y_N_cha, Y_N_cha_i.data(), frame_id, false); // interleave data from the channel
+    pi->get_core().interleave(Y_N_cha,
+                              Y_N_cha_i.data(),
+                              frame_id,
+                              pi->get_n_frames_per_wave()); // interleave data from the channel
 
     for (int i = 0; i < n_ite; i++)
     {
-        pi->interleave(Y_N_i.data(), Y_N_pi.data(), frame_id, false); // columns becomes rows
+        pi->get_core().interleave(Y_N_i.data(),
+                                  Y_N_pi.data(),
+                                  frame_id,
+                                  pi->get_n_frames_per_wave()); // columns becomes rows
 
         if (beta.size())
         {
@@ -237,7 +243,10 @@ Decoder_turbo_product<B, R>::_decode(const R* Y_N_cha, const size_t frame_id, in
             }
         }
 
-        pi->deinterleave(Y_N_pi.data(), Y_N_i.data(), frame_id, false); // rows go back as columns
+        pi->get_core().deinterleave(Y_N_pi.data(),
+                                    Y_N_i.data(),
+                                    frame_id,
+                                    pi->get_n_frames_per_wave()); // rows go back as columns
 
         // decode each row
         if (i < (n_ite - 1) || return_K_siso >= 2)
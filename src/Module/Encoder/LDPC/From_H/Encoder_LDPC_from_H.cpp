@@ -1,11 +1,17 @@
+#include <algorithm>
+#include <cstdio>
+#include <exception>
 #include <fstream>
+#include <iomanip>
 #include <sstream>
 #include <streampu.hpp>
+#include <utility>
 
 #include "Module/Encoder/LDPC/From_H/Encoder_LDPC_from_H.hpp"
 #include "Tools/Algo/Matrix/Matrix.hpp"
 #include "Tools/Code/LDPC/AList/AList.hpp"
 #include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
+#include "Tools/Perf/common/bit_packing.h"
 
 using namespace aff3ct;
 using namespace aff3ct::module;
@@ -13,6 +19,36 @@ using namespace aff3ct::module;
 template<typename B>
 std::thread::id aff3ct::module::Encoder_LDPC_from_H<B>::master_thread_id = std::this_thread::get_id();
 
+static const std::string hash_line = "# Hash of the H parity matrix and of the G generation method:";
+
+// 64-bit FNV-1a hash of the dimensions and of the connections of H, and of the generation method of G
+static uint64_t
+compute_H_hash(const tools::Sparse_matrix& H, const std::string& G_method)
+{
+    uint64_t hash = 14695981039346656037ull;
+    auto add = [&hash](const uint64_t v)
+    {
+        for (auto b = 0; b < 8; b++)
+        {
+            hash ^= (v >> (8 * b)) & 0xFF;
+            hash *= 1099511628211ull;
+        }
+    };
+
+    for (auto c : G_method)
+        add((uint64_t)(unsigned char)c);
+    add(H.get_n_rows());
+    add(H.get_n_cols());
+    for (const auto& cols : H.get_row_to_cols())
+    {
+        add(cols.size());
+        for (auto c : cols)
+            add(c);
+    }
+
+    return hash;
+}
+
 template<typename B>
 Encoder_LDPC_from_H<B>::Encoder_LDPC_from_H(const int K,
                                             const int N,
@@ -21,6 +57,7 @@ Encoder_LDPC_from_H<B>::Encoder_LDPC_from_H(const int K,
                                             const std::string& G_save_path,
                                             const bool G_save_path_single_thread)
   : Encoder_LDPC<B>(K, N)
+  , ALT(G_method == "RU")
 {
     const std::string name = "Encoder_LDPC_from_H";
     this->set_name(name);
@@ -29,35 +66,29 @@ Encoder_LDPC_from_H<B>::Encoder_LDPC_from_H(const int K,
 
     this->H = _H.turn(tools::Matrix::Way::HORIZONTAL);
 
-    if (G_method == "IDENTITY")
-        this->G = tools::LDPC_matrix_handler::transform_H_to_G_identity(this->H, this->info_bits_pos);
-    else if (G_method == "LU_DEC")
-        this->G = tools::LDPC_matrix_handler::transform_H_to_G_decomp_LU(this->H, this->info_bits_pos);
-    else
-    {
-        std::stringstream message;
-        message << "Generation method of G 'G_method' is unknown ('G_method' = \"" << G_method << "\").";
-        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
-    }
-
-    if (G_save_path != "")
+    // the G matrix saved by a previous run is reused if it has been built from the same H with the same method
+    const auto H_hash = this->ALT ? 0 : compute_H_hash(this->H, G_method);
+    if (this->ALT)
+        this->init_ALT();
+    else if (G_save_path == "" || !this->load_G(G_save_path, H_hash))
     {
-        if (!G_save_path_single_thread || this->master_thread_id == std::this_thread::get_id())
+        if (G_method == "IDENTITY")
+            this->G = tools::LDPC_matrix_handler::transform_H_to_G_identity(this->H, this->info_bits_pos);
+        else if (G_method == "LU_DEC")
+            this->G = tools::LDPC_matrix_handler::transform_H_to_G_decomp_LU(this->H, this->info_bits_pos);
+        else
         {
-            std::ofstream file(G_save_path);
-            if (!file.is_open())
-            {
-                std::stringstream message;
-                message << "'G_save_path' could not be opened ('G_save_path' = \"" << G_save_path << "\").";
-                throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
-            }
-
-            tools::AList::write(this->G, file);
-            tools::AList::write_info_bits_pos(this->info_bits_pos, file);
+            std::stringstream message;
+            message << "Generation method of G 'G_method' is unknown ('G_method' = \"" << G_method << "\").";
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
         }
+
+        if (G_save_path != "")
+            if (!G_save_path_single_thread || this->master_thread_id == std::this_thread::get_id())
+                this->save_G(G_save_path, H_hash);
     }
 
-    this->check_G_dimensions();
+    if (!this->ALT) this->check_G_dimensions();
     this->check_H_dimensions();
 }
 
@@ -70,6 +101,307 @@ Encoder_LDPC_from_H<B>::clone() const
     return m;
 }
 
+template<typename B>
+void
+Encoder_LDPC_from_H<B>::init_ALT()
+{
+    const auto M = this->H.get_n_rows();
+    const auto N = this->H.get_n_cols();
+
+    enum class Col : int8_t
+    {
+        UNKNOWN,
+        DIAGONAL,
+        KNOWN
+    };
+    enum class Row : int8_t
+    {
+        FREE,
+        TRIANGLE,
+        GAP
+    };
+    std::vector<Col> cols(N, Col::UNKNOWN);
+    std::vector<Row> rows(M, Row::FREE);
+    std::vector<uint32_t> degrees(M); // number of UNKNOWN columns in the FREE rows
+    std::vector<uint32_t> tri_rows, gap_rows, known_cols, deg1_rows;
+
+    for (size_t r = 0; r < M; r++)
+    {
+        degrees[r] = (uint32_t)this->H.get_cols_from_row(r).size();
+        if (degrees[r] == 1) deg1_rows.push_back((uint32_t)r);
+    }
+
+    auto set_col = [&](const uint32_t c, const Col state)
+    {
+        cols[c] = state;
+        for (auto r : this->H.get_rows_from_col(c))
+            if (rows[r] == Row::FREE && --degrees[r] == 1) deg1_rows.push_back(r);
+    };
+
+    // greedy triangulation: the rows with a single UNKNOWN column extend the diagonal of T, when there is none the
+    // UNKNOWN columns of the FREE row of minimal degree are declared KNOWN (information or 'p1' bits) except one
+    while (true)
+    {
+        while (!deg1_rows.empty())
+        {
+            const auto r = deg1_rows.back();
+            deg1_rows.pop_back();
+            if (rows[r] != Row::FREE || degrees[r] != 1) continue;
+
+            const auto& links = this->H.get_cols_from_row(r);
+            const auto c = *std::find_if(links.begin(),
+                                         links.end(),
+                                         [&cols](const uint32_t c) { return cols[c] == Col::UNKNOWN; });
+            rows[r] = Row::TRIANGLE;
+            tri_rows.push_back(r);
+            this->tri_cols.push_back(c);
+            set_col(c, Col::DIAGONAL);
+        }
+
+        // the FREE rows without UNKNOWN column are the gap rows
+        auto best = M;
+        for (size_t r = 0; r < M; r++)
+            if (rows[r] == Row::FREE)
+            {
+                if (degrees[r] == 0)
+                {
+                    rows[r] = Row::GAP;
+                    gap_rows.push_back((uint32_t)r);
+                }
+                else if (best == M || degrees[r] < degrees[best])
+                    best = r;
+            }
+        if (best == M) break;
+
+        // the UNKNOWN column of lowest degree is kept for the diagonal, the others reduce more rows
+        std::vector<uint32_t> unknown;
+        for (auto c : this->H.get_cols_from_row(best))
+            if (cols[c] == Col::UNKNOWN) unknown.push_back(c);
+        std::sort(unknown.begin(),
+                  unknown.end(),
+                  [this](const uint32_t a, const uint32_t b)
+                  { return this->H.get_rows_from_col(a).size() > this->H.get_rows_from_col(b).size(); });
+        for (size_t i = 0; i < unknown.size() - 1; i++)
+        {
+            known_cols.push_back(unknown[i]);
+            set_col(unknown[i], Col::KNOWN);
+        }
+    }
+
+    // the columns not involved in the FREE rows are KNOWN
+    for (size_t c = 0; c < N; c++)
+        if (cols[c] == Col::UNKNOWN)
+        {
+            known_cols.push_back((uint32_t)c);
+            cols[c] = Col::KNOWN;
+        }
+
+    const auto g = gap_rows.size();
+    if (known_cols.size() != (size_t)this->K + g)
+    {
+        std::stringstream message;
+        message << "'K' has to be equal to the number of columns minus the number of rows of H ('K' = " << this->K
+                << ", 'H.get_n_cols()' = " << N << ", 'H.get_n_rows()' = " << M << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->tri_offsets.assign(1, 0);
+    for (size_t t = 0; t < tri_rows.size(); t++)
+    {
+        for (auto c : this->H.get_cols_from_row(tri_rows[t]))
+            if (c != this->tri_cols[t]) this->tri_links.push_back(c);
+        this->tri_offsets.push_back((uint32_t)this->tri_links.size());
+    }
+
+    this->gap_offsets.assign(1, 0);
+    for (auto r : gap_rows)
+    {
+        const auto& links = this->H.get_cols_from_row(r);
+        this->gap_links.insert(this->gap_links.end(), links.begin(), links.end());
+        this->gap_offsets.push_back((uint32_t)this->gap_links.size());
+    }
+
+    // [C D E] - E T^-1 [A B T] is computed on the gap rows (the T columns are eliminated from the last one, a row of
+    // T only contains its diagonal column, the previous ones and KNOWN columns), an identity is appended to get the
+    // inverse of phi
+    tools::GF2_matrix phi(g, N + g);
+    for (size_t j = 0; j < g; j++)
+    {
+        for (auto c : this->H.get_cols_from_row(gap_rows[j]))
+            phi.flip(j, c);
+        phi.flip(j, N + j);
+    }
+    for (auto t = tri_rows.size(); t > 0; t--)
+        for (size_t j = 0; j < g; j++)
+            if (phi.get(j, this->tri_cols[t - 1]))
+                for (auto c : this->H.get_cols_from_row(tri_rows[t - 1]))
+                    phi.flip(j, c);
+
+    // the 'p1' bits are the pivots of the Gauss-Jordan elimination of phi on the KNOWN columns, if H is rank
+    // deficient 'g - rank' other KNOWN columns are set to 0 (they are neither parity nor information bits)
+    size_t rank = 0;
+    for (auto c : known_cols)
+    {
+        if (rank == g) break;
+
+        auto j = rank;
+        while (j < g && !phi.get(j, c))
+            j++;
+        if (j == g) continue;
+
+        phi.swap_rows(rank, j);
+        for (size_t j2 = 0; j2 < g; j2++)
+            if (j2 != rank && phi.get(j2, c)) phi.xor_rows(j2, rank);
+
+        this->p1_cols.push_back(c);
+        cols[c] = Col::DIAGONAL;
+        rank++;
+    }
+    for (auto it = known_cols.begin(); it != known_cols.end() && rank < g; it++)
+        if (cols[*it] == Col::KNOWN)
+        {
+            cols[*it] = Col::DIAGONAL;
+            rank++;
+        }
+
+    this->phi_inv = tools::GF2_matrix(this->p1_cols.size(), g);
+    for (size_t i = 0; i < this->p1_cols.size(); i++)
+    {
+        auto row = this->phi_inv.get_row(i);
+        for (size_t w = 0; w < this->phi_inv.get_n_words(); w++)
+            row[w] = phi.get_bits(i, N + w * tools::GF2_matrix::word_size, tools::GF2_matrix::word_size);
+    }
+    this->syndrome.resize(this->phi_inv.get_n_words());
+
+    this->info_bits_pos.clear();
+    for (size_t c = 0; c < N; c++)
+        if (cols[c] == Col::KNOWN) this->info_bits_pos.push_back((uint32_t)c);
+}
+
+template<typename B>
+void
+Encoder_LDPC_from_H<B>::solve_T(B* X_N) const
+{
+    for (size_t t = 0; t < this->tri_cols.size(); t++)
+    {
+        B bit = 0;
+        for (auto l = this->tri_offsets[t]; l < this->tri_offsets[t + 1]; l++)
+            bit ^= X_N[this->tri_links[l]];
+        X_N[this->tri_cols[t]] = bit;
+    }
+}
+
+template<typename B>
+void
+Encoder_LDPC_from_H<B>::_encode(const B* U_K, B* X_N, const size_t frame_id)
+{
+    if (!this->ALT)
+    {
+        Encoder_LDPC<B>::_encode(U_K, X_N, frame_id);
+        return;
+    }
+
+    std::fill(X_N, X_N + this->N, (B)0);
+    for (auto k = 0; k < this->K; k++)
+        X_N[this->info_bits_pos[k]] = U_K[k];
+
+    // T^-1 A s, then the syndrome of the gap rows gives p1
+    this->solve_T(X_N);
+    if (this->p1_cols.empty()) return;
+
+    std::fill(this->syndrome.begin(), this->syndrome.end(), (uint64_t)0);
+    for (size_t j = 0; j + 1 < this->gap_offsets.size(); j++)
+    {
+        B bit = 0;
+        for (auto l = this->gap_offsets[j]; l < this->gap_offsets[j + 1]; l++)
+            bit ^= X_N[this->gap_links[l]];
+        this->syndrome[j / 64] |= (uint64_t)(bit & 1) << (j % 64);
+    }
+
+    for (size_t i = 0; i < this->p1_cols.size(); i++)
+    {
+        const auto row = this->phi_inv.get_row(i);
+        unsigned ones = 0;
+        for (size_t w = 0; w < this->syndrome.size(); w++)
+            ones += tools::popcount(row[w] & this->syndrome[w]);
+        X_N[this->p1_cols[i]] = (B)(ones & 1);
+    }
+
+    // T^-1 (A s + B p1)
+    this->solve_T(X_N);
+}
+
+template<typename B>
+bool
+Encoder_LDPC_from_H<B>::load_G(const std::string& G_save_path, const uint64_t H_hash)
+{
+    std::ifstream file(G_save_path);
+    if (!file.is_open()) return false;
+
+    std::stringstream hash;
+    hash << std::hex << std::setw(16) << std::setfill('0') << H_hash;
+
+    // the hash is written after the info bits positions
+    std::string line;
+    bool same_H = false;
+    while (std::getline(file, line))
+        if (line == hash_line)
+        {
+            same_H = std::getline(file, line) && line == hash.str();
+            break;
+        }
+    if (!same_H) return false;
+
+    file.clear();
+    file.seekg(0);
+
+    try
+    {
+        auto G = tools::AList::read(file);
+        auto info_bits_pos = tools::AList::read_info_bits_pos(file, this->K, this->N);
+
+        this->G = std::move(G);
+        this->info_bits_pos.assign(info_bits_pos.begin(), info_bits_pos.end());
+    }
+    catch (std::exception const&)
+    {
+        return false; // the file is corrupted, G is built again
+    }
+
+    return true;
+}
+
+template<typename B>
+void
+Encoder_LDPC_from_H<B>::save_G(const std::string& G_save_path, const uint64_t H_hash) const
+{
+    // the file is written aside and then renamed, a concurrent reader never sees a partial G
+    const std::string tmp_path = G_save_path + ".tmp";
+
+    {
+        std::ofstream file(tmp_path);
+        if (!file.is_open())
+        {
+            std::stringstream message;
+            message << "'G_save_path' could not be opened ('G_save_path' = \"" << G_save_path << "\").";
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        tools::AList::write(this->G, file);
+        tools::AList::write_info_bits_pos(this->info_bits_pos, file);
+        file << hash_line << std::endl;
+        file << std::hex << std::setw(16) << std::setfill('0') << H_hash << std::endl;
+    }
+
+    if (std::rename(tmp_path.c_str(), G_save_path.c_str()))
+    {
+        std::stringstream message;
+        message << "Impossible to rename the G matrix file ('tmp_path' = \"" << tmp_path << "\", 'G_save_path' = \""
+                << G_save_path << "\").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Encoder/LDPC/NR/Encoder_LDPC_NR.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template<typename B>
+Encoder_LDPC_NR<B>::Encoder_LDPC_NR(const tools::Sparse_matrix& H, const tools::nr_values& nr)
+  : Encoder_LDPC<B>(nr.K, nr.N)
+  , nr(nr)
+  , rows(nr.M_b)
+  , core_shifts(4, -1)
+  , x(-1)
+  , lambda(4 * nr.Z)
+{
+    const std::string name = "Encoder_LDPC_NR";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    this->H = H;
+    this->check_H_dimensions();
+
+    const auto kb = nr.K_b;
+    const auto& base = nr.base;
+
+    auto wrong_structure = [&](const int i, const int j)
+    {
+        std::stringstream message;
+        message << "The base graph does not have the 5G NR double-diagonal structure ('i' = " << i << ", 'j' = " << j
+                << ", 'base[i][j]' = " << base[i][j] << ", 'BG' = " << nr.BG << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    };
+
+    // core rows: the parity blocks kb+1, kb+2 and kb+3 are identity matrices on the rows (0,1), (1,2) and (2,3)
+    for (auto i = 0; i < 4; i++)
+    {
+        for (auto j = 0; j < kb; j++)
+            if (base[i][j] >= 0) rows[i].push_back(std::make_pair(j, (int)base[i][j]));
+
+        core_shifts[i] = base[i][kb];
+
+        for (auto j = kb + 1; j < nr.N_b; j++)
+        {
+            const auto diag = (j - kb - 1 == i) || (j - kb == i);
+            if ((diag && j <= kb + 3 && base[i][j] != 0) || ((!diag || j > kb + 3) && base[i][j] >= 0))
+                wrong_structure(i, j);
+        }
+    }
+
+    // in the sum of the core rows, the first parity block has to reduce to a single circulant
+    std::vector<int> n_shifts(nr.Z, 0);
+    for (auto i = 0; i < 4; i++)
+        if (core_shifts[i] >= 0) n_shifts[core_shifts[i]]++;
+    for (auto s = 0; s < nr.Z; s++)
+        if (n_shifts[s] & 1)
+        {
+            if (x != -1) wrong_structure(0, kb);
+            x = s;
+        }
+    if (x == -1) wrong_structure(0, kb);
+
+    // extension rows: a single identity matrix on the parity block kb+i
+    for (auto i = 4; i < nr.M_b; i++)
+    {
+        for (auto j = 0; j < kb + 4; j++)
+            if (base[i][j] >= 0) rows[i].push_back(std::make_pair(j, (int)base[i][j]));
+
+        for (auto j = kb + 4; j < nr.N_b; j++)
+            if ((j == kb + i && base[i][j] != 0) || (j != kb + i && base[i][j] >= 0)) wrong_structure(i, j);
+    }
+}
+
+template<typename B>
+Encoder_LDPC_NR<B>*
+Encoder_LDPC_NR<B>::clone() const
+{
+    auto m = new Encoder_LDPC_NR(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B>
+void
+Encoder_LDPC_NR<B>::_check_H_dimensions()
+{
+    Encoder_LDPC<B>::_check_H_dimensions();
+
+    if ((int)this->H.get_n_cols() != nr.M_b * nr.Z)
+    {
+        std::stringstream message;
+        message << "The built H matrix has a dimension 'M' different than the base graph one ('H.get_n_cols()' = "
+                << this->H.get_n_cols() << ", 'nr.M_b' = " << nr.M_b << ", 'nr.Z' = " << nr.Z << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
+template<typename B>
+void
+Encoder_LDPC_NR<B>::add_shifted(const B* blk, const int s, B* acc) const
+{
+    // acc[k] ^= blk[(k + s) % Z]
+    const auto Z = nr.Z;
+    for (auto k = 0; k < Z - s; k++)
+        acc[k] ^= blk[k + s];
+    for (auto k = Z - s; k < Z; k++)
+        acc[k] ^= blk[k + s - Z];
+}
+
+template<typename B>
+void
+Encoder_LDPC_NR<B>::_encode(const B* U_K, B* X_N, const size_t frame_id)
+{
+    const auto Z = nr.Z;
+    const auto kb = nr.K_b;
+
+    std::copy(U_K, U_K + this->K, X_N);
+    std::fill(X_N + this->K, X_N + this->N, (B)0);
+
+    // partial parities of the core rows (systematic part only)
+    std::fill(lambda.begin(), lambda.end(), (B)0);
+    for (auto i = 0; i < 4; i++)
+        for (auto& b : rows[i])
+            add_shifted(X_N + b.first * Z, b.second, lambda.data() + i * Z);
+
+    // first parity block: P_x * p0 = lambda_0 + lambda_1 + lambda_2 + lambda_3
+    B* p0 = X_N + kb * Z;
+    for (auto m = 0; m < Z; m++)
+    {
+        const auto k = (m - x + Z) % Z;
+        p0[m] = lambda[k] ^ lambda[Z + k] ^ lambda[2 * Z + k] ^ lambda[3 * Z + k];
+    }
+
+    // the three next parity blocks by back-substitution along the double diagonal
+    for (auto i = 0; i < 3; i++)
+    {
+        B* p = X_N + (kb + 1 + i) * Z;
+        const B* p_prev = X_N + (kb + i) * Z;
+
+        std::copy(lambda.begin() + i * Z, lambda.begin() + (i + 1) * Z, p);
+        if (core_shifts[i] >= 0) add_shifted(p0, core_shifts[i], p);
+        if (i > 0)
+            for (auto k = 0; k < Z; k++)
+                p[k] ^= p_prev[k];
+    }
+
+    // extension parity blocks
+    for (auto i = 4; i < nr.M_b; i++)
+    {
+        B* p = X_N + (kb + i) * Z;
+        for (auto& b : rows[i])
+            add_shifted(X_N + b.first * Z, b.second, p);
+    }
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Encoder_LDPC_NR<B_8>;
+template class aff3ct::module::Encoder_LDPC_NR<B_16>;
+template class aff3ct::module::Encoder_LDPC_NR<B_32>;
+template class aff3ct::module::Encoder_LDPC_NR<B_64>;
+#else
+template class aff3ct::module::Encoder_LDPC_NR<B>;
+#endif
+// ==================================================================================== explicit template instantiation
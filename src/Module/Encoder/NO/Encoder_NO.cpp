@@ -1,7 +1,9 @@
 #include <algorithm>
 
 #include "Module/Encoder/NO/Encoder_NO.hpp"
+#include "Tools/Perf/common/bit_packing.h"
 
+using namespace aff3ct;
 using namespace aff3ct::module;
 
 template<typename B>
@@ -30,6 +32,13 @@ Encoder_NO<B>::_encode(const B* U_K, B* X_K, const size_t frame_id)
     std::copy(U_K, U_K + this->K, X_K);
 }
 
+template<typename B>
+void
+Encoder_NO<B>::_encode_packed(const B* U_K, B* X_K, const size_t frame_id)
+{
+    std::copy(U_K, U_K + tools::packed_size<B>(this->K), X_K);
+}
+
 template<typename B>
 bool
 Encoder_NO<B>::is_codeword(const B* X_K)
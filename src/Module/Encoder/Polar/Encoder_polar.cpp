@@ -1,12 +1,15 @@
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <sstream>
 #include <streampu.hpp>
 #include <string>
 
 #include "Module/Encoder/Polar/Encoder_polar.hpp"
 #include "Tools/Code/Polar/fb_assert.h"
+#include "Tools/Perf/common/bit_packing.h"
 
+using namespace aff3ct;
 using namespace aff3ct::module;
 
 template<typename B>
@@ -15,6 +18,8 @@ Encoder_polar<B>::Encoder_polar(const int& K, const int& N, const std::vector<bo
   , m((int)std::log2(N))
   , frozen_bits(frozen_bits)
   , X_N_tmp(this->N)
+  , X_N_words((this->N + 63) / 64)
+  , info_bits_words((this->N + 63) / 64)
 {
     const std::string name = "Encoder_polar";
     this->set_name(name);
@@ -50,6 +55,15 @@ Encoder_polar<B>::_encode(const B* U_K, B* X_N, const size_t frame_id)
     this->light_encode(X_N);
 }
 
+template<typename B>
+void
+Encoder_polar<B>::_encode_packed(const B* U_K, B* X_N, const size_t frame_id)
+{
+    this->convert_packed(U_K, this->X_N_words.data());
+    this->light_encode_packed(this->X_N_words.data());
+    this->store_packed(this->X_N_words.data(), X_N);
+}
+
 template<typename B>
 void
 Encoder_polar<B>::light_encode(B* bits)
@@ -60,6 +74,29 @@ Encoder_polar<B>::light_encode(B* bits)
                 bits[j + i] = bits[j + i] ^ bits[k + j + i];
 }
 
+template<typename B>
+void
+Encoder_polar<B>::light_encode_packed(uint64_t* words)
+{
+    // the stages of the polar transform commute: the stages between the 64-bit words are applied first and then the
+    // stages inside the words with shifts and masks
+    const int n_words = (int)this->X_N_words.size();
+    for (auto k = (n_words >> 1); k > 0; k >>= 1)
+        for (auto j = 0; j < n_words; j += 2 * k)
+            for (auto i = 0; i < k; i++)
+                words[j + i] ^= words[k + j + i];
+
+    constexpr uint64_t masks[6] = { 0x5555555555555555ULL, 0x3333333333333333ULL, 0x0F0F0F0F0F0F0F0FULL,
+                                    0x00FF00FF00FF00FFULL, 0x0000FFFF0000FFFFULL, 0x00000000FFFFFFFFULL };
+    for (auto l = 0; l < 6; l++)
+    {
+        const auto k = 1 << l;
+        if (k >= this->N) break;
+        for (auto w = 0; w < n_words; w++)
+            words[w] ^= (words[w] >> k) & masks[l];
+    }
+}
+
 template<typename B>
 void
 Encoder_polar<B>::convert(const B* U_K, B* U_N)
@@ -81,6 +118,33 @@ Encoder_polar<B>::convert(const B* U_K, B* U_N)
     }
 }
 
+template<typename B>
+void
+Encoder_polar<B>::convert_packed(const B* U_K, uint64_t* U_N)
+{
+#if __BYTE_ORDER != __LITTLE_ENDIAN
+    throw spu::tools::runtime_error(
+      __FILE__, __LINE__, __func__, "The packed polar encoder works only on little endian CPUs.");
+#endif
+
+    std::fill(U_N, U_N + this->X_N_words.size(), (uint64_t)0);
+
+    const auto bytes = (const unsigned char*)U_K;
+    for (auto k = 0; k < this->K; k++)
+    {
+        const auto bit = (uint64_t)((bytes[k >> 3] >> (k & 7)) & 1);
+        const auto n = this->info_bits_pos[k];
+        U_N[n >> 6] |= bit << (n & 63);
+    }
+}
+
+template<typename B>
+void
+Encoder_polar<B>::store_packed(const uint64_t* words, B* X_N)
+{
+    std::memcpy((void*)X_N, (const void*)words, tools::packed_size<B>(this->N) * sizeof(B));
+}
+
 template<typename B>
 bool
 Encoder_polar<B>::is_codeword(const B* X_N)
@@ -108,6 +172,10 @@ Encoder_polar<B>::set_frozen_bits(const std::vector<bool>& frozen_bits)
     auto k = 0;
     for (auto n = 0; n < this->N; n++)
         if (!this->frozen_bits[n]) this->info_bits_pos[k++] = n;
+
+    std::fill(this->info_bits_words.begin(), this->info_bits_words.end(), (uint64_t)0);
+    for (auto n = 0; n < this->N; n++)
+        if (!this->frozen_bits[n]) this->info_bits_words[n >> 6] |= (uint64_t)1 << (n & 63);
 }
 
 template<typename B>
@@ -40,6 +40,25 @@ Encoder_polar_sys<B>::_encode(const B* U_K, B* X_N, const size_t frame_id)
     this->light_encode(X_N);
 }
 
+template<typename B>
+void
+Encoder_polar_sys<B>::_encode_packed(const B* U_K, B* X_N, const size_t frame_id)
+{
+    auto words = this->X_N_words.data();
+    this->convert_packed(U_K, words);
+
+    // first time encode
+    this->light_encode_packed(words);
+
+    for (size_t w = 0; w < this->X_N_words.size(); w++)
+        words[w] &= this->info_bits_words[w];
+
+    // second time encode because of systematic encoder
+    this->light_encode_packed(words);
+
+    this->store_packed(words, X_N);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -1,9 +1,13 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <sstream>
 #include <streampu.hpp>
 #include <string>
 #include <vector>
 
 #include "Module/Monitor/BFER/Monitor_BFER.hpp"
+#include "Tools/Perf/common/bit_packing.h"
 #include "Tools/Perf/distance/hamming_distance.h"
 
 using namespace aff3ct;
@@ -13,13 +17,15 @@ template<typename B>
 Monitor_BFER<B>::Monitor_BFER(const int K,
                               const unsigned max_fe,
                               const unsigned max_n_frames,
-                              const bool count_unknown_values)
+                              const bool count_unknown_values,
+                              const bool importance_sampling)
   : Monitor()
   , K(K)
   , max_fe(max_fe)
   , max_n_frames(max_n_frames)
   , count_unknown_values(count_unknown_values)
   , no_is_done(false)
+  , importance_sampling(importance_sampling)
   , err_hist(0)
   , err_hist_activated(false)
 {
@@ -79,6 +85,41 @@ Monitor_BFER<B>::Monitor_BFER(const int K,
                              return n_be;
                          });
 
+    auto& p3 = this->create_task("check_errors_is", (int)mnt::tsk::check_errors_is);
+    auto p3s_U = this->template create_socket_in<B>(p3, "U", get_K());
+    auto p3s_V = this->template create_socket_in<B>(p3, "V", get_K());
+    auto p3s_LW = this->template create_socket_in<double>(p3, "LW", 1);
+
+    this->create_codelet(p3,
+                         [p3s_U, p3s_V, p3s_LW](spu::module::Module& m, spu::runtime::Task& t, const size_t frame_id)
+                           -> int
+                         {
+                             auto& mnt = static_cast<Monitor_BFER<B>&>(m);
+
+                             auto n_be = mnt._check_errors_is(static_cast<B*>(t[p3s_U].get_dataptr()),
+                                                              static_cast<B*>(t[p3s_V].get_dataptr()),
+                                                              static_cast<double*>(t[p3s_LW].get_dataptr()),
+                                                              frame_id);
+
+                             return n_be;
+                         });
+
+    auto& p4 = this->create_task("check_errors_packed", (int)mnt::tsk::check_errors_packed);
+    auto p4s_U = this->template create_socket_in<B>(p4, "U", tools::packed_size<B>(get_K()));
+    auto p4s_V = this->template create_socket_in<B>(p4, "V", tools::packed_size<B>(get_K()));
+
+    this->create_codelet(p4,
+                         [p4s_U, p4s_V](spu::module::Module& m, spu::runtime::Task& t, const size_t frame_id) -> int
+                         {
+                             auto& mnt = static_cast<Monitor_BFER<B>&>(m);
+
+                             auto n_be = mnt._check_errors_packed(static_cast<B*>(t[p4s_U].get_dataptr()),
+                                                                  static_cast<B*>(t[p4s_V].get_dataptr()),
+                                                                  frame_id);
+
+                             return n_be;
+                         });
+
     reset();
 }
 
@@ -158,6 +199,17 @@ Monitor_BFER<B>::equivalent(const Monitor_BFER<B>& m, bool do_throw) const
         throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
     }
 
+    if (is_importance_sampling() != m.is_importance_sampling())
+    {
+        if (!do_throw) return false;
+
+        std::stringstream message;
+        message << "'is_importance_sampling()' is different than 'm.is_importance_sampling()' "
+                << "('is_importance_sampling()' = " << is_importance_sampling()
+                << ", 'm.is_importance_sampling()' = " << m.is_importance_sampling() << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
     return true;
 }
 
@@ -242,6 +294,72 @@ Monitor_BFER<B>::_check_errors2(const B* U,
     return n_be_total;
 }
 
+template<typename B>
+int
+Monitor_BFER<B>::check_errors_is(const B* U, const B* V, const double* LW, const int frame_id, const bool managed_memory)
+{
+    (*this)[mnt::sck::check_errors_is::U].bind(U);
+    (*this)[mnt::sck::check_errors_is::V].bind(V);
+    (*this)[mnt::sck::check_errors_is::LW].bind(LW);
+    const auto& status = (*this)[mnt::tsk::check_errors_is].exec(frame_id, managed_memory);
+
+    return status[0];
+}
+
+template<typename B>
+int
+Monitor_BFER<B>::_check_errors_is(const B* U, const B* V, const double* LW, const size_t frame_id)
+{
+    int n_be_total = 0;
+    for (size_t f = 0; f < this->get_n_frames(); f++)
+    {
+        auto n_be = this->__check_errors(U + f * get_K(), V + f * get_K(), f);
+        n_be_total += n_be;
+
+        if (n_be)
+        {
+            const auto w = std::exp(LW[f]);
+            vals.w_be += w * (double)n_be;
+            vals.w_fe += w;
+            vals.w2_fe += w * w;
+        }
+    }
+
+    this->callback_check.notify();
+
+    if (this->fe_limit_achieved()) this->callback_fe_limit_achieved.notify();
+
+    return n_be_total;
+}
+
+template<typename B>
+int
+Monitor_BFER<B>::check_errors_packed(const B* U, const B* V, const int frame_id, const bool managed_memory)
+{
+    (*this)[mnt::sck::check_errors_packed::U].bind(U);
+    (*this)[mnt::sck::check_errors_packed::V].bind(V);
+    const auto& status = (*this)[mnt::tsk::check_errors_packed].exec(frame_id, managed_memory);
+
+    return status[0];
+}
+
+template<typename B>
+int
+Monitor_BFER<B>::_check_errors_packed(const B* U, const B* V, const size_t frame_id)
+{
+    const auto n_packed = tools::packed_size<B>(get_K());
+
+    int n_be_total = 0;
+    for (size_t f = 0; f < this->get_n_frames(); f++)
+        n_be_total += this->__check_errors_packed(U + f * n_packed, V + f * n_packed, f);
+
+    this->callback_check.notify();
+
+    if (this->fe_limit_achieved()) this->callback_fe_limit_achieved.notify();
+
+    return n_be_total;
+}
+
 template<typename B>
 int
 Monitor_BFER<B>::__check_errors(const B* U, const B* V, const size_t frame_id)
@@ -253,6 +371,26 @@ Monitor_BFER<B>::__check_errors(const B* U, const B* V, const size_t frame_id)
     else
         bit_errors_count = (int)tools::hamming_distance(U, V, get_K());
 
+    this->add_errors(bit_errors_count, frame_id);
+
+    return bit_errors_count;
+}
+
+template<typename B>
+int
+Monitor_BFER<B>::__check_errors_packed(const B* U, const B* V, const size_t frame_id)
+{
+    const auto bit_errors_count = (int)tools::hamming_distance_packed(U, V, get_K());
+
+    this->add_errors(bit_errors_count, frame_id);
+
+    return bit_errors_count;
+}
+
+template<typename B>
+void
+Monitor_BFER<B>::add_errors(const int bit_errors_count, const size_t frame_id)
+{
     if (bit_errors_count)
     {
         vals.n_be += bit_errors_count;
@@ -264,8 +402,6 @@ Monitor_BFER<B>::__check_errors(const B* U, const B* V, const size_t frame_id)
     }
 
     vals.n_fra++;
-
-    return bit_errors_count;
 }
 
 template<typename B>
@@ -289,6 +425,70 @@ Monitor_BFER<B>::disable_is_done(const bool no_is_done)
     this->no_is_done = no_is_done;
 }
 
+template<typename B>
+void
+Monitor_BFER<B>::save_state(std::ostream& stream) const
+{
+    const auto prec = stream.precision(std::numeric_limits<double>::max_digits10);
+
+    stream << "n_fra " << vals.n_fra << std::endl;
+    stream << "n_be " << vals.n_be << std::endl;
+    stream << "n_fe " << vals.n_fe << std::endl;
+    stream << "w_be " << vals.w_be << std::endl;
+    stream << "w_fe " << vals.w_fe << std::endl;
+    stream << "w2_fe " << vals.w2_fe << std::endl;
+
+    const auto& hist = this->err_hist.get_hist();
+    stream << "err_hist " << hist.size() << std::endl;
+    for (auto& h : hist)
+        stream << h.first << " " << h.second << std::endl;
+
+    stream.precision(prec);
+}
+
+template<typename T>
+static void
+read_state_field(std::istream& stream, const std::string& name, T& val)
+{
+    std::string key;
+    if (!(stream >> key >> val) || key != name)
+    {
+        std::stringstream message;
+        message << "The '" << name << "' field can't be read ('key' = " << key << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
+template<typename B>
+void
+Monitor_BFER<B>::load_state(std::istream& stream)
+{
+    Attributes v;
+    read_state_field(stream, "n_fra", v.n_fra);
+    read_state_field(stream, "n_be", v.n_be);
+    read_state_field(stream, "n_fe", v.n_fe);
+    read_state_field(stream, "w_be", v.w_be);
+    read_state_field(stream, "w_fe", v.w_fe);
+    read_state_field(stream, "w2_fe", v.w2_fe);
+
+    size_t n_hist = 0;
+    read_state_field(stream, "err_hist", n_hist);
+    for (size_t h = 0; h < n_hist; h++)
+    {
+        int x;
+        size_t weight;
+        if (!(stream >> x >> weight))
+        {
+            std::stringstream message;
+            message << "The error histogram can't be read ('h' = " << h << ", 'n_hist' = " << n_hist << ").";
+            throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+        this->err_hist.add_value(this->err_hist.uncalibrate_val(x), weight);
+    }
+
+    this->collect(v);
+}
+
 template<typename B>
 bool
 Monitor_BFER<B>::is_done() const
@@ -350,7 +550,9 @@ float
 Monitor_BFER<B>::get_fer() const
 {
     auto t_fer = 0.f;
-    if (this->get_n_fe() != 0)
+    if (this->get_n_fe() != 0 && this->importance_sampling)
+        t_fer = (float)(vals.w_fe / (double)this->get_n_analyzed_fra());
+    else if (this->get_n_fe() != 0)
         t_fer = (float)this->get_n_fe() / (float)this->get_n_analyzed_fra();
     else
         t_fer = (1.f) / ((float)this->get_n_analyzed_fra());
@@ -363,7 +565,9 @@ float
 Monitor_BFER<B>::get_ber() const
 {
     auto t_ber = 0.f;
-    if (this->get_n_be() != 0)
+    if (this->get_n_be() != 0 && this->importance_sampling)
+        t_ber = (float)(vals.w_be / (double)this->get_n_analyzed_fra() / (double)this->get_K());
+    else if (this->get_n_be() != 0)
         t_ber = (float)this->get_n_be() / (float)this->get_n_analyzed_fra() / (float)this->get_K();
     else
         t_ber = (1.f) / ((float)this->get_n_analyzed_fra()) / this->get_K();
@@ -371,6 +575,19 @@ Monitor_BFER<B>::get_ber() const
     return t_ber;
 }
 
+template<typename B>
+double
+Monitor_BFER<B>::get_fer_stddev() const
+{
+    const auto n = (double)this->get_n_analyzed_fra();
+    if (!this->importance_sampling || n == 0.) return 0.;
+
+    const auto fer = vals.w_fe / n;
+    const auto var = std::max(0., vals.w2_fe / n - fer * fer) / n;
+
+    return std::sqrt(var);
+}
+
 template<typename B>
 bool
 Monitor_BFER<B>::get_count_unknown_values() const
@@ -378,6 +595,13 @@ Monitor_BFER<B>::get_count_unknown_values() const
     return count_unknown_values;
 }
 
+template<typename B>
+bool
+Monitor_BFER<B>::is_importance_sampling() const
+{
+    return importance_sampling;
+}
+
 template<typename B>
 const tools::Histogram<int>&
 Monitor_BFER<B>::get_err_hist() const
@@ -520,6 +744,9 @@ Monitor_BFER<B>::Attributes ::operator+=(const Attributes& a)
     n_be += a.n_be;
     n_fe += a.n_fe;
     n_fra += a.n_fra;
+    w_be += a.w_be;
+    w_fe += a.w_fe;
+    w2_fe += a.w2_fe;
 
     return *this;
 }
@@ -531,6 +758,9 @@ Monitor_BFER<B>::Attributes ::reset()
     n_be = 0;
     n_fe = 0;
     n_fra = 0;
+    w_be = 0.;
+    w_fe = 0.;
+    w2_fe = 0.;
 }
 
 template<typename B>
@@ -0,0 +1,141 @@
+#include <chrono>
+#include <cmath>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Monitor/Latency/Monitor_latency.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+static inline int64_t
+now_us()
+{
+    return (int64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+Monitor_latency::Monitor_latency(const size_t stage_id)
+  : Monitor()
+  , stage_id(stage_id)
+  , lat_hist(0)
+{
+    const std::string name = "Monitor_latency";
+    this->set_name(name);
+    this->set_single_wave(true);
+
+    auto& p1 = this->create_task("stamp", (int)mnt::tsk::stamp);
+    auto p1s_TS = this->create_socket_out<int64_t>(p1, "TS", 1);
+    this->create_codelet(p1,
+                         [p1s_TS](spu::module::Module& m, spu::runtime::Task& t, const size_t frame_id) -> int
+                         {
+                             auto& mnt = static_cast<Monitor_latency&>(m);
+
+                             return mnt._stamp(static_cast<int64_t*>(t[p1s_TS].get_dataptr()), frame_id);
+                         });
+
+    auto& p2 = this->create_task("measure", (int)mnt::tsk::measure);
+    auto p2s_TS_in = this->create_socket_in<int64_t>(p2, "TS_in", 1);
+    auto p2s_TS_out = this->create_socket_out<int64_t>(p2, "TS_out", 1);
+    this->create_codelet(p2,
+                         [p2s_TS_in, p2s_TS_out](spu::module::Module& m, spu::runtime::Task& t, const size_t frame_id)
+                           -> int
+                         {
+                             auto& mnt = static_cast<Monitor_latency&>(m);
+
+                             return mnt._measure(static_cast<int64_t*>(t[p2s_TS_in].get_dataptr()),
+                                                 static_cast<int64_t*>(t[p2s_TS_out].get_dataptr()),
+                                                 frame_id);
+                         });
+
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    reset();
+}
+
+Monitor_latency*
+Monitor_latency::clone() const
+{
+    auto m = new Monitor_latency(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+int
+Monitor_latency::_stamp(int64_t* TS, const size_t /*frame_id*/)
+{
+    const auto t = now_us();
+    for (size_t f = 0; f < this->get_n_frames(); f++)
+        TS[f] = t;
+
+    return spu::runtime::status_t::SUCCESS;
+}
+
+int
+Monitor_latency::_measure(const int64_t* TS_in, int64_t* TS_out, const size_t /*frame_id*/)
+{
+    const auto t = now_us();
+    for (size_t f = 0; f < this->get_n_frames(); f++)
+    {
+        this->lat_hist.add_value((int)(t - TS_in[f]));
+        TS_out[f] = t;
+    }
+
+    return spu::runtime::status_t::SUCCESS;
+}
+
+size_t
+Monitor_latency::get_stage_id() const
+{
+    return this->stage_id;
+}
+
+size_t
+Monitor_latency::get_n_values() const
+{
+    return this->lat_hist.get_n_values();
+}
+
+int
+Monitor_latency::get_percentile(const double p) const
+{
+    const auto n_values = this->lat_hist.get_n_values();
+    if (n_values == 0) return 0;
+
+    const auto rank = (size_t)std::ceil(p / 100. * (double)n_values);
+    size_t cumul = 0;
+    for (auto& h : this->lat_hist.get_hist())
+    {
+        cumul += h.second;
+        if (cumul >= rank) return this->lat_hist.uncalibrate_val(h.first);
+    }
+
+    return this->lat_hist.get_hist_max();
+}
+
+const tools::Histogram<int>&
+Monitor_latency::get_lat_hist() const
+{
+    return this->lat_hist;
+}
+
+bool
+Monitor_latency::is_done() const
+{
+    return false;
+}
+
+void
+Monitor_latency::reset()
+{
+    Monitor::reset();
+    this->lat_hist.reset();
+}
+
+void
+Monitor_latency::collect(const Monitor_latency& m)
+{
+    this->lat_hist.add_values(m.lat_hist);
+}
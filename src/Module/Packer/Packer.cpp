@@ -0,0 +1,123 @@
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Packer/Packer.hpp"
+#include "Tools/Perf/common/bit_packing.h"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template<typename B>
+Packer<B>::Packer(const int size)
+  : spu::module::Stateful()
+  , size(size)
+{
+    const std::string name = "Packer";
+    this->set_name(name);
+    this->set_short_name(name);
+
+    if (size <= 0)
+    {
+        std::stringstream message;
+        message << "'size' has to be greater than 0 ('size' = " << size << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    auto& p1 = this->create_task("pack");
+    auto p1s_in = this->template create_socket_in<B>(p1, "in", this->size);
+    auto p1s_out = this->template create_socket_out<B>(p1, "out", tools::packed_size<B>(this->size));
+    this->create_codelet(p1,
+                         [p1s_in, p1s_out](spu::module::Module& m, spu::runtime::Task& t, const size_t frame_id) -> int
+                         {
+                             auto& pkr = static_cast<Packer<B>&>(m);
+
+                             pkr._pack(static_cast<B*>(t[p1s_in].get_dataptr()),
+                                       static_cast<B*>(t[p1s_out].get_dataptr()),
+                                       frame_id);
+
+                             return spu::runtime::status_t::SUCCESS;
+                         });
+
+    auto& p2 = this->create_task("unpack");
+    auto p2s_in = this->template create_socket_in<B>(p2, "in", tools::packed_size<B>(this->size));
+    auto p2s_out = this->template create_socket_out<B>(p2, "out", this->size);
+    this->create_codelet(p2,
+                         [p2s_in, p2s_out](spu::module::Module& m, spu::runtime::Task& t, const size_t frame_id) -> int
+                         {
+                             auto& pkr = static_cast<Packer<B>&>(m);
+
+                             pkr._unpack(static_cast<B*>(t[p2s_in].get_dataptr()),
+                                         static_cast<B*>(t[p2s_out].get_dataptr()),
+                                         frame_id);
+
+                             return spu::runtime::status_t::SUCCESS;
+                         });
+
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+}
+
+template<typename B>
+Packer<B>*
+Packer<B>::clone() const
+{
+    auto m = new Packer(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B>
+int
+Packer<B>::get_size() const
+{
+    return this->size;
+}
+
+template<typename B>
+void
+Packer<B>::pack(const B* in, B* out, const int frame_id, const bool managed_memory)
+{
+    (*this)[pkr::sck::pack::in].bind(in);
+    (*this)[pkr::sck::pack::out].bind(out);
+    (*this)[pkr::tsk::pack].exec(frame_id, managed_memory);
+}
+
+template<typename B>
+void
+Packer<B>::unpack(const B* in, B* out, const int frame_id, const bool managed_memory)
+{
+    (*this)[pkr::sck::unpack::in].bind(in);
+    (*this)[pkr::sck::unpack::out].bind(out);
+    (*this)[pkr::tsk::unpack].exec(frame_id, managed_memory);
+}
+
+template<typename B>
+void
+Packer<B>::_pack(const B* in, B* out, const size_t frame_id)
+{
+    const auto n_packed = tools::packed_size<B>(this->size);
+    for (size_t f = 0; f < this->get_n_frames_per_wave(); f++)
+        tools::pack_bits(in + f * this->size, out + f * n_packed, this->size);
+}
+
+template<typename B>
+void
+Packer<B>::_unpack(const B* in, B* out, const size_t frame_id)
+{
+    const auto n_packed = tools::packed_size<B>(this->size);
+    for (size_t f = 0; f < this->get_n_frames_per_wave(); f++)
+        tools::unpack_bits(in + f * n_packed, out + f * this->size, this->size);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Packer<B_8>;
+template class aff3ct::module::Packer<B_16>;
+template class aff3ct::module::Packer<B_32>;
+template class aff3ct::module::Packer<B_64>;
+#else
+template class aff3ct::module::Packer<B>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Puncturer/LDPC/Puncturer_LDPC_NR.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+static int
+compute_k0(const int BG, const int Z, const int rv, const int N_cb)
+{
+    // numerators of the starting positions of the redundancy versions (TS 38.212 table 5.4.2.1-2)
+    static const int num[2][4] = { { 0, 17, 33, 56 }, { 0, 13, 25, 43 } };
+    const int den = BG == 1 ? 66 : 50;
+
+    return ((num[BG - 1][rv] * N_cb) / (den * Z)) * Z;
+}
+
+template<typename B, typename Q>
+Puncturer_LDPC_NR<B, Q>::Puncturer_LDPC_NR(const int& K,
+                                           const int& N,
+                                           const int& N_cw,
+                                           const int& BG,
+                                           const int& Z,
+                                           const int& rv,
+                                           const int& N_cb)
+  : Puncturer<B, Q>(K, N, N_cw)
+  , BG(BG)
+  , Z(Z)
+  , rv(rv)
+  , N_cb(N_cb ? N_cb : N_cw - 2 * Z)
+  , k0((BG == 1 || BG == 2) && rv >= 0 && rv <= 3 ? compute_k0(BG, Z, rv, this->N_cb) : 0)
+  , positions(N)
+{
+    const std::string name = "Puncturer_LDPC_NR";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    if (BG != 1 && BG != 2)
+    {
+        std::stringstream message;
+        message << "'BG' has to be 1 or 2 ('BG' = " << BG << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (rv < 0 || rv > 3)
+    {
+        std::stringstream message;
+        message << "'rv' has to be between 0 and 3 ('rv' = " << rv << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (Z < 1 || N_cw != (BG == 1 ? 68 : 52) * Z)
+    {
+        std::stringstream message;
+        message << "'N_cw' has to be equal to 'N_b' * 'Z' ('N_cw' = " << N_cw << ", 'Z' = " << Z << ", 'BG' = " << BG
+                << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    const auto K_cols = (BG == 1 ? 22 : 10) * Z; // systematic part including the filler bits
+    if (this->K > K_cols)
+    {
+        std::stringstream message;
+        message << "'K' has to be smaller or equal to 'K_b' * 'Z' ('K' = " << this->K << ", 'K_b' * 'Z' = " << K_cols
+                << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->N_cb <= K_cols - 2 * Z || this->N_cb > N_cw - 2 * Z)
+    {
+        std::stringstream message;
+        message << "'N_cb' has to be in ]'K_b' * 'Z' - 2 * 'Z', 'N_cw' - 2 * 'Z'] ('N_cb' = " << this->N_cb
+                << ", 'K_b' * 'Z' = " << K_cols << ", 'N_cw' = " << N_cw << ", 'Z' = " << Z << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    auto k = 0;
+    auto j = 0;
+    while (k < this->N)
+    {
+        const auto pos = 2 * Z + (k0 + j) % this->N_cb;
+        if (pos < this->K || pos >= K_cols) positions[k++] = (uint32_t)pos;
+        j++;
+    }
+}
+
+template<typename B, typename Q>
+Puncturer_LDPC_NR<B, Q>*
+Puncturer_LDPC_NR<B, Q>::clone() const
+{
+    auto m = new Puncturer_LDPC_NR(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename Q>
+int
+Puncturer_LDPC_NR<B, Q>::get_k0() const
+{
+    return this->k0;
+}
+
+template<typename B, typename Q>
+void
+Puncturer_LDPC_NR<B, Q>::_puncture(const B* X_N1, B* X_N2, const size_t frame_id) const
+{
+    for (auto k = 0; k < this->N; k++)
+        X_N2[k] = X_N1[positions[k]];
+}
+
+template<typename B, typename Q>
+void
+Puncturer_LDPC_NR<B, Q>::_depuncture(const Q* Y_N1, Q* Y_N2, const size_t frame_id) const
+{
+    const auto K_cols = (BG == 1 ? 22 : 10) * Z;
+
+    std::fill(Y_N2, Y_N2 + this->N_cw, (Q)0);
+    // the filler bits are known to be 0
+    std::fill(Y_N2 + this->K, Y_N2 + K_cols, spu::tools::sat_vals<Q>().second);
+
+    // the repeated bits are combined
+    for (auto k = 0; k < this->N; k++)
+        Y_N2[positions[k]] += Y_N1[k];
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Puncturer_LDPC_NR<B_8, Q_8>;
+template class aff3ct::module::Puncturer_LDPC_NR<B_16, Q_16>;
+template class aff3ct::module::Puncturer_LDPC_NR<B_32, Q_32>;
+template class aff3ct::module::Puncturer_LDPC_NR<B_64, Q_64>;
+#else
+template class aff3ct::module::Puncturer_LDPC_NR<B, Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -1,14 +1,20 @@
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
 #include <mipp.h>
 #include <streampu.hpp>
 
 #include "Module/Source/Random/Source_random_fast.hpp"
+#include "Tools/Perf/common/bit_packing.h"
 
+using namespace aff3ct;
 using namespace aff3ct::module;
 
 template<typename B>
-Source_random_fast<B>::Source_random_fast(const int K, const int seed)
-  : spu::module::Source<B>(K)
+Source_random_fast<B>::Source_random_fast(const int K, const int seed, const bool packed)
+  : spu::module::Source<B>(packed ? (int)tools::packed_size<B>(K) : K)
+  , K(K)
+  , packed(packed)
   , mt19937(seed)
   , mt19937_simd()
 {
@@ -39,6 +45,12 @@ Source_random_fast<B>::_generate(B* U_K, const size_t frame_id)
     if (!mipp::isAligned(U_K))
         throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'U_K' is misaligned memory.");
 
+    if (this->packed)
+    {
+        this->_generate_packed(U_K, frame_id);
+        return;
+    }
+
     const auto size = (unsigned)(this->max_data_size);
 
     // vectorized loop
@@ -72,6 +84,43 @@ Source_random_fast<B>::_generate(B* U_K, const size_t frame_id)
     }
 }
 
+template<typename B>
+void
+Source_random_fast<B>::_generate_packed(B* U_K, const size_t frame_id)
+{
+    const auto bytes = (unsigned char*)U_K;
+    const auto n_bytes = (unsigned)((this->K + 7) / 8);
+
+    // vectorized loop: each random 32-bit value gives 32 bits
+    const auto period = (unsigned)(mipp::nElReg<int32_t>() * sizeof(int32_t));
+    const auto vec_loop_size = (n_bytes / period) * period;
+    for (unsigned i = 0; i < vec_loop_size; i += period)
+        mt19937_simd.rand_s32().store((int32_t*)(bytes + i));
+
+    // remaining scalar operations
+    for (unsigned i = vec_loop_size; i < n_bytes; i += sizeof(uint32_t))
+    {
+        auto randoms = mt19937.rand_u32();
+        for (unsigned j = 0; j < sizeof(uint32_t) && i + j < n_bytes; j++)
+        {
+            bytes[i + j] = (unsigned char)(randoms & 0xFF);
+            randoms >>= 8;
+        }
+    }
+
+    // the unused bits are set to 0
+    const auto rest = this->K % 8;
+    if (rest) bytes[n_bytes - 1] &= (unsigned char)((1 << rest) - 1);
+    std::fill(bytes + n_bytes, bytes + this->max_data_size * sizeof(B), (unsigned char)0);
+}
+
+template<typename B>
+bool
+Source_random_fast<B>::is_packed() const
+{
+    return this->packed;
+}
+
 template<typename B>
 void
 Source_random_fast<B>::set_seed(const int seed)
@@ -2,6 +2,7 @@
 #include <functional>
 #include <iostream>
 #include <random>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -28,6 +29,14 @@ Simulation_BFER_ite<B, R, Q>::Simulation_BFER_ite(const factory::BFER_ite& param
                   << "Multi-threading detected with error tracking revert feature! "
                      "Each thread will play the same frames. Please run with one thread."
                   << std::endl;
+
+    if (this->params_BFER_ite.chn->is_bias != "NONE")
+    {
+        std::stringstream message;
+        message << "The importance sampling is not supported by the iterative BFER simulation ('chn->is_bias' = "
+                << this->params_BFER_ite.chn->is_bias << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
 }
 
 template<typename B, typename R, typename Q>
@@ -631,6 +640,25 @@ Simulation_BFER_ite<B, R, Q>::bind_sockets()
     }
 }
 
+template<typename B, typename R, typename Q>
+void
+Simulation_BFER_ite<B, R, Q>::set_seeds()
+{
+    // set different seeds in the modules that uses PRNG
+    std::mt19937 prng(this->get_local_seed());
+    for (auto& m : this->sequence->template get_modules<spu::tools::Interface_set_seed>())
+        m->set_seed(prng());
+
+    // the counter-based noise is keyed by the simulation seed in all the channel replicas, each replica stamps the
+    // frames with their global index (the replicas take the blocks of frames in a round robin order)
+    auto channels = this->sequence->template get_modules<module::Channel<R>>();
+    for (size_t r = 0; r < channels.size(); r++)
+    {
+        if (this->params_BFER_ite.chn->implem == "PHILOX") channels[r]->set_seed(this->get_local_seed());
+        channels[r]->set_replica(r, channels.size());
+    }
+}
+
 template<typename B, typename R, typename Q>
 void
 Simulation_BFER_ite<B, R, Q>::create_sequence()
@@ -670,10 +698,7 @@ Simulation_BFER_ite<B, R, Q>::create_sequence()
     for (auto& m : this->sequence->template get_modules<tools::Interface_notify_noise_update>())
         this->noise->record_callback_update([m]() { m->notify_noise_update(); });
 
-    // set different seeds in the modules that uses PRNG
-    std::mt19937 prng(params_BFER_ite.local_seed);
-    for (auto& m : this->sequence->template get_modules<spu::tools::Interface_set_seed>())
-        m->set_seed(prng());
+    this->set_seeds();
 
     auto fb_modules = this->sequence->template get_modules<tools::Interface_get_set_frozen_bits>();
     if (fb_modules.size())
@@ -758,6 +783,13 @@ Simulation_BFER_ite<B, R, Q>::create_sequence()
     }
 }
 
+template<typename B, typename R, typename Q>
+Simulation_BFER<B, R>*
+Simulation_BFER_ite<B, R, Q>::build_sub_simulation(const factory::BFER& sub_params) const
+{
+    return new Simulation_BFER_ite<B, R, Q>(dynamic_cast<const factory::BFER_ite&>(sub_params));
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -76,6 +76,9 @@ class Simulation_BFER_ite : public Simulation_BFER<B, R>
     virtual void create_modules();
     virtual void bind_sockets();
     virtual void create_sequence();
+    virtual void set_seeds();
+
+    virtual Simulation_BFER<B, R>* build_sub_simulation(const factory::BFER& sub_params) const;
 };
 
 }
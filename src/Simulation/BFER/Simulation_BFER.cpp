@@ -1,13 +1,19 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
 #include <exception>
 #include <fstream>
 #include <iomanip>
 #include <ios>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <random>
 #include <sstream>
 #include <streampu.hpp>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "Simulation/BFER/Simulation_BFER.hpp"
 #include "Tools/Display/Statistics/Statistics.hpp"
@@ -28,6 +34,12 @@ Simulation_BFER<B, R>::Simulation_BFER(const factory::BFER& params_BFER)
   , noise(params_BFER.noise->build<>())
   , channel_params(params_BFER.n_frames)
   , dumper(params_BFER.n_threads)
+  , is_sub_simulation(false)
+  , sub_stop(false)
+  , seed_epoch(0)
+  , chkpt_noise_idx(0)
+  , chkpt_pending(false)
+  , pipeline_master_set(false)
 {
     if (params_BFER.n_threads < 1)
     {
@@ -36,11 +48,57 @@ Simulation_BFER<B, R>::Simulation_BFER(const factory::BFER& params_BFER)
         throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
     }
 
+    if (params_BFER.conc_noise > 1 && (params_BFER.err_track_enable || params_BFER.err_track_revert ||
+                                       params_BFER.debug || params_BFER.mnt_mutinfo))
+    {
+        std::stringstream message;
+        message << "Concurrent noise points can't be combined with the error tracking, the debug mode or the mutual "
+                   "information ('conc_noise' = "
+                << params_BFER.conc_noise << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (params_BFER.chn->is_bias != "NONE" && (params_BFER.chn->type != "AWGN" || params_BFER.chn->add_users))
+    {
+        std::stringstream message;
+        message << "The importance sampling requires the 'AWGN' channel without added users ('chn->type' = "
+                << params_BFER.chn->type << ", 'chn->add_users' = " << params_BFER.chn->add_users << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (params_BFER.resume && params_BFER.chkpt_path.empty())
+    {
+        std::stringstream message;
+        message << "Resuming a simulation requires a checkpoint file ('chkpt_path' is empty).";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (!params_BFER.cache_path.empty() && (params_BFER.conc_noise > 1 || params_BFER.err_track_enable ||
+                                            params_BFER.err_track_revert || !params_BFER.chkpt_path.empty()))
+    {
+        std::stringstream message;
+        message << "The result cache can't be combined with the concurrent noise points, the bad frames tracking or "
+                   "the checkpoints ('conc_noise' = "
+                << params_BFER.conc_noise << ", 'chkpt_path' = " << params_BFER.chkpt_path << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (!params_BFER.chkpt_path.empty() && (params_BFER.conc_noise > 1 || params_BFER.err_track_revert))
+    {
+        std::stringstream message;
+        message << "The checkpoints can't be combined with the concurrent noise points or the bad frames replay "
+                   "('conc_noise' = "
+                << params_BFER.conc_noise << ", 'err_track_revert' = " << params_BFER.err_track_revert << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
     if (params_BFER.err_track_enable)
     {
+        // the erroneous frames are streamed in a part file per thread, the parts are merged at the end of a noise point
         for (auto tid = 0; tid < params_BFER.n_threads; tid++)
-            dumper[tid].reset(new tools::Dumper());
-        dumper_red.reset(new tools::Dumper_reduction(dumper));
+            dumper[tid].reset(new tools::Dumper_stream(params_BFER.err_track_path + "_part" + std::to_string(tid),
+                                                       (size_t)params_BFER.err_track_buffer * 1024));
+        dumper_red.reset(new tools::Dumper_reduction(dumper, true));
     }
 
     if (!params_BFER.noise->pdf_path.empty())
@@ -70,7 +128,9 @@ Simulation_BFER<B, R>::build_monitor_er()
 {
     bool count_unknown_values = params_BFER.noise->type == "EP";
 
-    auto mnt_tmp = params_BFER.mnt_er->build<B>(count_unknown_values);
+    bool importance_sampling = params_BFER.chn->is_bias != "NONE";
+
+    auto mnt_tmp = params_BFER.mnt_er->build<B>(count_unknown_values, importance_sampling);
     auto mnt = std::unique_ptr<module::Monitor_BFER<B>>(mnt_tmp);
     mnt->activate_err_histogram(params_BFER.mnt_er->err_hist != -1);
 
@@ -125,10 +185,13 @@ Simulation_BFER<B, R>::configure_sequence_tasks()
     if (!params_BFER.sequence_path.empty())
     {
         std::ofstream dot_file(params_BFER.sequence_path);
-        this->sequence->export_dot(dot_file);
+        if (this->pipeline != nullptr)
+            this->pipeline->export_dot(dot_file);
+        else
+            this->sequence->export_dot(dot_file);
     }
 
-    for (auto& mod : sequence->get_modules<spu::module::Module>())
+    for (auto& mod : this->template get_modules<spu::module::Module>())
         for (auto& tsk : mod->tasks)
         {
             if (this->params.statistics) tsk->set_stats(true);
@@ -146,32 +209,122 @@ Simulation_BFER<B, R>::configure_sequence_tasks()
         }
 }
 
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::exec_sequence(std::function<bool()> stop_condition)
+{
+    if (this->pipeline != nullptr)
+    {
+        this->pipeline_master_set = false;
+        this->pipeline->exec(stop_condition);
+    }
+    else
+        this->sequence->exec(stop_condition);
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::show_stats(std::ostream& stream) const
+{
+    if (this->pipeline != nullptr)
+        spu::tools::Stats::show(this->pipeline->get_modules_per_types(), true, true, stream);
+    else
+        spu::tools::Stats::show(this->sequence->get_modules_per_types(), true, true, stream);
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::display_latencies(std::ostream& stream) const
+{
+    // merge the replicated latency monitors of each stage
+    std::vector<std::unique_ptr<module::Monitor_latency>> stages;
+    for (auto& m : this->template get_modules<module::Monitor_latency>())
+    {
+        const auto s = m->get_stage_id();
+        if (s == 0) continue; // the 'stamp' monitor does not record latencies
+        if (stages.size() < s) stages.resize(s);
+        if (stages[s - 1] == nullptr) stages[s - 1].reset(new module::Monitor_latency(s));
+        stages[s - 1]->collect(*m);
+    }
+
+    stream << "# Pipeline stage latencies (in us, from the input of a stage to the input of the next one):"
+           << std::endl;
+    for (size_t s = 0; s < stages.size(); s++)
+        if (stages[s] != nullptr && stages[s]->get_n_values())
+            stream << "#   Stage " << (s + 1) << ": p50 = " << stages[s]->get_percentile(50.)
+                   << ", p90 = " << stages[s]->get_percentile(90.) << ", p99 = " << stages[s]->get_percentile(99.)
+                   << ", p99.9 = " << stages[s]->get_percentile(99.9)
+                   << ", max = " << stages[s]->get_percentile(100.) << std::endl;
+    stream << "#" << std::endl;
+}
+
 template<typename B, typename R>
 void
 Simulation_BFER<B, R>::create_monitors_reduction()
 {
-    auto monitors_bfer = sequence->get_modules<module::Monitor_BFER<B>>();
+    auto monitors_bfer = this->template get_modules<module::Monitor_BFER<B>>();
 #ifdef AFF3CT_MPI
-    this->monitor_er_red.reset(new tools::Monitor_reduction_MPI<module::Monitor_BFER<B>>(monitors_bfer));
+    this->monitor_er_red.reset(
+      new tools::Monitor_reduction_MPI<module::Monitor_BFER<B>>(monitors_bfer, this->reduction_engine));
 #else
-    this->monitor_er_red.reset(new tools::Monitor_reduction<module::Monitor_BFER<B>>(monitors_bfer));
+    this->monitor_er_red.reset(
+      new tools::Monitor_reduction<module::Monitor_BFER<B>>(monitors_bfer, this->reduction_engine));
 #endif
 
     if (params_BFER.mnt_mutinfo)
     {
-        auto monitors_mi = sequence->get_modules<module::Monitor_MI<B, R>>();
+        auto monitors_mi = this->template get_modules<module::Monitor_MI<B, R>>();
 #ifdef AFF3CT_MPI
-        this->monitor_mi_red.reset(new tools::Monitor_reduction_MPI<module::Monitor_MI<B, R>>(monitors_mi));
+        this->monitor_mi_red.reset(
+          new tools::Monitor_reduction_MPI<module::Monitor_MI<B, R>>(monitors_mi, this->reduction_engine));
 #else
-        this->monitor_mi_red.reset(new tools::Monitor_reduction<module::Monitor_MI<B, R>>(monitors_mi));
+        this->monitor_mi_red.reset(
+          new tools::Monitor_reduction<module::Monitor_MI<B, R>>(monitors_mi, this->reduction_engine));
 #endif
     }
 
-    tools::Monitor_reduction_static::set_master_thread_id(std::this_thread::get_id());
+    // the reduction of a sub-simulation is driven by its parent
+    if (this->is_sub_simulation)
+    {
+        this->monitor_er_red->reset();
+        return;
+    }
+
+    // each replica publishes its counters in its own slot after each check, the master thread only sums them to take
+    // the stop decision (the replicas are not reduced at each stop condition)
+    std::vector<module::Monitor_MI<B, R>*> monitors_mi;
+    if (params_BFER.mnt_mutinfo) monitors_mi = this->template get_modules<module::Monitor_MI<B, R>>();
+
+    this->reduction_engine.init_counters(std::max(monitors_bfer.size(), monitors_mi.size()),
+                                         monitors_bfer[0]->get_max_fe(),
+                                         monitors_bfer[0]->get_max_n_frames(),
+                                         monitors_mi.size() ? monitors_mi[0]->get_max_n_trials() : 0);
+    for (size_t m = 0; m < monitors_bfer.size(); m++)
+    {
+        auto mnt = monitors_bfer[m];
+        auto& counters = this->reduction_engine.get_counters(m);
+        mnt->record_callback_check(
+          [mnt, &counters]()
+          {
+              counters.n_fra.store(mnt->get_n_analyzed_fra(), std::memory_order_relaxed);
+              counters.n_fe.store(mnt->get_n_fe(), std::memory_order_relaxed);
+          });
+    }
+    for (size_t m = 0; m < monitors_mi.size(); m++)
+    {
+        auto mnt = monitors_mi[m];
+        auto& counters = this->reduction_engine.get_counters(m);
+        mnt->record_callback_check([mnt, &counters]()
+                                   { counters.n_trials.store(mnt->get_n_trials(), std::memory_order_relaxed); });
+    }
+
+    this->reduction_engine.set_master_thread_id(std::this_thread::get_id());
 #ifdef AFF3CT_MPI
-    tools::Monitor_reduction_static::set_reduce_frequency(params_BFER.mnt_mpi_comm_freq);
+    this->reduction_engine.set_reduce_frequency(params_BFER.mnt_mpi_comm_freq);
 #else
-    auto freq = std::chrono::milliseconds(0);
+    // the stop decision does not need the reductions: without lazy reduction the replicas are reduced at each
+    // refresh of the terminal only (and at the end of the noise point)
+    auto freq = std::chrono::nanoseconds(0);
     if (params_BFER.mnt_red_lazy)
     {
         if (params_BFER.mnt_red_lazy_freq.count())
@@ -179,16 +332,74 @@ Simulation_BFER<B, R>::create_monitors_reduction()
         else
             freq = std::chrono::milliseconds(1000); // default value when lazy reduction and no terminal refresh
     }
-    tools::Monitor_reduction_static::set_reduce_frequency(freq);
+    else if (!params_BFER.ter->disabled)
+        freq = params_BFER.ter->frequency;
+    this->reduction_engine.set_reduce_frequency(freq);
 #endif
-    tools::Monitor_reduction_static::reset_all();
-    tools::Monitor_reduction_static::check_reducible();
+    this->reduction_engine.reset_all();
+    this->reduction_engine.check_reducible();
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::update_noise(tools::Noise<>& noise, const int noise_idx) const
+{
+    auto bit_rate = (float)params_BFER.src->K / (float)params_BFER.cdc->N;
+    params_BFER.noise->template update<>(
+      noise, params_BFER.noise->range[noise_idx], bit_rate, params_BFER.mdm->bps, params_BFER.mdm->cpm_upf);
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::dump_err_hist(const module::Monitor_BFER<B>& monitor, const tools::Noise<>& noise) const
+{
+    auto err_hist = monitor.get_err_hist();
+
+    if (err_hist.get_n_values() != 0)
+    {
+        std::string noise_value;
+        switch (noise.get_type())
+        {
+            case tools::Noise_type::SIGMA:
+                if (params_BFER.noise->type == "EBN0")
+                    noise_value = std::to_string(dynamic_cast<const tools::Sigma<>&>(noise).get_ebn0());
+                else //(params_BFER.noise_type == "ESN0")
+                    noise_value = std::to_string(dynamic_cast<const tools::Sigma<>&>(noise).get_esn0());
+                break;
+            case tools::Noise_type::ROP:
+            case tools::Noise_type::EP:
+                noise_value = std::to_string(noise.get_value());
+                break;
+        }
+
+        std::ofstream file_err_hist(params_BFER.mnt_er->err_hist_path + "_" + noise_value + ".txt");
+        file_err_hist << "\"Number of error bits per wrong frame\"; \"Histogram (noise: " << noise_value
+                      << noise.get_unity() << ", on " << err_hist.get_n_values() << " frames)\"" << std::endl;
+
+        int max;
+        if (params_BFER.mnt_er->err_hist == 0)
+            max = err_hist.get_hist_max();
+        else
+            max = params_BFER.mnt_er->err_hist;
+        err_hist.dump(file_err_hist, 0, max);
+    }
 }
 
 template<typename B, typename R>
 void
 Simulation_BFER<B, R>::launch()
 {
+    if (params_BFER.conc_noise > 1)
+    {
+        this->launch_concurrent();
+        return;
+    }
+
+    // the seed epoch has to be known before the creation of the sequence
+    if (params_BFER.resume) this->load_checkpoint();
+    if (!params_BFER.cache_path.empty()) this->load_cache();
+    this->master_thread_id = std::this_thread::get_id();
+
     if (!params_BFER.err_track_revert)
     {
         this->create_modules();
@@ -212,12 +423,24 @@ Simulation_BFER<B, R>::launch()
         noise_step = -1;
     }
 
+    if (params_BFER.resume)
+    {
+        if (this->chkpt_noise_idx != noise_end &&
+            (this->chkpt_noise_idx < 0 || this->chkpt_noise_idx >= (int)params_BFER.noise->range.size()))
+        {
+            std::stringstream message;
+            message << "The noise index of the checkpoint is out of the noise range ('chkpt_noise_idx' = "
+                    << this->chkpt_noise_idx << ", 'noise->range.size()' = " << params_BFER.noise->range.size()
+                    << ").";
+            throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+        noise_begin = this->chkpt_noise_idx;
+    }
+
     // for each NOISE to be simulated
     for (auto noise_idx = noise_begin; noise_idx != noise_end; noise_idx += noise_step)
     {
-        auto bit_rate = (float)params_BFER.src->K / (float)params_BFER.cdc->N;
-        params_BFER.noise->template update<>(
-          *this->noise, params_BFER.noise->range[noise_idx], bit_rate, params_BFER.mdm->bps, params_BFER.mdm->cpm_upf);
+        this->update_noise(*this->noise, noise_idx);
 
         std::fill(this->channel_params.begin(), this->channel_params.end(), this->noise->get_value());
 
@@ -279,15 +502,53 @@ Simulation_BFER<B, R>::launch()
                 terminal->start_temp_report(params_BFER.ter->frequency);
 
         this->t_start_noise_point = std::chrono::steady_clock::now();
+        this->t_last_chkpt = this->t_start_noise_point;
+
+        // a noise point of the result cache is restored, it is not simulated again if it is complete
+        unsigned cache_runs = 0;
+        if (!params_BFER.cache_path.empty())
+        {
+            auto it = this->cache_points.find(this->get_cache_noise_key(noise_idx));
+            if (it != this->cache_points.end())
+            {
+                cache_runs = it->second.first;
+                this->chkpt_monitor_state = it->second.second;
+            }
+        }
+
+        if (!this->chkpt_monitor_state.empty()) this->restore_checkpoint_monitor();
+
+        const bool cache_hit =
+          cache_runs && (this->monitor_er_red->fe_limit_achieved() || this->monitor_er_red->frame_limit_achieved());
+        if (!params_BFER.cache_path.empty() && !cache_hit && this->seed_epoch != cache_runs)
+        {
+            // the frames of the previous runs must not be replayed
+            this->seed_epoch = cache_runs;
+            this->set_seeds();
+        }
 
         try
         {
-            this->sequence->exec([this]() { return this->stop_condition(); });
-            tools::Monitor_reduction_static::last_reduce_all(); // final reduction
+            // the sequence is stopped and restarted each time a checkpoint is written
+            if (!cache_hit)
+                do
+                {
+                    this->chkpt_pending = false;
+                    this->exec_sequence([this]() { return this->stop_condition(); });
+
+                    if (this->chkpt_pending)
+                    {
+                        this->monitor_er_red->reduce(true);
+                        this->save_checkpoint(noise_idx, this->monitor_er_red.get());
+                        this->t_last_chkpt = std::chrono::steady_clock::now();
+                    }
+                } while (this->chkpt_pending);
+
+            this->reduction_engine.last_reduce_all(); // final reduction
         }
         catch (std::exception const& e)
         {
-            tools::Monitor_reduction_static::last_reduce_all(); // final reduction
+            this->reduction_engine.last_reduce_all(); // final reduction
 
             terminal->final_report(std::cout); // display final report to not lost last line overwritten by the error
                                                // messages
@@ -307,44 +568,21 @@ Simulation_BFER<B, R>::launch()
                 if (params_BFER.statistics)
                 {
                     std::cout << "#" << std::endl;
-                    spu::tools::Stats::show(this->sequence->get_modules_per_types(), true, true, std::cout);
+                    this->show_stats(std::cout);
                     std::cout << "#" << std::endl;
                 }
+
+                if (this->pipeline != nullptr) this->display_latencies(std::cout);
             }
 
-        if (params_BFER.mnt_er->err_hist != -1)
-        {
-            auto err_hist = monitor_er_red->get_err_hist();
+        if (params_BFER.mnt_er->err_hist != -1) this->dump_err_hist(*this->monitor_er_red, *this->noise);
 
-            if (err_hist.get_n_values() != 0)
-            {
-                std::string noise_value;
-                switch (this->noise->get_type())
-                {
-                    case tools::Noise_type::SIGMA:
-                        if (params_BFER.noise->type == "EBN0")
-                            noise_value = std::to_string(dynamic_cast<tools::Sigma<>*>(this->noise.get())->get_ebn0());
-                        else //(params_BFER.noise_type == "ESN0")
-                            noise_value = std::to_string(dynamic_cast<tools::Sigma<>*>(this->noise.get())->get_esn0());
-                        break;
-                    case tools::Noise_type::ROP:
-                    case tools::Noise_type::EP:
-                        noise_value = std::to_string(this->noise->get_value());
-                        break;
-                }
-
-                std::ofstream file_err_hist(params_BFER.mnt_er->err_hist_path + "_" + noise_value + ".txt");
-                file_err_hist << "\"Number of error bits per wrong frame\"; \"Histogram (noise: " << noise_value
-                              << this->noise->get_unity() << ", on " << err_hist.get_n_values() << " frames)\""
-                              << std::endl;
-
-                int max;
-                if (params_BFER.mnt_er->err_hist == 0)
-                    max = err_hist.get_hist_max();
-                else
-                    max = params_BFER.mnt_er->err_hist;
-                err_hist.dump(file_err_hist, 0, max);
-            }
+        if (!params_BFER.cache_path.empty() && !cache_hit && !this->simu_error)
+        {
+            std::stringstream state;
+            this->monitor_er_red->save_state(state);
+            this->cache_points[this->get_cache_noise_key(noise_idx)] = std::make_pair(cache_runs + 1, state.str());
+            this->save_cache();
         }
 
         if (this->dumper_red != nullptr && !this->simu_error)
@@ -356,15 +594,527 @@ Simulation_BFER<B, R>::launch()
             this->dumper_red->clear();
         }
 
-        if (!params_BFER.crit_nostop && !params_BFER.err_track_revert && !this->monitor_er_red->fe_limit_achieved() &&
-            (this->monitor_er_red->frame_limit_achieved() || this->stop_time_reached()))
-            break;
+        const bool stop_simu = !params_BFER.crit_nostop && !params_BFER.err_track_revert &&
+                               !this->monitor_er_red->fe_limit_achieved() &&
+                               (this->monitor_er_red->frame_limit_achieved() || this->stop_time_reached());
+
+        // an interrupted noise point is continued on resume, else the next one is started from scratch
+        if (!params_BFER.chkpt_path.empty() && !this->simu_error)
+        {
+            if (!stop_simu)
+                this->save_checkpoint(noise_idx + noise_step, nullptr);
+            else if (this->monitor_er_red->frame_limit_achieved())
+                this->save_checkpoint(noise_end, nullptr); // the simulation is over
+            else
+                this->save_checkpoint(noise_idx, this->monitor_er_red.get());
+        }
 
-        for (auto& mod : sequence->get_modules<spu::module::Module>())
+        if (stop_simu) break;
+
+        for (auto& mod : this->template get_modules<spu::module::Module>())
             for (auto& tsk : mod->tasks)
                 tsk->reset();
 
-        tools::Monitor_reduction_static::reset_all();
+        for (auto& mnt : this->template get_modules<module::Monitor_latency>())
+            mnt->reset();
+
+        this->reduction_engine.reset_all();
+    }
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::prepare_sub_simulation(const int noise_idx)
+{
+    this->create_modules();
+    this->bind_sockets();
+    this->create_sequence();
+    this->configure_sequence_tasks();
+    this->create_monitors_reduction();
+
+    this->update_noise(*this->noise, noise_idx);
+    std::fill(this->channel_params.begin(), this->channel_params.end(), this->noise->get_value());
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::launch_concurrent()
+{
+    // a shard is a sub-simulation (with its own sequence and threads) contributing to a noise point
+    struct Shard
+    {
+        std::unique_ptr<factory::BFER> params;
+        std::unique_ptr<Simulation_BFER<B, R>> simu;
+        std::thread thread;
+        std::atomic<bool> finished;
+        std::string error;
+        int n_threads;
+    };
+
+    struct Point
+    {
+        int noise_idx;
+        std::unique_ptr<tools::Noise<>> noise;
+        std::unique_ptr<module::Monitor_BFER<B>> monitor; // reduction of the monitors of all the shards
+        std::vector<std::unique_ptr<spu::tools::Reporter>> reporters;
+        std::unique_ptr<spu::tools::Terminal> terminal;
+        std::vector<std::unique_ptr<Shard>> shards;
+        std::chrono::steady_clock::time_point t_start;
+        bool stopping;
+        bool done;
+    };
+
+    std::vector<int> noise_indices;
+    if (params_BFER.noise->type == "EP")
+        for (auto n = (int)params_BFER.noise->range.size() - 1; n >= 0; n--)
+            noise_indices.push_back(n);
+    else
+        for (auto n = 0; n < (int)params_BFER.noise->range.size(); n++)
+            noise_indices.push_back(n);
+
+#ifdef AFF3CT_MPI
+    const auto d_reduce = params_BFER.mnt_mpi_comm_freq;
+#else
+    auto d_reduce = std::chrono::milliseconds(1);
+    if (params_BFER.mnt_red_lazy)
+        d_reduce = params_BFER.mnt_red_lazy_freq.count() ? params_BFER.mnt_red_lazy_freq : std::chrono::milliseconds(1000);
+#endif
+
+    const int n_conc = std::min((int)noise_indices.size(), params_BFER.conc_noise);
+    std::vector<std::unique_ptr<Point>> points(noise_indices.size());
+    size_t n_points_end = noise_indices.size(); // the points after this one will not be simulated
+    size_t n_started = 0, n_displayed = 0;
+    int free_threads = params_BFER.n_threads, n_running = 0, n_shards = 0;
+
+    auto point_time_reached = [this](const Point& point)
+    {
+        return this->params_BFER.stop_time != std::chrono::seconds(0) &&
+               (std::chrono::steady_clock::now() - point.t_start) >= this->params_BFER.stop_time;
+    };
+
+    auto stop_point = [](Point& point)
+    {
+        point.stopping = true;
+        for (auto& shard : point.shards)
+            shard->simu->sub_stop = true;
+    };
+
+    auto start_shard = [this, &free_threads, &n_shards](Point& point, const int n_threads)
+    {
+        std::unique_ptr<Shard> shard(new Shard());
+        shard->params.reset(this->params_BFER.clone());
+        shard->params->n_threads = n_threads;
+        shard->params->conc_noise = 1;
+        shard->params->local_seed = this->params_BFER.local_seed + (n_shards++) * this->params_BFER.n_threads;
+        shard->simu.reset(this->build_sub_simulation(*shard->params));
+        shard->simu->is_sub_simulation = true;
+        shard->simu->prepare_sub_simulation(point.noise_idx);
+        shard->simu->t_start_noise_point = point.t_start;
+        shard->finished = false;
+        shard->n_threads = n_threads;
+
+        auto s = shard.get();
+        shard->thread = std::thread(
+          [s]()
+          {
+              try
+              {
+                  s->simu->sequence->exec([s]() { return s->simu->stop_condition(); });
+              }
+              catch (std::exception const& e)
+              {
+                  s->error = e.what();
+              }
+              s->finished = true;
+          });
+
+        free_threads -= n_threads;
+        point.shards.push_back(std::move(shard));
+    };
+
+    auto start_point = [&](const int n_threads)
+    {
+        auto& point = points[n_started++];
+        point.reset(new Point());
+        point->noise_idx = noise_indices[n_started - 1];
+        point->noise.reset(params_BFER.noise->template build<>());
+        this->update_noise(*point->noise, point->noise_idx);
+        point->monitor = this->build_monitor_er();
+        point->reporters = this->build_reporters(point->noise.get(), point->monitor.get(), nullptr);
+        point->terminal = this->build_terminal(point->reporters);
+        point->t_start = std::chrono::steady_clock::now();
+        point->stopping = false;
+        point->done = false;
+        start_shard(*point, n_threads);
+        n_running++;
+    };
+
+    while (free_threads > 0 && n_started < n_points_end && n_running < n_conc)
+        start_point(std::max(1, free_threads / (n_conc - n_running)));
+
+    while (n_running)
+    {
+        std::this_thread::sleep_for(d_reduce);
+
+        for (size_t p = 0; p < n_started; p++)
+        {
+            auto& point = points[p];
+            if (point == nullptr || point->done) continue;
+
+            bool finished = true;
+            point->monitor->reset();
+            for (auto& shard : point->shards)
+            {
+                shard->simu->monitor_er_red->reduce(false);
+                point->monitor->collect(*shard->simu->monitor_er_red, false);
+                finished = finished && shard->finished;
+            }
+
+            if (!point->stopping && (point->monitor->is_done() || point_time_reached(*point))) stop_point(*point);
+
+            if (!finished) continue;
+
+            // final reduction of the noise point
+            point->monitor->reset();
+            for (auto& shard : point->shards)
+            {
+                shard->thread.join();
+                free_threads += shard->n_threads;
+                shard->simu->monitor_er_red->reduce(true);
+                point->monitor->collect(*shard->simu->monitor_er_red, true);
+            }
+            point->done = true;
+            n_running--;
+
+            bool error = false;
+            for (auto& shard : point->shards)
+                error = error || !shard->error.empty();
+
+            if (error || (!params_BFER.crit_nostop && !point->monitor->fe_limit_achieved() &&
+                          (point->monitor->frame_limit_achieved() || point_time_reached(*point))))
+            {
+                n_points_end = std::min(n_points_end, p + 1);
+                for (size_t pp = p + 1; pp < n_started; pp++)
+                    if (points[pp] != nullptr && !points[pp]->done) stop_point(*points[pp]);
+            }
+        }
+
+        // display the finished noise points in the range order
+        while (n_displayed < std::min(n_started, n_points_end) && points[n_displayed]->done)
+        {
+            auto& point = points[n_displayed];
+
+            if (params_BFER.display_legend && !params_BFER.ter->disabled && n_displayed == 0)
+                point->terminal->legend(std::cout);
+
+            for (auto& shard : point->shards)
+                if (!shard->error.empty())
+                {
+                    point->terminal->final_report(std::cout);
+                    rang::format_on_each_line(std::cerr, shard->error + "\n", rang::tag::error);
+                    this->simu_error = true;
+                }
+
+            if (!params_BFER.ter->disabled && !this->simu_error)
+            {
+                point->terminal->final_report(std::cout);
+
+                if (params_BFER.statistics)
+                    for (auto& shard : point->shards)
+                    {
+                        std::cout << "#" << std::endl;
+                        spu::tools::Stats::show(shard->simu->sequence->get_modules_per_types(), true, true, std::cout);
+                        std::cout << "#" << std::endl;
+                    }
+            }
+
+            if (params_BFER.mnt_er->err_hist != -1) this->dump_err_hist(*point->monitor, *point->noise);
+
+            point.reset();
+            n_displayed++;
+        }
+
+        // give the free threads to the next noise points or help the slowest running noise point
+        while (free_threads > 0 && n_started < n_points_end && n_running < n_conc)
+            start_point(std::max(1, free_threads / (n_conc - n_running)));
+
+        if (free_threads > 0 && n_started >= n_points_end)
+        {
+            Point* slowest = nullptr;
+            double slowest_progress = 1.;
+            for (size_t p = 0; p < n_started; p++)
+            {
+                auto& point = points[p];
+                if (point == nullptr || point->done || point->stopping) continue;
+
+                const auto& mnt = *point->monitor;
+                double progress = 0.;
+                if (mnt.get_max_fe())
+                    progress = (double)mnt.get_n_fe() / (double)mnt.get_max_fe();
+                else if (mnt.get_max_n_frames())
+                    progress = (double)mnt.get_n_analyzed_fra() / (double)mnt.get_max_n_frames();
+
+                if (slowest == nullptr || progress < slowest_progress)
+                {
+                    slowest = point.get();
+                    slowest_progress = progress;
+                }
+            }
+
+            if (slowest != nullptr) start_shard(*slowest, free_threads);
+        }
+    }
+}
+
+template<typename B, typename R>
+int
+Simulation_BFER<B, R>::get_local_seed() const
+{
+    if (this->seed_epoch == 0) return params_BFER.local_seed;
+
+    // a resumed simulation must not replay the frames simulated before the checkpoint
+    std::seed_seq seq{ (unsigned)params_BFER.local_seed, this->seed_epoch };
+    std::vector<unsigned> seed(1);
+    seq.generate(seed.begin(), seed.end());
+    return (int)(seed[0] >> 1);
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::save_checkpoint(const int noise_idx, const module::Monitor_BFER<B>* monitor) const
+{
+#ifdef AFF3CT_MPI
+    if (params_BFER.mpi_rank != 0) return;
+#endif
+
+    // write a temporary file first, a checkpoint is never left half written if the simulation is killed
+    const std::string tmp_path = params_BFER.chkpt_path + ".tmp";
+    {
+        std::ofstream file(tmp_path);
+        if (!file.is_open())
+        {
+            std::stringstream message;
+            message << "Impossible to write the checkpoint file ('tmp_path' = " << tmp_path << ").";
+            throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        file << "# AFF3CT BFER checkpoint" << std::endl;
+        file << "noise_idx " << noise_idx << std::endl;
+        file << "seed_epoch " << this->seed_epoch << std::endl;
+
+        if (monitor != nullptr) monitor->save_state(file);
+    }
+
+    if (std::rename(tmp_path.c_str(), params_BFER.chkpt_path.c_str()))
+    {
+        std::stringstream message;
+        message << "Impossible to rename the checkpoint file ('tmp_path' = " << tmp_path
+                << ", 'chkpt_path' = " << params_BFER.chkpt_path << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::load_checkpoint()
+{
+    std::ifstream file(params_BFER.chkpt_path);
+    if (!file.is_open())
+    {
+        std::stringstream message;
+        message << "Impossible to read the checkpoint file ('chkpt_path' = " << params_BFER.chkpt_path << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    std::string header, key_idx, key_epoch;
+    std::getline(file, header);
+    file >> key_idx >> this->chkpt_noise_idx >> key_epoch >> this->seed_epoch;
+    if (!file || header != "# AFF3CT BFER checkpoint" || key_idx != "noise_idx" || key_epoch != "seed_epoch")
+    {
+        std::stringstream message;
+        message << "The checkpoint file is corrupted ('chkpt_path' = " << params_BFER.chkpt_path << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+    this->seed_epoch++;
+
+    // the monitor counters are omitted when the noise point has to be started from scratch
+    std::stringstream state;
+    state << file.rdbuf();
+    if (state.str().find_first_not_of(" \t\r\n") != std::string::npos) this->chkpt_monitor_state = state.str();
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::restore_checkpoint_monitor()
+{
+    // the counters are added once in the first monitor, the reductions sum them with the new results
+#ifdef AFF3CT_MPI
+    if (params_BFER.mpi_rank == 0)
+#endif
+    {
+        std::stringstream state(this->chkpt_monitor_state);
+        this->template get_modules<module::Monitor_BFER<B>>()[0]->load_state(state);
+    }
+    this->chkpt_monitor_state.clear();
+
+    this->monitor_er_red->reduce(true);
+}
+
+template<typename B, typename R>
+bool
+Simulation_BFER<B, R>::checkpoint_due() const
+{
+#ifdef AFF3CT_MPI
+    // with MPI the checkpoints are only written at the end of the noise points (the reductions are collective)
+    return false;
+#else
+    return !params_BFER.chkpt_path.empty() && std::this_thread::get_id() == this->master_thread_id &&
+           (std::chrono::steady_clock::now() - this->t_last_chkpt) >= params_BFER.chkpt_freq;
+#endif
+}
+
+template<typename B, typename R>
+std::string
+Simulation_BFER<B, R>::get_cache_noise_key(const int noise_idx) const
+{
+    std::stringstream key;
+    key << std::setprecision(std::numeric_limits<float>::max_digits10) << params_BFER.noise->range[noise_idx];
+    return key.str();
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::load_cache()
+{
+    // the parameters which do not change the statistics of the results are not part of the key
+    static const std::vector<std::string> ignored = { "Seed",
+                                                      "Statistics",
+                                                      "Debug mode",
+                                                      "Debug precision",
+                                                      "Debug limit",
+                                                      "Inter frame level",
+                                                      "Multi-threading (t)",
+                                                      "MPI size",
+                                                      "Noise range",
+                                                      "Frame error count (e)",
+                                                      "Error histogram path",
+                                                      "Lazy reduction",
+                                                      "Lazy reduction freq. (ms)",
+                                                      "MPI comm. freq. (ms)",
+                                                      "Concurrent noise points",
+                                                      "Bad frames tracking",
+                                                      "Bad frames replay",
+                                                      "Bad frames threshold",
+                                                      "Path export sequence (dot)",
+                                                      "Pipeline",
+                                                      "Pipeline threads",
+                                                      "Pipeline buffer size",
+                                                      "Result cache path" };
+
+    std::map<std::string, tools::header_list> headers;
+    params_BFER.get_headers(headers, true);
+
+    std::stringstream canonical;
+    for (auto& h : headers)
+    {
+        if (h.first == params_BFER.ter->get_prefix()) continue;
+        for (auto& kv : h.second)
+            if (std::find(ignored.begin(), ignored.end(), kv.first) == ignored.end())
+                canonical << h.first << " | " << kv.first << " | " << kv.second << std::endl;
+    }
+    this->cache_params = canonical.str();
+
+    // 64-bit FNV-1a hash of the canonical parameters
+    uint64_t hash = 14695981039346656037ull;
+    for (auto c : this->cache_params)
+    {
+        hash ^= (uint64_t)(unsigned char)c;
+        hash *= 1099511628211ull;
+    }
+
+    std::stringstream path;
+    path << params_BFER.cache_path << "_" << std::hex << std::setw(16) << std::setfill('0') << hash;
+    this->cache_file = path.str();
+
+    this->cache_points.clear();
+    std::ifstream file(this->cache_file);
+    if (!file.is_open()) return; // these parameters have never been simulated
+
+    std::string line, key;
+    size_t n_lines = 0;
+    std::getline(file, line);
+    if (line != "# AFF3CT BFER result cache" || !(file >> key >> n_lines) || key != "params")
+    {
+        std::stringstream message;
+        message << "The result cache file is corrupted ('cache_file' = " << this->cache_file << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+    std::getline(file, line);
+
+    std::stringstream params;
+    for (size_t l = 0; l < n_lines && std::getline(file, line); l++)
+        params << line << std::endl;
+
+    if (params.str() != this->cache_params)
+    {
+        std::stringstream message;
+        message << "The result cache file has been written with other parameters (hash collision), please use another "
+                   "'cache_path' ('cache_file' = "
+                << this->cache_file << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    // a point is a line 'point <noise> <runs>' followed by the monitor state
+    std::pair<unsigned, std::string>* point = nullptr;
+    while (std::getline(file, line))
+    {
+        std::stringstream ss(line);
+        std::string noise;
+        unsigned runs;
+        if (ss >> key && key == "point" && ss >> noise >> runs)
+        {
+            point = &this->cache_points[noise];
+            *point = std::make_pair(runs, std::string());
+        }
+        else if (point != nullptr)
+            point->second += line + "\n";
+    }
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::save_cache() const
+{
+#ifdef AFF3CT_MPI
+    if (params_BFER.mpi_rank != 0) return;
+#endif
+
+    // write a temporary file first, the cache is never left half written if the simulation is killed
+    const std::string tmp_path = this->cache_file + ".tmp";
+    {
+        std::ofstream file(tmp_path);
+        if (!file.is_open())
+        {
+            std::stringstream message;
+            message << "Impossible to write the result cache file ('tmp_path' = " << tmp_path << ").";
+            throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        const auto n_lines = std::count(this->cache_params.begin(), this->cache_params.end(), '\n');
+        file << "# AFF3CT BFER result cache" << std::endl;
+        file << "params " << n_lines << std::endl;
+        file << this->cache_params;
+
+        for (auto& p : this->cache_points)
+            file << "point " << p.first << " " << p.second.first << std::endl << p.second.second;
+    }
+
+    if (std::rename(tmp_path.c_str(), this->cache_file.c_str()))
+    {
+        std::stringstream message;
+        message << "Impossible to rename the result cache file ('tmp_path' = " << tmp_path
+                << ", 'cache_file' = " << this->cache_file << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 }
 
@@ -380,7 +1130,19 @@ template<typename B, typename R>
 bool
 Simulation_BFER<B, R>::stop_condition()
 {
-    return tools::Monitor_reduction_static::is_done_all() || stop_time_reached();
+    if (this->is_sub_simulation) return this->sub_stop || stop_time_reached();
+
+    // the pipeline runs on its own threads, the first one to check the stop condition drives the reductions
+    if (this->pipeline != nullptr && !this->pipeline_master_set && !this->pipeline_master_set.exchange(true))
+    {
+        this->master_thread_id = std::this_thread::get_id();
+        this->reduction_engine.set_master_thread_id(this->master_thread_id);
+    }
+
+    const bool stop = this->reduction_engine.is_done_all() || stop_time_reached();
+    if (!stop && this->checkpoint_due()) this->chkpt_pending = true;
+
+    return stop || this->chkpt_pending;
 }
 
 // ==================================================================================== explicit template instantiation
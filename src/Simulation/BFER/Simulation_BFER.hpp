@@ -1,16 +1,24 @@
 #ifndef SIMULATION_BFER_HPP_
 #define SIMULATION_BFER_HPP_
 
+#include <atomic>
 #include <chrono>
+#include <functional>
+#include <iostream>
+#include <map>
 #include <memory>
 #include <streampu.hpp>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "Module/Monitor/BFER/Monitor_BFER.hpp"
+#include "Module/Monitor/Latency/Monitor_latency.hpp"
 #include "Module/Monitor/MI/Monitor_MI.hpp"
 #include "Tools/Constellation/Constellation.hpp"
 #include "Tools/Display/Dumper/Dumper.hpp"
 #include "Tools/Display/Dumper/Dumper_reduction.hpp"
+#include "Tools/Display/Dumper/Dumper_stream.hpp"
 #include "Tools/Math/Distribution/Distributions.hpp"
 #include "Tools/Monitor/Monitor_reduction.hpp"
 #ifdef AFF3CT_MPI
@@ -43,9 +51,16 @@ class Simulation_BFER : public Simulation
     std::unique_ptr<module::Monitor_MI<B, R>> monitor_mi;
     std::unique_ptr<spu::runtime::Sequence> sequence;
 
+    // pipelined execution: the chain is split in stages running on different threads (replaces 'sequence')
+    std::unique_ptr<spu::runtime::Pipeline> pipeline;
+    std::vector<std::unique_ptr<module::Monitor_latency>> monitor_lat; // 'stamp' then one 'measure' per stage
+    std::atomic<bool> pipeline_master_set;
+
     std::vector<std::unique_ptr<spu::tools::Reporter>> reporters;
     std::unique_ptr<spu::tools::Terminal> terminal;
 
+    // has to be declared before the monitor reductions, they unregister from it when destroyed
+    tools::Monitor_reduction_engine reduction_engine;
 #ifdef AFF3CT_MPI
     std::unique_ptr<tools::Monitor_reduction_MPI<module::Monitor_BFER<B>>> monitor_er_red;
     std::unique_ptr<tools::Monitor_reduction_MPI<module::Monitor_MI<B, R>>> monitor_mi_red;
@@ -60,6 +75,23 @@ class Simulation_BFER : public Simulation
 
     std::chrono::steady_clock::time_point t_start_noise_point;
 
+    // concurrent noise points: a sub-simulation runs a single noise point and is stopped by its parent
+    bool is_sub_simulation;
+    std::atomic<bool> sub_stop;
+
+    // checkpoint and resume of long simulations
+    unsigned seed_epoch;             // incremented at each resume, the PRNGs do not replay the previous frames
+    int chkpt_noise_idx;             // noise index read from the checkpoint file
+    std::string chkpt_monitor_state; // monitor counters read from the checkpoint file (restored once)
+    std::atomic<bool> chkpt_pending; // the sequence has been stopped to write a checkpoint
+    std::chrono::steady_clock::time_point t_last_chkpt;
+    std::thread::id master_thread_id;
+
+    // on-disk result cache: the noise points already simulated with the same parameters are skipped or topped up
+    std::string cache_params; // canonical parameters (without the noise values and the stop criteria)
+    std::string cache_file;   // 'cache_path' followed by the hash of 'cache_params'
+    std::map<std::string, std::pair<unsigned, std::string>> cache_points; // noise -> number of runs, monitor state
+
   public:
     explicit Simulation_BFER(const factory::BFER& params_BFER);
 
@@ -79,13 +111,46 @@ class Simulation_BFER : public Simulation
     virtual void create_modules();
     virtual void bind_sockets() = 0;
     virtual void create_sequence() = 0;
+    virtual void set_seeds() = 0;
     void configure_sequence_tasks();
+
+    template<class C>
+    std::vector<C*> get_modules() const; // the modules of the sequence or of the pipeline
+    void exec_sequence(std::function<bool()> stop_condition);
+    void show_stats(std::ostream& stream) const;
+    void display_latencies(std::ostream& stream) const;
     void create_monitors_reduction();
 
+    virtual Simulation_BFER<B, R>* build_sub_simulation(const factory::BFER& sub_params) const = 0;
+    void prepare_sub_simulation(const int noise_idx);
+    void launch_concurrent();
+
+    void update_noise(tools::Noise<>& noise, const int noise_idx) const;
+    void dump_err_hist(const module::Monitor_BFER<B>& monitor, const tools::Noise<>& noise) const;
+
+    int get_local_seed() const;
+    void save_checkpoint(const int noise_idx, const module::Monitor_BFER<B>* monitor) const;
+    void load_checkpoint();
+    void restore_checkpoint_monitor();
+    bool checkpoint_due() const;
+
+    std::string get_cache_noise_key(const int noise_idx) const;
+    void load_cache();
+    void save_cache() const;
+
     bool stop_time_reached();
     bool stop_condition();
 };
 
+template<typename B, typename R>
+template<class C>
+std::vector<C*>
+Simulation_BFER<B, R>::get_modules() const
+{
+    if (this->pipeline != nullptr) return this->pipeline->template get_modules<C>();
+    return this->sequence->template get_modules<C>();
+}
+
 }
 }
 
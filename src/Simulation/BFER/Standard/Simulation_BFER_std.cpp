@@ -2,8 +2,11 @@
 #include <functional>
 #include <iostream>
 #include <random>
+#include <sstream>
 #include <streampu.hpp>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <vector>
 
 #include "Factory/Module/Coset/Coset.hpp"
@@ -29,6 +32,50 @@ Simulation_BFER_std<B, R, Q>::Simulation_BFER_std(const factory::BFER_std& param
                   << "Multi-threading detected with error tracking revert feature! "
                      "Each thread will play the same frames. Please run with one thread."
                   << std::endl;
+
+    if (this->params_BFER_std.pipeline)
+    {
+        if (this->params_BFER_std.chn->type == "NO" || this->params_BFER_std.conc_noise > 1 ||
+            this->params_BFER_std.err_track_enable || this->params_BFER_std.err_track_revert)
+        {
+            std::stringstream message;
+            message << "The pipelined execution requires a channel and can't be combined with the concurrent noise "
+                       "points or the error tracking ('chn->type' = "
+                    << this->params_BFER_std.chn->type << ", 'conc_noise' = " << this->params_BFER_std.conc_noise
+                    << ").";
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        if (this->params_BFER_std.pipeline_threads.size() != 3)
+        {
+            std::stringstream message;
+            message << "'pipeline_threads.size()' has to be equal to 3 ('pipeline_threads.size()' = "
+                    << this->params_BFER_std.pipeline_threads.size() << ").";
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+    }
+
+    if (this->params_BFER_std.packed)
+    {
+        if (this->params_BFER_std.src->type != "RAND" || this->params_BFER_std.src->implem != "FAST")
+        {
+            std::stringstream message;
+            message << "The packed bits require the 'RAND' source with the 'FAST' implementation ('src->type' = "
+                    << this->params_BFER_std.src->type << ", 'src->implem' = " << this->params_BFER_std.src->implem
+                    << ").";
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        if (this->params_BFER_std.coset || this->params_BFER_std.err_track_enable ||
+            this->params_BFER_std.err_track_revert || this->params_BFER_std.chn->is_bias != "NONE")
+        {
+            std::stringstream message;
+            message << "The packed bits can't be combined with the coset approach, the error tracking or the "
+                       "importance sampling ('chn->is_bias' = "
+                    << this->params_BFER_std.chn->is_bias << ").";
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+    }
 }
 
 template<typename B, typename R, typename Q>
@@ -130,6 +177,15 @@ Simulation_BFER_std<B, R, Q>::build_coset_bit()
     return cst;
 }
 
+template<typename B, typename R, typename Q>
+std::unique_ptr<module::Packer<B>>
+Simulation_BFER_std<B, R, Q>::build_packer(const int size)
+{
+    auto pkr = std::unique_ptr<module::Packer<B>>(new module::Packer<B>(size));
+    pkr->set_n_frames(this->params.n_frames);
+    return pkr;
+}
+
 template<typename B, typename R, typename Q>
 void
 Simulation_BFER_std<B, R, Q>::create_modules()
@@ -144,6 +200,20 @@ Simulation_BFER_std<B, R, Q>::create_modules()
     this->quantizer = this->build_quantizer();
     this->coset_real = this->build_coset_real();
     this->coset_bit = this->build_coset_bit();
+
+    if (this->params_BFER_std.packed)
+    {
+        this->packer_X = this->build_packer(this->params_BFER_std.cdc->N_cw);
+        this->packer_V = this->build_packer(this->params_BFER_std.mnt_er->K);
+    }
+
+    // the frames are stamped at the input of the pipeline, then measured at the input of the next stages
+    if (this->params_BFER_std.pipeline)
+        for (size_t s = 0; s < 3; s++)
+        {
+            this->monitor_lat.push_back(std::unique_ptr<module::Monitor_latency>(new module::Monitor_latency(s)));
+            this->monitor_lat.back()->set_n_frames(this->params.n_frames);
+        }
 }
 
 template<typename B, typename R, typename Q>
@@ -168,6 +238,11 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
     std::vector<spu::module::Module*> modules = {
         &src, &crc, &enc, &pct, &mdm, &chn, &qnt, &csr, &dec, &csb, &mnt, &mni
     };
+    if (this->params_BFER_std.packed)
+    {
+        modules.push_back(this->packer_X.get());
+        modules.push_back(this->packer_V.get());
+    }
     for (auto& mod : modules)
         for (auto& tsk : mod->tasks)
             tsk->set_autoalloc(true);
@@ -193,6 +268,37 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
         mdm[mdm::tsk::modulate].exec();
         mdm[mdm::tsk::modulate].reset();
     }
+    else if (this->params_BFER_std.packed)
+    {
+        // the bits stay packed from the source to the encoder, the codewords are unpacked for the modulation
+        auto& pkx = *this->packer_X;
+
+        if (this->params_BFER_std.crc->type != "NO")
+            crc[crc::sck::build_packed::U_K1] = src[spu::module::src::sck::generate::out_data];
+
+        if (this->params_BFER_std.cdc->enc->type != "NO")
+        {
+            if (this->params_BFER_std.crc->type != "NO")
+                enc[enc::sck::encode_packed::U_K] = crc[crc::sck::build_packed::U_K2];
+            else
+                enc[enc::sck::encode_packed::U_K] = src[spu::module::src::sck::generate::out_data];
+        }
+
+        if (this->params_BFER_std.cdc->enc->type != "NO")
+            pkx[pkr::sck::unpack::in] = enc[enc::sck::encode_packed::X_N];
+        else if (this->params_BFER_std.crc->type != "NO")
+            pkx[pkr::sck::unpack::in] = crc[crc::sck::build_packed::U_K2];
+        else
+            pkx[pkr::sck::unpack::in] = src[spu::module::src::sck::generate::out_data];
+
+        if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
+        {
+            pct[pct::sck::puncture::X_N1] = pkx[pkr::sck::unpack::out];
+            mdm[mdm::sck::modulate::X_N1] = pct[pct::sck::puncture::X_N2];
+        }
+        else
+            mdm[mdm::sck::modulate::X_N1] = pkx[pkr::sck::unpack::out];
+    }
     else
     {
         if (this->params_BFER_std.crc->type != "NO")
@@ -228,6 +334,13 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
 
     const auto is_rayleigh = this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos;
     const auto is_optical = this->params_BFER_std.chn->type == "OPTICAL" && this->params_BFER_std.mdm->rop_est_bits > 0;
+
+    // with the importance sampling, the noisy frames and their weights come from the 'add_noise_is' task
+    const auto importance_sampling = this->params_BFER_std.chn->is_bias != "NONE";
+    auto& chn_CP = importance_sampling ? chn[chn::sck::add_noise_is::CP] : chn[chn::sck::add_noise::CP];
+    auto& chn_X_N = importance_sampling ? chn[chn::sck::add_noise_is::X_N] : chn[chn::sck::add_noise::X_N];
+    auto& chn_Y_N = importance_sampling ? chn[chn::sck::add_noise_is::Y_N] : chn[chn::sck::add_noise::Y_N];
+
     if (is_rayleigh)
     {
         if (this->params_BFER_std.chn->type == "NO")
@@ -282,26 +395,26 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
     }
     else if (is_optical)
     {
-        chn[chn::sck::add_noise ::CP] = this->channel_params;
+        chn_CP = this->channel_params;
         mdm[mdm::sck::demodulate_wg::CP] = this->channel_params;
-        chn[chn::sck::add_noise ::X_N] = mdm[mdm::sck::modulate ::X_N2];
+        chn_X_N = mdm[mdm::sck::modulate ::X_N2];
         mdm[mdm::sck::demodulate_wg::H_N] = mdm[mdm::sck::modulate ::X_N2];
-        mdm[mdm::sck::demodulate_wg::Y_N1] = chn[chn::sck::add_noise::Y_N];
+        mdm[mdm::sck::demodulate_wg::Y_N1] = chn_Y_N;
         if (this->params_BFER_std.qnt->type != "NO") qnt[qnt::sck::process::Y_N1] = mdm[mdm::sck::demodulate_wg::Y_N2];
     }
     else
     {
         if (this->params_BFER_std.chn->type != "NO")
         {
-            chn[chn::sck::add_noise::CP] = this->channel_params;
-            chn[chn::sck::add_noise::X_N] = mdm[mdm::sck::modulate::X_N2];
+            chn_CP = this->channel_params;
+            chn_X_N = mdm[mdm::sck::modulate::X_N2];
         }
 
         if (mdm.is_filter())
         {
             mdm[mdm::sck::filter::CP] = this->channel_params;
             if (this->params_BFER_std.chn->type != "NO")
-                mdm[mdm::sck::filter::Y_N1] = chn[chn::sck::add_noise::Y_N];
+                mdm[mdm::sck::filter::Y_N1] = chn_Y_N;
             else
                 mdm[mdm::sck::filter::Y_N1] = mdm[mdm::sck::modulate::X_N2];
         }
@@ -312,7 +425,7 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
             if (mdm.is_filter())
                 mdm[mdm::sck::demodulate::Y_N1] = mdm[mdm::sck::filter::Y_N2];
             else if (this->params_BFER_std.chn->type != "NO")
-                mdm[mdm::sck::demodulate::Y_N1] = chn[chn::sck::add_noise::Y_N];
+                mdm[mdm::sck::demodulate::Y_N1] = chn_Y_N;
             else
                 mdm[mdm::sck::demodulate::Y_N1] = mdm[mdm::sck::modulate::X_N2];
         }
@@ -324,7 +437,7 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
             else if (mdm.is_filter())
                 qnt[qnt::sck::process::Y_N1] = mdm[mdm::sck::filter::Y_N2];
             else if (this->params_BFER_std.chn->type != "NO")
-                qnt[qnt::sck::process::Y_N1] = chn[chn::sck::add_noise::Y_N];
+                qnt[qnt::sck::process::Y_N1] = chn_Y_N;
             else
                 qnt[qnt::sck::process::Y_N1] = mdm[mdm::sck::modulate::X_N2];
         }
@@ -348,7 +461,7 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
             if (is_rayleigh)
                 pct[pct::sck::depuncture::Y_N1] = chn[chn::sck::add_noise_wg::Y_N];
             else
-                pct[pct::sck::depuncture::Y_N1] = chn[chn::sck::add_noise::Y_N];
+                pct[pct::sck::depuncture::Y_N1] = chn_Y_N;
         }
         else
             pct[pct::sck::depuncture::Y_N1] = mdm[mdm::sck::modulate::X_N2];
@@ -381,7 +494,7 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
             if (is_rayleigh)
                 csr[cst::sck::apply::in] = chn[chn::sck::add_noise_wg::Y_N];
             else
-                csr[cst::sck::apply::in] = chn[chn::sck::add_noise::Y_N];
+                csr[cst::sck::apply::in] = chn_Y_N;
         }
         else
             csr[cst::sck::apply::in] = mdm[mdm::sck::modulate::X_N2];
@@ -435,7 +548,7 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
                 if (is_rayleigh)
                     dec[dec::sck::decode_siho_cw::Y_N] = chn[chn::sck::add_noise_wg::Y_N];
                 else
-                    dec[dec::sck::decode_siho_cw::Y_N] = chn[chn::sck::add_noise::Y_N];
+                    dec[dec::sck::decode_siho_cw::Y_N] = chn_Y_N;
             }
             else
                 dec[dec::sck::decode_siho_cw::Y_N] = mdm[mdm::sck::modulate::X_N2];
@@ -460,7 +573,7 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
                 if (is_rayleigh)
                     dec[dec::sck::decode_siho::Y_N] = chn[chn::sck::add_noise_wg::Y_N];
                 else
-                    dec[dec::sck::decode_siho::Y_N] = chn[chn::sck::add_noise::Y_N];
+                    dec[dec::sck::decode_siho::Y_N] = chn_Y_N;
             }
             else
                 dec[dec::sck::decode_siho::Y_N] = mdm[mdm::sck::modulate::X_N2];
@@ -469,43 +582,82 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
         }
     }
 
-    if (this->params_BFER_std.coded_monitoring)
+    auto& mnt_U = importance_sampling ? mnt[mnt::sck::check_errors_is::U] : mnt[mnt::sck::check_errors::U];
+    auto& mnt_V = importance_sampling ? mnt[mnt::sck::check_errors_is::V] : mnt[mnt::sck::check_errors::V];
+    if (importance_sampling) mnt[mnt::sck::check_errors_is::LW] = chn[chn::sck::add_noise_is::LW];
+
+    if (this->params_BFER_std.packed)
+    {
+        // the monitor compares the packed references with the packed decoded bits
+        auto& pkv = *this->packer_V;
+
+        if (this->params_BFER_std.coded_monitoring)
+        {
+            if (this->params_BFER_std.cdc->enc->type != "NO")
+                mnt[mnt::sck::check_errors_packed::U] = enc[enc::sck::encode_packed::X_N];
+            else if (this->params_BFER_std.crc->type != "NO")
+                mnt[mnt::sck::check_errors_packed::U] = crc[crc::sck::build_packed::U_K2];
+            else
+                mnt[mnt::sck::check_errors_packed::U] = src[spu::module::src::sck::generate::out_data];
+
+            pkv[pkr::sck::pack::in] = dec[dec::sck::decode_siho_cw::V_N];
+        }
+        else
+        {
+            mnt[mnt::sck::check_errors_packed::U] = src[spu::module::src::sck::generate::out_data];
+
+            if (this->params_BFER_std.crc->type != "NO")
+                pkv[pkr::sck::pack::in] = crc[crc::sck::extract::V_K2];
+            else
+                pkv[pkr::sck::pack::in] = dec[dec::sck::decode_siho::V_K];
+        }
+
+        mnt[mnt::sck::check_errors_packed::V] = pkv[pkr::sck::pack::out];
+    }
+    else if (this->params_BFER_std.coded_monitoring)
     {
         if (this->params_BFER_std.src->type == "AZCW")
-            mnt[mnt::sck::check_errors::U] = enc[enc::sck::encode::X_N].get_dataptr();
+            mnt_U = enc[enc::sck::encode::X_N].get_dataptr();
         else
         {
             if (this->params_BFER_std.cdc->enc->type != "NO")
-                mnt[mnt::sck::check_errors::U] = enc[enc::sck::encode::X_N];
+                mnt_U = enc[enc::sck::encode::X_N];
             else if (this->params_BFER_std.crc->type != "NO")
-                mnt[mnt::sck::check_errors::U] = crc[crc::sck::build::U_K2];
+                mnt_U = crc[crc::sck::build::U_K2];
             else
-                mnt[mnt::sck::check_errors::U] = src[spu::module::src::sck::generate::out_data];
+                mnt_U = src[spu::module::src::sck::generate::out_data];
         }
 
         if (this->params_BFER_std.coset)
-            mnt[mnt::sck::check_errors::V] = csb[cst::sck::apply::out];
+            mnt_V = csb[cst::sck::apply::out];
         else
-            mnt[mnt::sck::check_errors::V] = dec[dec::sck::decode_siho_cw::V_N];
+            mnt_V = dec[dec::sck::decode_siho_cw::V_N];
     }
     else
     {
         if (this->params_BFER_std.src->type == "AZCW")
-            mnt[mnt::sck::check_errors::U] = enc[enc::sck::encode::X_N].get_dataptr();
+            mnt_U = enc[enc::sck::encode::X_N].get_dataptr();
         else
-            mnt[mnt::sck::check_errors::U] = src[spu::module::src::sck::generate::out_data];
+            mnt_U = src[spu::module::src::sck::generate::out_data];
         if (this->params_BFER_std.crc->type != "NO")
-            mnt[mnt::sck::check_errors::V] = crc[crc::sck::extract::V_K2];
+            mnt_V = crc[crc::sck::extract::V_K2];
         else if (this->params_BFER_std.coset)
-            mnt[mnt::sck::check_errors::V] = csb[cst::sck::apply::out];
+            mnt_V = csb[cst::sck::apply::out];
         else
-            mnt[mnt::sck::check_errors::V] = dec[dec::sck::decode_siho::V_K];
+            mnt_V = dec[dec::sck::decode_siho::V_K];
     }
 
     if (this->params_BFER_std.mnt_mutinfo)
     {
         if (this->params_BFER_std.src->type == "AZCW")
             mni[mnt::sck::get_mutual_info::X] = enc[enc::sck::encode::X_N].get_dataptr();
+        else if (this->params_BFER_std.packed)
+        {
+            if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
+                mni[mnt::sck::get_mutual_info::X] = pct[pct::sck::puncture::X_N2];
+            else
+                mni[mnt::sck::get_mutual_info::X] = (*this->packer_X)[pkr::sck::unpack::out];
+        }
         else
         {
             if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
@@ -532,6 +684,125 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
         else
             mni[mnt::sck::get_mutual_info::Y] = mdm[mdm::sck::modulate::X_N2];
     }
+
+    if (this->params_BFER_std.pipeline)
+    {
+        auto& lat0 = *this->monitor_lat[0];
+        auto& lat1 = *this->monitor_lat[1];
+        auto& lat2 = *this->monitor_lat[2];
+
+        lat1[mnt::sck::measure::TS_in] = lat0[mnt::sck::stamp::TS];
+        lat2[mnt::sck::measure::TS_in] = lat1[mnt::sck::measure::TS_out];
+    }
+}
+
+template<typename B, typename R, typename Q>
+void
+Simulation_BFER_std<B, R, Q>::create_pipeline()
+{
+    using namespace module;
+    using stage_t = std::tuple<std::vector<spu::runtime::Task*>,  // first tasks
+                               std::vector<spu::runtime::Task*>,  // last tasks
+                               std::vector<spu::runtime::Task*>>; // excluded tasks
+
+    auto& src = *this->source;
+    auto& crc = *this->crc;
+    auto& pct = this->codec->get_puncturer();
+    auto& mdm = *this->modem;
+    auto& chn = *this->channel;
+    auto& qnt = *this->quantizer;
+    auto& csr = *this->coset_real;
+    auto& dec = this->codec->get_decoder_siho();
+    auto& csb = *this->coset_bit;
+    auto& mnt = *this->monitor_er;
+    auto& lat0 = *this->monitor_lat[0];
+    auto& lat1 = *this->monitor_lat[1];
+    auto& lat2 = *this->monitor_lat[2];
+
+    const auto is_rayleigh = this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos;
+    const auto is_optical = this->params_BFER_std.chn->type == "OPTICAL" && this->params_BFER_std.mdm->rop_est_bits > 0;
+    const auto importance_sampling = this->params_BFER_std.chn->is_bias != "NONE";
+    const auto is_puncturer = this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO";
+
+    // stage 1: the transmitter, from the source to the channel
+    auto& chn_tsk = is_rayleigh           ? chn[chn::tsk::add_noise_wg]
+                    : importance_sampling ? chn[chn::tsk::add_noise_is]
+                                          : chn[chn::tsk::add_noise];
+    auto& first = this->params_BFER_std.src->type != "AZCW" ? src[spu::module::src::tsk::generate] : chn_tsk;
+
+    // stage 2: the receiver, from the demodulator to the decoder (and the CRC extraction)
+    spu::runtime::Task* rx_first;
+    if (mdm.is_filter())
+        rx_first = &mdm[mdm::tsk::filter];
+    else if (mdm.is_demodulator() || is_optical)
+        rx_first = is_rayleigh || is_optical ? &mdm[mdm::tsk::demodulate_wg] : &mdm[mdm::tsk::demodulate];
+    else if (this->params_BFER_std.qnt->type != "NO")
+        rx_first = &qnt[qnt::tsk::process];
+    else if (is_puncturer)
+        rx_first = &pct[pct::tsk::depuncture];
+    else if (this->params_BFER_std.coset)
+        rx_first = &csr[cst::tsk::apply];
+    else
+        rx_first = this->params_BFER_std.coded_monitoring ? &dec[dec::tsk::decode_siho_cw] : &dec[dec::tsk::decode_siho];
+
+    spu::runtime::Task* rx_last;
+    if (this->params_BFER_std.packed)
+        rx_last = &(*this->packer_V)[pkr::tsk::pack];
+    else if (this->params_BFER_std.coded_monitoring)
+        rx_last = this->params_BFER_std.coset ? &csb[cst::tsk::apply] : &dec[dec::tsk::decode_siho_cw];
+    else if (this->params_BFER_std.crc->type != "NO")
+        rx_last = &crc[crc::tsk::extract];
+    else if (this->params_BFER_std.coset)
+        rx_last = &csb[cst::tsk::apply];
+    else
+        rx_last = &dec[dec::tsk::decode_siho];
+
+    // stage 3: the monitors
+    auto& mnt_tsk = importance_sampling            ? mnt[mnt::tsk::check_errors_is]
+                    : this->params_BFER_std.packed ? mnt[mnt::tsk::check_errors_packed]
+                                                   : mnt[mnt::tsk::check_errors];
+    std::vector<spu::runtime::Task*> mnt_firsts = { &mnt_tsk, &lat2[mnt::tsk::measure] };
+    if (this->params_BFER_std.mnt_mutinfo) mnt_firsts.push_back(&(*this->monitor_mi)[mnt::tsk::get_mutual_info]);
+
+    std::vector<stage_t> stages;
+    stages.push_back(stage_t({ &first, &lat0[mnt::tsk::stamp] }, { &chn_tsk }, {}));
+    stages.push_back(stage_t({ rx_first, &lat1[mnt::tsk::measure] }, { rx_last }, {}));
+    stages.push_back(stage_t(mnt_firsts, {}, {}));
+
+    const auto& thr = this->params_BFER_std.pipeline_threads;
+    const std::vector<size_t> n_threads = { (size_t)thr[0], (size_t)thr[1], (size_t)thr[2] };
+    const size_t buf = (size_t)this->params_BFER_std.pipeline_buffer;
+
+    // pin each thread on its own core when there are enough cores
+    const size_t n_cores = std::thread::hardware_concurrency();
+    const bool pinning = n_cores >= n_threads[0] + n_threads[1] + n_threads[2];
+    std::vector<std::vector<size_t>> puids(3);
+    size_t puid = 0;
+    for (size_t s = 0; s < 3 && pinning; s++)
+        for (size_t t = 0; t < n_threads[s]; t++)
+            puids[s].push_back(puid++);
+
+    this->pipeline.reset(new spu::runtime::Pipeline(
+      first, stages, n_threads, { buf, buf }, { false, false }, { pinning, pinning, pinning }, puids));
+}
+
+template<typename B, typename R, typename Q>
+void
+Simulation_BFER_std<B, R, Q>::set_seeds()
+{
+    // set different seeds in the modules that uses PRNG
+    std::mt19937 prng(this->get_local_seed());
+    for (auto& m : this->template get_modules<spu::tools::Interface_set_seed>())
+        m->set_seed(prng());
+
+    // the counter-based noise is keyed by the simulation seed in all the channel replicas, each replica stamps the
+    // frames with their global index (the replicas take the blocks of frames in a round robin order)
+    auto channels = this->template get_modules<module::Channel<R>>();
+    for (size_t r = 0; r < channels.size(); r++)
+    {
+        if (this->params_BFER_std.chn->implem == "PHILOX") channels[r]->set_seed(this->get_local_seed());
+        channels[r]->set_replica(r, channels.size());
+    }
 }
 
 template<typename B, typename R, typename Q>
@@ -541,12 +812,16 @@ Simulation_BFER_std<B, R, Q>::create_sequence()
     const auto is_rayleigh = this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos;
     const auto is_optical = this->params_BFER_std.chn->type == "OPTICAL" && this->params_BFER_std.mdm->rop_est_bits > 0;
     const auto t = this->params_BFER.n_threads;
-    if (this->params_BFER_std.src->type != "AZCW")
+    if (this->params_BFER_std.pipeline)
+        this->create_pipeline();
+    else if (this->params_BFER_std.src->type != "AZCW")
         this->sequence.reset(new spu::runtime::Sequence((*this->source)[spu::module::src::tsk::generate], t));
     else if (this->params_BFER_std.chn->type != "NO")
     {
         if (is_rayleigh)
             this->sequence.reset(new spu::runtime::Sequence((*this->channel)[module::chn::tsk::add_noise_wg], t));
+        else if (this->params_BFER_std.chn->is_bias != "NONE")
+            this->sequence.reset(new spu::runtime::Sequence((*this->channel)[module::chn::tsk::add_noise_is], t));
         else
             this->sequence.reset(new spu::runtime::Sequence((*this->channel)[module::chn::tsk::add_noise], t));
     }
@@ -571,20 +846,17 @@ Simulation_BFER_std<B, R, Q>::create_sequence()
 
     // set the noise
     this->codec->set_noise(*this->noise);
-    for (auto& m : this->sequence->template get_modules<tools::Interface_get_set_noise>())
+    for (auto& m : this->template get_modules<tools::Interface_get_set_noise>())
         m->set_noise(*this->noise);
 
     // registering to noise updates
     this->noise->record_callback_update([this]() { this->codec->notify_noise_update(); });
-    for (auto& m : this->sequence->template get_modules<tools::Interface_notify_noise_update>())
+    for (auto& m : this->template get_modules<tools::Interface_notify_noise_update>())
         this->noise->record_callback_update([m]() { m->notify_noise_update(); });
 
-    // set different seeds in the modules that uses PRNG
-    std::mt19937 prng(params_BFER_std.local_seed);
-    for (auto& m : this->sequence->template get_modules<spu::tools::Interface_set_seed>())
-        m->set_seed(prng());
+    this->set_seeds();
 
-    auto fb_modules = this->sequence->template get_modules<tools::Interface_get_set_frozen_bits>();
+    auto fb_modules = this->template get_modules<tools::Interface_get_set_frozen_bits>();
     if (fb_modules.size())
     {
         this->noise->record_callback_update(
@@ -613,7 +885,7 @@ Simulation_BFER_std<B, R, Q>::create_sequence()
 
     if (this->params_BFER_std.err_track_enable)
     {
-        auto sources = this->sequence->template get_modules<spu::module::Source<B>>();
+        auto sources = this->template get_modules<spu::module::Source<B>>();
         for (size_t tid = 0; tid < (size_t)this->params_BFER.n_threads; tid++)
         {
             auto& source = sources.size() ? *sources[tid] : *this->source;
@@ -629,7 +901,7 @@ Simulation_BFER_std<B, R, Q>::create_sequence()
                                              {});
         }
 
-        auto encoders = this->sequence->template get_modules<module::Encoder<B>>();
+        auto encoders = this->template get_modules<module::Encoder<B>>();
         for (size_t tid = 0; tid < (size_t)this->params_BFER.n_threads; tid++)
         {
             auto& encoder = encoders.size() ? *encoders[tid] : this->codec->get_encoder();
@@ -645,7 +917,7 @@ Simulation_BFER_std<B, R, Q>::create_sequence()
                                              { (unsigned)this->params_BFER_std.cdc->enc->K });
         }
 
-        auto channels = this->sequence->template get_modules<module::Channel<R>>();
+        auto channels = this->template get_modules<module::Channel<R>>();
         for (size_t tid = 0; tid < (size_t)this->params_BFER.n_threads; tid++)
         {
             auto& channel = channels.size() ? *channels[tid] : *this->channel;
@@ -657,7 +929,7 @@ Simulation_BFER_std<B, R, Q>::create_sequence()
                                              {});
         }
 
-        auto monitors_er = this->sequence->template get_modules<module::Monitor_BFER<B>>();
+        auto monitors_er = this->template get_modules<module::Monitor_BFER<B>>();
         for (size_t tid = 0; tid < (size_t)this->params_BFER.n_threads; tid++)
         {
             monitors_er[tid]->record_callback_fe(
@@ -666,6 +938,13 @@ Simulation_BFER_std<B, R, Q>::create_sequence()
     }
 }
 
+template<typename B, typename R, typename Q>
+Simulation_BFER<B, R>*
+Simulation_BFER_std<B, R, Q>::build_sub_simulation(const factory::BFER& sub_params) const
+{
+    return new Simulation_BFER_std<B, R, Q>(dynamic_cast<const factory::BFER_std&>(sub_params));
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -9,6 +9,7 @@
 #include "Module/Channel/Channel.hpp"
 #include "Module/Coset/Coset.hpp"
 #include "Module/Modem/Modem.hpp"
+#include "Module/Packer/Packer.hpp"
 #include "Module/Quantizer/Quantizer.hpp"
 #include "Simulation/BFER/Simulation_BFER.hpp"
 #include "Tools/Codec/Codec_SIHO.hpp"
@@ -35,6 +36,8 @@ class Simulation_BFER_std : public Simulation_BFER<B, R>
     std::unique_ptr<module::Quantizer<R, Q>> quantizer;
     std::unique_ptr<module::Coset<B, Q>> coset_real;
     std::unique_ptr<module::Coset<B, B>> coset_bit;
+    std::unique_ptr<module::Packer<B>> packer_X; // unpacks the codewords for the modulation (packed bits only)
+    std::unique_ptr<module::Packer<B>> packer_V; // packs the decoded bits for the monitor (packed bits only)
 
   public:
     explicit Simulation_BFER_std(const factory::BFER_std& params_BFER_std);
@@ -50,10 +53,15 @@ class Simulation_BFER_std : public Simulation_BFER<B, R>
     std::unique_ptr<module::Quantizer<R, Q>> build_quantizer();
     std::unique_ptr<module::Coset<B, Q>> build_coset_real();
     std::unique_ptr<module::Coset<B, B>> build_coset_bit();
+    std::unique_ptr<module::Packer<B>> build_packer(const int size);
 
     virtual void create_modules();
     virtual void bind_sockets();
     virtual void create_sequence();
+    virtual void set_seeds();
+    void create_pipeline();
+
+    virtual Simulation_BFER<B, R>* build_sub_simulation(const factory::BFER& sub_params) const;
 };
 
 }
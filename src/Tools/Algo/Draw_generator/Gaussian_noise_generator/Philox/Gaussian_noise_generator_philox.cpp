@@ -0,0 +1,239 @@
+#include <cmath>
+#include <cstring>
+#include <mipp.h>
+#include <streampu.hpp>
+
+#include "Tools/Algo/Draw_generator/Gaussian_noise_generator/Philox/Gaussian_noise_generator_philox.hpp"
+
+using namespace aff3ct::tools;
+
+template<typename R>
+Gaussian_noise_generator_philox<R>::Gaussian_noise_generator_philox(const int seed)
+  : Gaussian_noise_generator<R>()
+  , next_frame(0)
+  , lanes(mipp::N<int32_t>())
+{
+    for (auto i = 0; i < mipp::N<int32_t>(); i++)
+        lanes[i] = i;
+
+    this->set_seed(seed);
+}
+
+template<typename R>
+Gaussian_noise_generator_philox<R>*
+Gaussian_noise_generator_philox<R>::clone() const
+{
+    return new Gaussian_noise_generator_philox(*this);
+}
+
+template<typename R>
+void
+Gaussian_noise_generator_philox<R>::set_seed(const int seed)
+{
+    this->philox.seed((uint64_t)(uint32_t)seed);
+    this->next_frame = 0;
+}
+
+template<typename R>
+void
+Gaussian_noise_generator_philox<R>::draw_words(const size_t n_blocks, const uint64_t frame_idx)
+{
+    // the block 'b' of the frame 'f' is the Philox counter (b, 0, f_low, f_high)
+    words.resize(4 * n_blocks);
+
+    const mipp::Reg<int32_t> r_lanes = &lanes[0];
+    mipp::Reg<int32_t> ctr[4], out[4];
+    ctr[1] = (int32_t)0;
+    ctr[2] = (int32_t)(uint32_t)frame_idx;
+    ctr[3] = (int32_t)(uint32_t)(frame_idx >> 32);
+
+    for (size_t b = 0; b < n_blocks; b += mipp::N<int32_t>())
+    {
+        ctr[0] = r_lanes + mipp::Reg<int32_t>((int32_t)b);
+        this->philox.generate(ctr, out);
+
+        for (auto w = 0; w < 4; w++)
+            out[w].store(&words[w * n_blocks + b]);
+    }
+}
+
+template<typename R>
+size_t
+Gaussian_noise_generator_philox<R>::draw_uniforms(const unsigned /*n_pairs*/, const uint64_t /*frame_idx*/)
+{
+    throw spu::tools::runtime_error(
+      __FILE__, __LINE__, __func__, "The Philox random generator does not support this type.");
+}
+
+namespace aff3ct
+{
+namespace tools
+{
+template<>
+size_t
+Gaussian_noise_generator_philox<float>::draw_uniforms(const unsigned n_pairs, const uint64_t frame_idx)
+{
+    // 16 blocks give the uniform numbers of 32 pairs: the pair '32g + 16h + j' is made of the words '2h' and '2h +1'
+    // of the block '16g + j' (this mapping does not depend on the SIMD width)
+    const size_t n_groups = (n_pairs + 31) / 32;
+    const size_t n_blocks = n_groups * 16;
+    const size_t n_pairs_pad = n_groups * 32;
+
+    this->draw_words(n_blocks, frame_idx);
+
+    u1.resize(n_pairs_pad);
+    u2.resize(n_pairs_pad);
+
+    // 23 random bits in ]0,1[
+    const mipp::Reg<int32_t> r_mask = (int32_t)0x007FFFFF;
+    const mipp::Reg<float> r_half = 0.5f;
+    const mipp::Reg<float> r_scale = 1.f / 8388608.f;
+
+    for (size_t g = 0; g < n_groups; g++)
+        for (size_t h = 0; h < 2; h++)
+            for (size_t j = 0; j < 16; j += mipp::N<int32_t>())
+            {
+                const auto b = 16 * g + j;
+                const auto p = 32 * g + 16 * h + j;
+
+                const mipp::Reg<int32_t> r_w1 = &words[(2 * h + 0) * n_blocks + b];
+                const mipp::Reg<int32_t> r_w2 = &words[(2 * h + 1) * n_blocks + b];
+
+                const auto r_u1 = (mipp::cvt<int32_t, float>((r_w1 >> 9) & r_mask) + r_half) * r_scale;
+                const auto r_u2 = (mipp::cvt<int32_t, float>((r_w2 >> 9) & r_mask) + r_half) * r_scale;
+
+                r_u1.store(&u1[p]);
+                r_u2.store(&u2[p]);
+            }
+
+    return n_pairs_pad;
+}
+}
+}
+
+namespace aff3ct
+{
+namespace tools
+{
+template<>
+size_t
+Gaussian_noise_generator_philox<double>::draw_uniforms(const unsigned n_pairs, const uint64_t frame_idx)
+{
+    // the pair 'p' is made of the block 'p': the words 0 and 1 give the first uniform number, the words 2 and 3 give
+    // the second one
+    const size_t n_blocks = ((n_pairs + 15) / 16) * 16;
+
+    this->draw_words(n_blocks, frame_idx);
+
+    u1.resize(n_blocks);
+    u2.resize(n_blocks);
+
+    // 52 random bits (the 20 low bits of the first word and the second word) are put in the mantissa of a double in
+    // [1,2[, then (1 - 2^-53) is subtracted to get (bits + 0.5) * 2^-52 in ]0,1[ (exact computations)
+    const int32_t exp_mask = 0x000FFFFF;
+    const int32_t exp_one = 0x3FF00000;
+    const double offset = 1. - 1. / 9007199254740992.;
+
+    size_t p = 0;
+    if (mipp::N<int32_t>() == 2 * mipp::N<double>())
+    {
+        const mipp::Reg<int32_t> r_mask = exp_mask;
+        const mipp::Reg<int32_t> r_one = exp_one;
+        const mipp::Reg<double> r_offset = offset;
+
+        for (; p < n_blocks; p += mipp::N<int32_t>())
+            for (auto u = 0; u < 2; u++)
+            {
+                const mipp::Reg<int32_t> r_hi = &words[(2 * u + 0) * n_blocks + p];
+                const mipp::Reg<int32_t> r_lo = &words[(2 * u + 1) * n_blocks + p];
+
+                // the little endian 64-bit lanes are made of the (low, high) 32-bit lanes
+                const auto r_u = mipp::interleave<int32_t>(r_lo, (r_hi & r_mask) | r_one);
+                auto out = u == 0 ? &u1[p] : &u2[p];
+                (mipp::cast<int32_t, double>(r_u.val[0]) - r_offset).store(out);
+                (mipp::cast<int32_t, double>(r_u.val[1]) - r_offset).store(out + mipp::N<double>());
+            }
+    }
+
+    for (; p < n_blocks; p++)
+    {
+        uint64_t bits[2];
+        for (auto u = 0; u < 2; u++)
+            bits[u] = ((uint64_t)(((uint32_t)words[(2 * u + 0) * n_blocks + p] & exp_mask) | exp_one) << 32) |
+                      (uint64_t)(uint32_t)words[(2 * u + 1) * n_blocks + p];
+
+        double d[2];
+        std::memcpy(d, bits, sizeof(d));
+        u1[p] = d[0] - offset;
+        u2[p] = d[1] - offset;
+    }
+
+    return n_blocks;
+}
+}
+}
+
+template<typename R>
+void
+Gaussian_noise_generator_philox<R>::generate(R* noise, const unsigned length, const R sigma, const R mu)
+{
+    this->generate(noise, length, sigma, mu, this->next_frame);
+}
+
+template<typename R>
+void
+Gaussian_noise_generator_philox<R>::generate(R* noise,
+                                             const unsigned length,
+                                             const R sigma,
+                                             const R mu,
+                                             const uint64_t frame_idx)
+{
+    this->next_frame = frame_idx + 1;
+
+    const unsigned n_pairs = (length + 1) / 2;
+    const auto n_pairs_pad = this->draw_uniforms(n_pairs, frame_idx);
+
+    gcos.resize(n_pairs_pad);
+    gsin.resize(n_pairs_pad);
+
+    const auto twopi = (R)(2.0 * 3.14159265358979323846);
+
+    // SIMD version of the Box Muller method in the polar form (the padded pairs are always computed with SIMD
+    // instructions to get the same values whatever the frame length)
+    for (size_t p = 0; p < n_pairs_pad; p += mipp::N<R>())
+    {
+        const mipp::Reg<R> r_u1 = &u1[p];
+        const mipp::Reg<R> r_u2 = &u2[p];
+
+        const auto radius = mipp::sqrt(mipp::log(r_u1) * (R)-2.0) * sigma;
+        const auto theta = r_u2 * twopi;
+
+        mipp::Reg<R> sintheta, costheta;
+        mipp::sincos(theta, sintheta, costheta);
+
+        auto awgn1 = radius * costheta + mu;
+        auto awgn2 = radius * sintheta + mu;
+
+        awgn1.store(&gcos[p]);
+        awgn2.store(&gsin[p]);
+    }
+
+    for (unsigned p = 0; p < length / 2; p++)
+    {
+        noise[2 * p + 0] = gcos[p];
+        noise[2 * p + 1] = gsin[p];
+    }
+
+    // distribute the last odd element
+    if (length % 2) noise[length - 1] = gcos[n_pairs - 1];
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::tools::Gaussian_noise_generator_philox<R_32>;
+template class aff3ct::tools::Gaussian_noise_generator_philox<R_64>;
+#else
+template class aff3ct::tools::Gaussian_noise_generator_philox<R>;
+#endif
+// ==================================================================================== explicit template instantiation
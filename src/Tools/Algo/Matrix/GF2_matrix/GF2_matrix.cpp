@@ -0,0 +1,147 @@
+#include <numeric>
+#include <streampu.hpp>
+#include <utility>
+
+#include "Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+constexpr size_t GF2_matrix::word_size;
+
+GF2_matrix ::GF2_matrix(const size_t n_rows, const size_t n_cols)
+  : Matrix(n_rows, n_cols)
+  , n_words((n_cols + word_size - 1) / word_size)
+  , words(n_rows * n_words, 0)
+  , rows(n_rows)
+{
+    std::iota(this->rows.begin(), this->rows.end(), 0);
+}
+
+GF2_matrix ::GF2_matrix(const Sparse_matrix& matrix)
+  : GF2_matrix(matrix.get_n_rows(), matrix.get_n_cols())
+{
+    for (size_t r = 0; r < matrix.get_n_rows(); r++)
+    {
+        auto row = this->get_row(r);
+        for (auto c : matrix.get_cols_from_row(r))
+            row[c / word_size] |= (Word)1 << (c % word_size);
+    }
+}
+
+void
+GF2_matrix ::swap_rows(const size_t row_index1, const size_t row_index2)
+{
+    std::swap(this->rows[row_index1], this->rows[row_index2]);
+}
+
+void
+GF2_matrix ::swap_cols(const size_t col_index1, const size_t col_index2)
+{
+    const auto w1 = col_index1 / word_size, o1 = col_index1 % word_size;
+    const auto w2 = col_index2 / word_size, o2 = col_index2 % word_size;
+
+    for (size_t r = 0; r < this->get_n_rows(); r++)
+    {
+        auto row = this->get_row(r);
+        const auto b1 = (row[w1] >> o1) & 1;
+        const auto b2 = (row[w2] >> o2) & 1;
+        if (b1 != b2)
+        {
+            row[w1] ^= (Word)1 << o1;
+            row[w2] ^= (Word)1 << o2;
+        }
+    }
+}
+
+void
+GF2_matrix ::erase_row(const size_t row_index)
+{
+    this->check_indexes(row_index, 0);
+
+    this->rows.erase(this->rows.begin() + row_index);
+    Matrix::self_resize(this->get_n_rows() - 1, this->get_n_cols());
+}
+
+bool
+GF2_matrix ::at(const size_t row_index, const size_t col_index) const
+{
+    this->check_indexes(row_index, col_index);
+
+    return this->get(row_index, col_index);
+}
+
+void
+GF2_matrix ::add_connection(const size_t row_index, const size_t col_index)
+{
+    this->check_indexes(row_index, col_index);
+
+    this->get_row(row_index)[col_index / word_size] |= (Word)1 << (col_index % word_size);
+}
+
+void
+GF2_matrix ::rm_connection(const size_t row_index, const size_t col_index)
+{
+    this->check_indexes(row_index, col_index);
+
+    this->get_row(row_index)[col_index / word_size] &= ~((Word)1 << (col_index % word_size));
+}
+
+void
+GF2_matrix ::self_resize(const size_t n_rows, const size_t n_cols, Origin o)
+{
+    throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
+}
+
+void
+GF2_matrix ::self_transpose()
+{
+    throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
+}
+
+void
+GF2_matrix ::sort_cols_per_density(Sort order)
+{
+    throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
+}
+
+void
+GF2_matrix ::print(bool transpose, std::ostream& os) const
+{
+    if (transpose)
+    {
+        for (size_t c = 0; c < this->get_n_cols(); c++)
+        {
+            for (size_t r = 0; r < this->get_n_rows(); r++)
+                os << this->get(r, c) << " ";
+            os << std::endl;
+        }
+    }
+    else
+    {
+        for (size_t r = 0; r < this->get_n_rows(); r++)
+        {
+            for (size_t c = 0; c < this->get_n_cols(); c++)
+                os << this->get(r, c) << " ";
+            os << std::endl;
+        }
+    }
+}
+
+Sparse_matrix
+GF2_matrix ::to_sparse_matrix() const
+{
+    Sparse_matrix matrix(this->get_n_rows(), this->get_n_cols());
+
+    // the connections are unique by construction, 'add_connection' would look for each of them in its row
+    for (size_t r = 0; r < this->get_n_rows(); r++)
+        for (auto c = this->find_first(r); c < this->get_n_cols(); c = this->find_first(r, c + 1))
+        {
+            matrix.row_to_cols[r].push_back((Sparse_matrix::Idx_t)c);
+            matrix.col_to_rows[c].push_back((Sparse_matrix::Idx_t)r);
+        }
+
+    if (this->get_n_rows()) matrix.parse_connections();
+
+    return matrix;
+}
@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <sstream>
+#include <streampu.hpp>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Sparse_matrix_CSR::Slice ::Slice(const Idx_t* first, const Idx_t* last)
+  : first(first)
+  , last(last)
+{
+}
+
+const Sparse_matrix_CSR::Idx_t&
+Sparse_matrix_CSR::Slice ::at(const size_t i) const
+{
+    if (i >= this->size())
+    {
+        std::stringstream message;
+        message << "'i' has to be smaller than 'size()' ('i' = " << i << ", 'size()' = " << this->size() << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    return this->first[i];
+}
+
+Sparse_matrix_CSR ::Sparse_matrix_CSR(const size_t n_rows, const size_t n_cols)
+  : Matrix(n_rows, n_cols)
+  , row_offsets(n_rows + 1, 0)
+  , col_offsets(n_cols + 1, 0)
+{
+}
+
+Sparse_matrix_CSR ::Sparse_matrix_CSR(const Sparse_matrix& matrix)
+  : Matrix(matrix.get_n_rows(), matrix.get_n_cols())
+  , row_offsets(matrix.get_n_rows() + 1, 0)
+  , col_offsets(matrix.get_n_cols() + 1, 0)
+{
+    this->rows_max_degree = matrix.get_rows_max_degree();
+    this->cols_max_degree = matrix.get_cols_max_degree();
+    this->n_connections = matrix.get_n_connections();
+
+    this->row_indices.reserve(this->n_connections);
+    for (size_t r = 0; r < matrix.get_n_rows(); r++)
+    {
+        const auto& cols = matrix.get_cols_from_row(r);
+        this->row_indices.insert(this->row_indices.end(), cols.begin(), cols.end());
+        this->row_offsets[r + 1] = (Idx_t)this->row_indices.size();
+    }
+
+    this->col_indices.reserve(this->n_connections);
+    for (size_t c = 0; c < matrix.get_n_cols(); c++)
+    {
+        const auto& rows = matrix.get_rows_from_col(c);
+        this->col_indices.insert(this->col_indices.end(), rows.begin(), rows.end());
+        this->col_offsets[c + 1] = (Idx_t)this->col_indices.size();
+    }
+}
+
+bool
+Sparse_matrix_CSR ::at(const size_t row_index, const size_t col_index) const
+{
+    const auto cols = this->get_cols_from_row(row_index);
+    return std::find(cols.begin(), cols.end(), (Idx_t)col_index) != cols.end();
+}
+
+void
+Sparse_matrix_CSR ::add_connection(const size_t row_index, const size_t col_index)
+{
+    throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
+}
+
+void
+Sparse_matrix_CSR ::rm_connection(const size_t row_index, const size_t col_index)
+{
+    throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
+}
+
+void
+Sparse_matrix_CSR ::self_resize(const size_t n_rows, const size_t n_cols, Origin o)
+{
+    throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
+}
+
+void
+Sparse_matrix_CSR ::sort_cols_per_density(Sort order)
+{
+    throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
+}
+
+void
+Sparse_matrix_CSR ::self_transpose()
+{
+    Matrix::self_transpose();
+
+    std::swap(row_offsets, col_offsets);
+    std::swap(row_indices, col_indices);
+}
+
+void
+Sparse_matrix_CSR ::print(bool transpose, std::ostream& os) const
+{
+    const auto n_lines = transpose ? get_n_cols() : get_n_rows();
+    std::vector<unsigned> line(transpose ? get_n_rows() : get_n_cols(), 0);
+
+    for (size_t l = 0; l < n_lines; l++)
+    {
+        const auto links = transpose ? this->get_rows_from_col(l) : this->get_cols_from_row(l);
+
+        // set the ones
+        for (auto& i : links)
+            line[i] = 1;
+
+        for (auto& v : line)
+            os << v << " ";
+
+        os << std::endl;
+
+        // reset the ones
+        for (auto& i : links)
+            line[i] = 0;
+    }
+}
+
+Sparse_matrix
+Sparse_matrix_CSR ::to_sparse_matrix() const
+{
+    Sparse_matrix matrix(get_n_rows(), get_n_cols());
+
+    // keep the order of the connections of the columns
+    for (size_t c = 0; c < get_n_cols(); c++)
+        for (auto r : this->get_rows_from_col(c))
+            matrix.add_connection(r, c);
+
+    return matrix;
+}
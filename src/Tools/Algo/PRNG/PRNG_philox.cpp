@@ -0,0 +1,106 @@
+#include "Tools/Algo/PRNG/PRNG_philox.hpp"
+
+using namespace aff3ct::tools;
+
+constexpr uint32_t PHILOX_M0 = 0xD2511F53;
+constexpr uint32_t PHILOX_M1 = 0xCD9E8D57;
+constexpr uint32_t PHILOX_W0 = 0x9E3779B9; // golden ratio
+constexpr uint32_t PHILOX_W1 = 0xBB67AE85; // sqrt(3) - 1
+constexpr int PHILOX_ROUNDS = 10;
+
+static inline void
+mulhilo(const uint32_t a, const uint32_t b, uint32_t& hi, uint32_t& lo)
+{
+    const uint64_t p = (uint64_t)a * (uint64_t)b;
+    hi = (uint32_t)(p >> 32);
+    lo = (uint32_t)p;
+}
+
+// there is no portable 32-bit 'mulhi' instruction: the 64-bit product is built from 16-bit halves, each partial
+// product fits in 32 bits (the 'int32_t' registers are seen as unsigned integers, the multiplications wrap)
+static inline void
+mulhilo(const mipp::Reg<int32_t> a, const uint32_t b, mipp::Reg<int32_t>& hi, mipp::Reg<int32_t>& lo)
+{
+    const mipp::Reg<int32_t> mask = (int32_t)0xFFFF;
+    const mipp::Reg<int32_t> b_l = (int32_t)(b & 0xFFFF);
+    const mipp::Reg<int32_t> b_h = (int32_t)(b >> 16);
+
+    const auto a_l = a & mask;
+    const auto a_h = (a >> 16) & mask;
+
+    const auto p_ll = a_l * b_l;
+    const auto p_lh = a_l * b_h;
+    const auto p_hl = a_h * b_l;
+    const auto p_hh = a_h * b_h;
+
+    const auto mid = ((p_ll >> 16) & mask) + (p_lh & mask) + (p_hl & mask);
+
+    hi = p_hh + ((p_lh >> 16) & mask) + ((p_hl >> 16) & mask) + ((mid >> 16) & mask);
+    lo = a * mipp::Reg<int32_t>((int32_t)b);
+}
+
+PRNG_philox::PRNG_philox(const uint64_t seed)
+{
+    this->seed(seed);
+}
+
+void
+PRNG_philox::seed(const uint64_t seed)
+{
+    key[0] = (uint32_t)seed;
+    key[1] = (uint32_t)(seed >> 32);
+}
+
+void
+PRNG_philox::generate(const uint32_t ctr[4], uint32_t out[4]) const
+{
+    uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    uint32_t k0 = key[0], k1 = key[1];
+
+    for (auto r = 0; r < PHILOX_ROUNDS; r++)
+    {
+        uint32_t hi0, lo0, hi1, lo1;
+        mulhilo(PHILOX_M0, c0, hi0, lo0);
+        mulhilo(PHILOX_M1, c2, hi1, lo1);
+
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+void
+PRNG_philox::generate(const mipp::Reg<int32_t> ctr[4], mipp::Reg<int32_t> out[4]) const
+{
+    auto c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+    uint32_t k0 = key[0], k1 = key[1];
+
+    for (auto r = 0; r < PHILOX_ROUNDS; r++)
+    {
+        mipp::Reg<int32_t> hi0, lo0, hi1, lo1;
+        mulhilo(c0, PHILOX_M0, hi0, lo0);
+        mulhilo(c2, PHILOX_M1, hi1, lo1);
+
+        c0 = hi1 ^ c1 ^ mipp::Reg<int32_t>((int32_t)k0);
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ mipp::Reg<int32_t>((int32_t)k1);
+        c3 = lo0;
+
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
@@ -0,0 +1,177 @@
+#include <cstring>
+#include <sstream>
+#include <streampu.hpp>
+
+#if defined(__PCLMUL__) && defined(__SSE2__)
+#include <emmintrin.h>
+#include <wmmintrin.h>
+#endif
+
+#include "Tools/Code/CRC/CRC_engine.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+// minimum number of bytes to use the folding with the carry-less multiplications instead of the lookup table
+constexpr size_t clmul_min_bytes = 64;
+
+static uint64_t
+reverse_bits(const uint64_t value, const int n_bits)
+{
+    uint64_t rev = 0;
+    for (auto i = 0; i < n_bits; i++)
+        rev |= ((value >> i) & 1) << (n_bits - 1 - i);
+    return rev;
+}
+
+static inline uint64_t
+load_u64(const uint8_t* data)
+{
+    uint64_t word;
+    std::memcpy(&word, data, sizeof(word));
+    return word;
+}
+
+CRC_engine::CRC_engine(const uint64_t polynomial, const int size)
+  : size(size)
+  , polynomial_rev(size > 0 && size <= 64 ? reverse_bits(polynomial, size) : 0)
+  , lut(16 * 256)
+  , k_fold_lo(0)
+  , k_fold_hi(0)
+{
+    if (size <= 0 || size > 64)
+    {
+        std::stringstream message;
+        message << "'size' has to be in [1, 64] ('size' = " << size << ").";
+        throw spu::tools::length_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    // the CRC of 'size' bits is computed as a 64-bit CRC with the polynomial P'(x) = P(x).x^(64 - size): the
+    // remainders of P' are the remainders of P shifted by (64 - size), which are the same bits in the reflected order
+    for (auto i = 0; i < 256; i++)
+    {
+        uint64_t crc = (uint64_t)i;
+        for (auto j = 0; j < 8; j++)
+            crc = (crc >> 1) ^ (-(crc & 1) & polynomial_rev);
+        lut[i] = crc;
+    }
+    for (auto t = 1; t < 16; t++)
+        for (auto i = 0; i < 256; i++)
+        {
+            const auto prev = lut[(t - 1) * 256 + i];
+            lut[t * 256 + i] = (prev >> 8) ^ lut[prev & 0xFF];
+        }
+
+    // x^n mod P' (with the bits in the natural order) to compute the folding constants
+    const auto poly64 = size == 64 ? polynomial : polynomial << (64 - size);
+    uint64_t x_pow = 1;
+    for (auto n = 1; n <= 191; n++)
+    {
+        x_pow = (x_pow << 1) ^ (-(x_pow >> 63) & poly64);
+        if (n == 127) k_fold_hi = reverse_bits(x_pow, 64);
+    }
+    k_fold_lo = reverse_bits(x_pow, 64);
+}
+
+int
+CRC_engine::get_size() const
+{
+    return this->size;
+}
+
+uint64_t
+CRC_engine::compute(const void* data, const size_t n_bits) const
+{
+    return this->update(0, data, n_bits);
+}
+
+uint64_t
+CRC_engine::update(uint64_t state, const void* data, const size_t n_bits) const
+{
+#if __BYTE_ORDER != __LITTLE_ENDIAN
+    throw spu::tools::runtime_error(
+      __FILE__, __LINE__, __func__, "The code of the CRC engine works only on little endian CPUs.");
+#endif
+
+    auto current = (const uint8_t*)data;
+    const auto n_bytes = n_bits / 8;
+
+    if (n_bytes >= clmul_min_bytes)
+        state = this->update_clmul(state, current, n_bytes);
+    else
+        state = this->update_lut(state, current, n_bytes);
+    current += n_bytes;
+
+    const auto rest = (int)(n_bits % 8);
+    if (rest != 0)
+    {
+        state ^= (uint64_t)(*current & ((1 << rest) - 1));
+        for (auto j = 0; j < rest; j++)
+            state = (state >> 1) ^ (-(state & 1) & polynomial_rev);
+    }
+
+    return state;
+}
+
+// Source of inspiration: http://create.stephan-brumme.com/crc32/ (Slicing-by-16)
+uint64_t
+CRC_engine::update_lut(uint64_t state, const uint8_t* data, size_t n_bytes) const
+{
+    const auto t = this->lut.data();
+    while (n_bytes >= 16)
+    {
+        const auto w1 = load_u64(data + 0) ^ state;
+        const auto w2 = load_u64(data + 8);
+
+        state = t[15 * 256 + ((w1 >> 0) & 0xFF)] ^ t[14 * 256 + ((w1 >> 8) & 0xFF)] ^
+                t[13 * 256 + ((w1 >> 16) & 0xFF)] ^ t[12 * 256 + ((w1 >> 24) & 0xFF)] ^
+                t[11 * 256 + ((w1 >> 32) & 0xFF)] ^ t[10 * 256 + ((w1 >> 40) & 0xFF)] ^
+                t[9 * 256 + ((w1 >> 48) & 0xFF)] ^ t[8 * 256 + ((w1 >> 56) & 0xFF)] ^
+                t[7 * 256 + ((w2 >> 0) & 0xFF)] ^ t[6 * 256 + ((w2 >> 8) & 0xFF)] ^
+                t[5 * 256 + ((w2 >> 16) & 0xFF)] ^ t[4 * 256 + ((w2 >> 24) & 0xFF)] ^
+                t[3 * 256 + ((w2 >> 32) & 0xFF)] ^ t[2 * 256 + ((w2 >> 40) & 0xFF)] ^
+                t[1 * 256 + ((w2 >> 48) & 0xFF)] ^ t[0 * 256 + ((w2 >> 56) & 0xFF)];
+
+        data += 16;
+        n_bytes -= 16;
+    }
+
+    while (n_bytes--)
+        state = (state >> 8) ^ t[(state & 0xFF) ^ *data++];
+
+    return state;
+}
+
+// Source of inspiration: Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (2009)
+uint64_t
+CRC_engine::update_clmul(uint64_t state, const uint8_t* data, size_t n_bytes) const
+{
+#if defined(__PCLMUL__) && defined(__SSE2__)
+    // the 128-bit accumulator A(x) verifies A(x) = message(x) mod P'(x), a product of two 64-bit reflected words is
+    // shifted by one bit, this is why the constants are x^191 and x^127 instead of x^192 and x^128
+    const auto k = _mm_set_epi64x((long long)this->k_fold_hi, (long long)this->k_fold_lo);
+
+    auto acc = _mm_loadu_si128((const __m128i*)data);
+    acc = _mm_xor_si128(acc, _mm_cvtsi64_si128((long long)state));
+    data += 16;
+    n_bytes -= 16;
+
+    while (n_bytes >= 16)
+    {
+        const auto lo = _mm_clmulepi64_si128(acc, k, 0x00);
+        const auto hi = _mm_clmulepi64_si128(acc, k, 0x11);
+        acc = _mm_xor_si128(_mm_xor_si128(lo, hi), _mm_loadu_si128((const __m128i*)data));
+        data += 16;
+        n_bytes -= 16;
+    }
+
+    // the CRC of the accumulator is the CRC of the folded bytes
+    uint8_t folded[16];
+    _mm_storeu_si128((__m128i*)folded, acc);
+    state = this->update_lut(0, folded, 16);
+
+    return this->update_lut(state, data, n_bytes);
+#else
+    return this->update_lut(state, data, n_bytes);
+#endif
+}
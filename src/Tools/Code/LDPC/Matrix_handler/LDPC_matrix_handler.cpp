@@ -179,11 +179,48 @@ Sparse_matrix
 LDPC_matrix_handler ::transform_H_to_G_identity(const Sparse_matrix& H, Positions_vector& info_bits_pos)
 {
     H.is_of_way_throw(Matrix::Way::HORIZONTAL);
-    LDPC_matrix Hf = sparse_to_full<LDPC_matrix::value_type>(H);
 
-    auto Gf = LDPC_matrix_handler::transform_H_to_G_identity(Hf, info_bits_pos);
+    const auto M = H.get_n_rows();
+    const auto N = H.get_n_cols();
+    const auto K = N - M;
 
-    return full_to_sparse(Gf);
+    GF2_matrix Hp(H);
+    auto swapped_cols = LDPC_matrix_handler::form_identity_M4R(Hp);
+
+    // G (VERTICAL) is the parity part of the reduced H above the K*K identity, 'G_rows[i]' is the row of this
+    // matrix at the position 'i' of G once the swapped columns have been restored
+    Positions_vector G_rows(N);
+    std::iota(G_rows.begin(), G_rows.end(), 0);
+    for (auto l = swapped_cols.size(); l > 0; l--)
+        std::swap(G_rows[swapped_cols[l - 1].first], G_rows[swapped_cols[l - 1].second]);
+
+    GF2_matrix Gp(N, K);
+    for (size_t i = 0; i < N; i++)
+    {
+        const auto r = (size_t)G_rows[i];
+        if (r < Hp.get_n_rows())
+        {
+            auto row = Gp.get_row(i);
+            for (size_t w = 0; w < Gp.get_n_words(); w++)
+                row[w] = Hp.get_bits(r, M + w * GF2_matrix::word_size, GF2_matrix::word_size);
+        }
+        else if (r >= M)
+            Gp.add_connection(i, r - M);
+        // else the row of H has been erased (null row)
+    }
+
+    // return info bits positions
+    info_bits_pos.resize(K);
+
+    Positions_vector bits_pos(N);
+    std::iota(bits_pos.begin(), bits_pos.end(), 0);
+
+    for (auto& p : swapped_cols)
+        std::swap(bits_pos[p.first], bits_pos[p.second]);
+
+    std::copy(bits_pos.begin() + M, bits_pos.end(), info_bits_pos.begin());
+
+    return Gp.to_sparse_matrix();
 }
 
 void
@@ -875,6 +912,120 @@ LDPC_matrix_handler ::form_identity(LDPC_matrix& mat, Matrix::Origin o)
     }
 }
 
+LDPC_matrix_handler::Positions_pair_vector
+LDPC_matrix_handler ::form_identity_M4R(GF2_matrix& mat, const size_t k)
+{
+    mat.is_of_way_throw(Matrix::Way::HORIZONTAL);
+
+    if (k == 0 || k > 16)
+    {
+        std::stringstream message;
+        message << "'k' has to be between 1 and 16 ('k' = " << k << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    using W = GF2_matrix::Word;
+
+    const auto n_col = mat.get_n_cols();
+    const auto n_words = mat.get_n_words();
+
+    Positions_pair_vector swapped_cols;
+    std::vector<W> table;
+
+    size_t i = 0;
+    while (i < mat.get_n_rows())
+    {
+        // the block is made of the columns [b, b + k), the pivot of the column i is on the row i (diagonal)
+        const auto b = i;
+        const auto w0 = b / GF2_matrix::word_size;
+        const auto n_tail = n_words - w0;
+
+        // bits of the row r on the block once reduced by the pivots already found in the block: the rows below are
+        // only reduced at the end of the block but the pivots are searched in the same order as in 'form_diagonal'
+        auto reduced_bits = [&mat, &b, &i, &k](const size_t r) -> W
+        {
+            auto x = mat.get_bits(r, b, k);
+            for (auto p = b; p < i; p++)
+                if ((x >> (p - b)) & 1) x ^= mat.get_bits(p, b, k);
+            return x;
+        };
+
+        while (i < b + k && i < mat.get_n_rows())
+        {
+            bool found = (reduced_bits(i) >> (i - b)) & 1;
+
+            if (!found)
+            {
+                // try to find an other row which as a 1 in column i
+                for (auto j = i + 1; j < mat.get_n_rows(); j++)
+                    if ((reduced_bits(j) >> (i - b)) & 1)
+                    {
+                        mat.swap_rows(i, j);
+                        found = true;
+                        break;
+                    }
+            }
+
+            // the row i is fully reduced by the previous pivots of the block
+            for (auto p = b; p < i; p++)
+                if (mat.get(i, p)) mat.xor_rows(i, p, w0);
+
+            if (!found)
+            {
+                // find an other column which is good on row i
+                const auto j = mat.find_first(i, i + 1);
+                if (j < n_col)
+                {
+                    swapped_cols.push_back(std::make_pair(i, j));
+                    mat.swap_cols(i, j);
+                    found = true;
+                }
+            }
+
+            if (found)
+                i++;
+            else
+                mat.erase_row(i); // the row is the null vector then delete it
+        }
+
+        const auto n_piv = i - b;
+        if (n_piv == 0) break;
+
+        // reduce the pivot rows among them to get an identity on the block
+        for (auto t = n_piv - 1; t > 0; t--)
+            for (size_t s = 0; s < t; s++)
+                if (mat.get(b + s, b + t)) mat.xor_rows(b + s, b + t, w0);
+
+        // all the combinations of the pivot rows, built in the Gray code order (one row XOR per combination)
+        const auto n_comb = (size_t)1 << n_piv;
+        table.assign(n_comb * n_tail, 0);
+        for (size_t g = 1; g < n_comb; g++)
+        {
+            const auto cur = g ^ (g >> 1);
+            const auto prev = (g - 1) ^ ((g - 1) >> 1);
+            const auto t = (size_t)gf2_ctz((W)(cur ^ prev));
+
+            const auto src = mat.get_row(b + t) + w0;
+            std::transform(table.begin() + prev * n_tail,
+                           table.begin() + (prev + 1) * n_tail,
+                           src,
+                           table.begin() + cur * n_tail,
+                           std::bit_xor<W>());
+        }
+
+        // remove the 1s of the block from all the other rows: above (back substitution) and below (elimination)
+        for (size_t r = 0; r < mat.get_n_rows(); r++)
+        {
+            if (r >= b && r < i) continue;
+
+            const auto x = (size_t)mat.get_bits(r, b, n_piv);
+            if (x) mat.xor_row(r, table.data() + x * n_tail, w0);
+        }
+    }
+
+    return swapped_cols;
+}
+
 Sparse_matrix
 LDPC_matrix_handler ::interleave_matrix(const Sparse_matrix& mat, Positions_vector& old_cols_pos)
 {
@@ -890,10 +1041,8 @@ LDPC_matrix_handler ::interleave_matrix(const Sparse_matrix& mat, Positions_vect
     Sparse_matrix itl_mat(mat.get_n_rows(), mat.get_n_cols());
 
     for (unsigned i = 0; i < mat.get_n_cols(); i++)
-    {
-        for (unsigned j = 0; j < mat.get_rows_from_col(old_cols_pos[i]).size(); j++)
-            itl_mat.add_connection(mat.get_rows_from_col(old_cols_pos[i])[j], i);
-    }
+        for (auto r : mat.get_rows_from_col(old_cols_pos[i]))
+            itl_mat.add_connection(r, i);
 
     return itl_mat;
 }
@@ -187,4 +187,84 @@ QC ::read_matrix_size(std::istream& stream, int& H, int& N)
 
     N = N_red * Z;
     H = M_red * Z;
-}
\ No newline at end of file
+}
+int
+QC ::read_lifting_size(std::istream& stream)
+{
+    std::string line;
+
+    tools::getline(stream, line);
+    auto values = split(line);
+    if (values.size() < 3)
+    {
+        std::stringstream message;
+        message << "'values.size()' has to be greater than 2 ('values.size()' = " << values.size() << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    const int Z = std::stoi(values[2]);
+    if (Z <= 0)
+    {
+        std::stringstream message;
+        message << "'Z' has to be greater than 0 ('Z' = " << Z << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    return Z;
+}
+
+std::vector<std::vector<int16_t>>
+QC ::get_base_matrix(const Sparse_matrix& H, const int Z)
+{
+    if (Z <= 0 || H.get_n_rows() % Z || H.get_n_cols() % Z)
+    {
+        std::stringstream message;
+        message << "'H.get_n_rows()' and 'H.get_n_cols()' have to be multiples of 'Z' ('H.get_n_rows()' = "
+                << H.get_n_rows() << ", 'H.get_n_cols()' = " << H.get_n_cols() << ", 'Z' = " << Z << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    const auto M_red = H.get_n_cols() / Z;
+    const auto N_red = H.get_n_rows() / Z;
+
+    std::vector<std::vector<int16_t>> base(M_red, std::vector<int16_t>(N_red, -1));
+    for (size_t i = 0; i < M_red; i++)
+    {
+        // the first check node of the block row gives the shift values
+        const auto& first = H.get_rows_from_col(i * Z);
+        for (auto v : first)
+        {
+            const auto j = v / Z;
+            if (base[i][j] != -1)
+            {
+                std::stringstream message;
+                message << "The block (" << i << ", " << j << ") is not a circulant permutation matrix.";
+                throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+            }
+            base[i][j] = (int16_t)(v % Z);
+        }
+
+        // the other check nodes have to follow the cyclic shifts
+        for (auto k = 1; k < Z; k++)
+        {
+            const auto& chk = H.get_rows_from_col(i * Z + k);
+            auto is_circulant = chk.size() == first.size();
+            for (size_t e = 0; e < chk.size() && is_circulant; e++)
+            {
+                const auto v = chk[e];
+                const auto j = v / Z;
+                is_circulant = base[i][j] != -1 && (size_t)((base[i][j] + k) % Z) == v % Z;
+            }
+
+            if (!is_circulant)
+            {
+                std::stringstream message;
+                message << "The block row " << i << " is not made of circulant permutation matrices ('Z' = " << Z
+                        << ").";
+                throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+            }
+        }
+    }
+
+    return base;
+}
@@ -0,0 +1,176 @@
+#include <array>
+#include <fstream>
+#include <sstream>
+#include <streampu.hpp>
+
+#include "Tools/Code/LDPC/Standard/NR/NR_constants.hpp"
+#include "Tools/general_utils.h"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+// the eight sets of lifting sizes: Z = a * 2^j with Z <= 384 (TS 38.212 table 5.3.2-1)
+static const int nr_lifting_set_a[8] = { 2, 3, 5, 7, 9, 11, 13, 15 };
+static const int nr_max_lifting_size = 384;
+
+// number of non-null blocks of the base graphs 1 and 2 (TS 38.212 tables 5.3.2-2 and 5.3.2-3)
+static const int nr_n_blocks[2] = { 316, 197 };
+
+int
+aff3ct::tools::nr_select_base_graph(const int K, const float R)
+{
+    if (K <= 292 || (K <= 3824 && R <= 0.67f) || R <= 0.25f) return 2;
+    return 1;
+}
+
+int
+aff3ct::tools::nr_lifting_size(const int K, const int BG, int* i_LS)
+{
+    if (BG != 1 && BG != 2)
+    {
+        std::stringstream message;
+        message << "'BG' has to be 1 or 2 ('BG' = " << BG << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    int K_b = 22;
+    if (BG == 2) K_b = K > 640 ? 10 : (K > 560 ? 9 : (K > 192 ? 8 : 6));
+
+    int Z_min = nr_max_lifting_size + 1;
+    int i_LS_min = -1;
+    for (auto i = 0; i < 8; i++)
+        for (auto Z = nr_lifting_set_a[i]; Z <= nr_max_lifting_size; Z *= 2)
+            if (K_b * Z >= K && Z < Z_min)
+            {
+                Z_min = Z;
+                i_LS_min = i;
+            }
+
+    if (i_LS_min == -1)
+    {
+        std::stringstream message;
+        message << "'K' is too large for the base graph, the code block segmentation is not supported ('K' = " << K
+                << ", 'BG' = " << BG << ", 'K_max' = " << K_b * nr_max_lifting_size << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (i_LS != nullptr) *i_LS = i_LS_min;
+
+    return Z_min;
+}
+
+int
+aff3ct::tools::nr_codeword_size(const int K, const int BG)
+{
+    return (BG == 1 ? 68 : 52) * nr_lifting_size(K, BG);
+}
+
+std::unique_ptr<nr_values>
+aff3ct::tools::build_nr(const int K, const int BG, const std::vector<std::array<int16_t, 10>>& table)
+{
+    std::unique_ptr<nr_values> nr(new nr_values());
+
+    nr->BG = BG;
+    nr->K = K;
+    nr->Z = nr_lifting_size(K, BG, &nr->i_LS);
+    nr->K_b = BG == 1 ? 22 : 10;
+    nr->N_b = BG == 1 ? 68 : 52;
+    nr->M_b = BG == 1 ? 46 : 42;
+    nr->N = nr->N_b * nr->Z;
+    nr->base.resize(nr->M_b, std::vector<int16_t>(nr->N_b, -1));
+
+    for (auto& block : table)
+    {
+        const auto i = (int)block[0];
+        const auto j = (int)block[1];
+
+        if (i < 0 || i >= nr->M_b || j < 0 || j >= nr->N_b || nr->base[i][j] >= 0)
+        {
+            std::stringstream message;
+            message << "Wrong or duplicated base graph entry ('i' = " << i << ", 'j' = " << j << ", 'BG' = " << BG
+                    << ").";
+            throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        // the shift values of a set are smaller than the largest lifting size of this set
+        for (auto s = 0; s < 8; s++)
+        {
+            auto Z_max = nr_lifting_set_a[s];
+            while (2 * Z_max <= nr_max_lifting_size)
+                Z_max *= 2;
+
+            const auto V = (int)block[2 + s];
+            if (V < 0 || V >= Z_max)
+            {
+                std::stringstream message;
+                message << "Wrong base graph shift value ('i' = " << i << ", 'j' = " << j << ", 'i_LS' = " << s
+                        << ", 'V' = " << V << ", 'Z_max' = " << Z_max << ").";
+                throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+            }
+        }
+
+        nr->base[i][j] = (int16_t)(block[2 + nr->i_LS] % nr->Z);
+    }
+
+    if ((int)table.size() != nr_n_blocks[BG - 1])
+    {
+        std::stringstream message;
+        message << "The table does not describe the whole base graph ('table.size()' = " << table.size()
+                << ", 'BG' = " << BG << ", 'expected' = " << nr_n_blocks[BG - 1] << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    return nr;
+}
+
+std::unique_ptr<nr_values>
+aff3ct::tools::build_nr(const int K, const int BG, const std::string& bg_path)
+{
+    std::ifstream file(bg_path);
+    if (!file.is_open())
+    {
+        std::stringstream message;
+        message << "'bg_path' couldn't be opened ('bg_path' = " << bg_path << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    std::vector<std::array<int16_t, 10>> table;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        auto values = split(line);
+        if (values.empty() || values[0][0] == '#') continue;
+
+        if (values.size() != 10)
+        {
+            std::stringstream message;
+            message << "Each line of the base graph file has to contain 10 values: 'i', 'j' and the 8 'V_{i,j}' "
+                    << "('bg_path' = " << bg_path << ", 'line' = '" << line << "').";
+            throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        std::array<int16_t, 10> block;
+        for (auto v = 0; v < 10; v++)
+            block[v] = (int16_t)std::stoi(values[v]);
+        table.push_back(block);
+    }
+
+    return build_nr(K, BG, table);
+}
+
+Sparse_matrix
+aff3ct::tools::build_H(const nr_values& nr)
+{
+    Sparse_matrix H(nr.N, nr.M_b * nr.Z);
+
+    for (auto i = 0; i < nr.M_b; i++)
+        for (auto j = 0; j < nr.N_b; j++)
+        {
+            const auto s = nr.base[i][j];
+            if (s >= 0)
+                for (auto k = 0; k < nr.Z; k++)
+                    H.add_connection(j * nr.Z + (k + s) % nr.Z, i * nr.Z + k);
+        }
+
+    return H;
+}
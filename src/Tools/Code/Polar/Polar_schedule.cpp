@@ -0,0 +1,114 @@
+#include <cmath>
+
+#include "Tools/Code/Polar/Polar_schedule.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Polar_schedule ::Polar_schedule(const Pattern_polar_parser& polar_patterns)
+  : m(0)
+  , instructions()
+{
+    this->build(polar_patterns);
+}
+
+void
+Polar_schedule ::build(const Pattern_polar_parser& polar_patterns)
+{
+    this->m = (int)std::log2(polar_patterns.get_frozen_bits().size());
+    this->instructions.clear();
+
+    int first_id = 0;
+    this->recursive_build(polar_patterns, 0, 0, this->m, first_id);
+}
+
+void
+Polar_schedule ::recursive_build(const Pattern_polar_parser& polar_patterns,
+                                 const int off_l,
+                                 const int off_s,
+                                 const int rev_depth,
+                                 int& node_id)
+{
+    const int n_elmts = 1 << rev_depth;
+    const int n_elm_2 = n_elmts >> 1;
+    const auto node_type = polar_patterns.get_node_type(node_id);
+
+    const bool is_terminal_pattern = (node_type == polar_node_t::RATE_0) || (node_type == polar_node_t::RATE_1) ||
+                                     (node_type == polar_node_t::REP) || (node_type == polar_node_t::SPC);
+
+    if (!is_terminal_pattern && rev_depth)
+    {
+        // f
+        switch (node_type)
+        {
+            case polar_node_t::STANDARD:
+                this->instructions.push_back({ polar_op_t::F, rev_depth, off_l, off_s });
+                break;
+            case polar_node_t::REP_LEFT:
+                this->instructions.push_back({ polar_op_t::F, rev_depth, off_l, off_s });
+                break;
+            case polar_node_t::RATE_0_LEFT:
+                this->instructions.push_back({ polar_op_t::F0, rev_depth, off_l, off_s });
+                break;
+            default:
+                break;
+        }
+
+        this->recursive_build(polar_patterns, off_l + n_elmts, off_s, rev_depth - 1, ++node_id); // left
+
+        // g
+        switch (node_type)
+        {
+            case polar_node_t::STANDARD:
+                this->instructions.push_back({ polar_op_t::G, rev_depth, off_l, off_s });
+                break;
+            case polar_node_t::RATE_0_LEFT:
+                this->instructions.push_back({ polar_op_t::G0, rev_depth, off_l, off_s });
+                break;
+            case polar_node_t::REP_LEFT:
+                this->instructions.push_back({ polar_op_t::GR, rev_depth, off_l, off_s });
+                break;
+            default:
+                break;
+        }
+
+        this->recursive_build(polar_patterns, off_l + n_elmts, off_s + n_elm_2, rev_depth - 1, ++node_id); // right
+
+        // xor
+        switch (node_type)
+        {
+            case polar_node_t::STANDARD:
+                this->instructions.push_back({ polar_op_t::XO, rev_depth, off_l, off_s });
+                break;
+            case polar_node_t::RATE_0_LEFT:
+                this->instructions.push_back({ polar_op_t::XO0, rev_depth, off_l, off_s });
+                break;
+            case polar_node_t::REP_LEFT:
+                this->instructions.push_back({ polar_op_t::XO, rev_depth, off_l, off_s });
+                break;
+            default:
+                break;
+        }
+    }
+    else
+    {
+        // h
+        switch (node_type)
+        {
+            case polar_node_t::RATE_0:
+                this->instructions.push_back({ polar_op_t::H0, rev_depth, off_l, off_s });
+                break;
+            case polar_node_t::RATE_1:
+                this->instructions.push_back({ polar_op_t::H, rev_depth, off_l, off_s });
+                break;
+            case polar_node_t::REP:
+                this->instructions.push_back({ polar_op_t::REP, rev_depth, off_l, off_s });
+                break;
+            case polar_node_t::SPC:
+                this->instructions.push_back({ polar_op_t::SPC, rev_depth, off_l, off_s });
+                break;
+            default:
+                break;
+        }
+    }
+}
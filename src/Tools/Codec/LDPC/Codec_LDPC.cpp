@@ -49,13 +49,20 @@ Codec_LDPC<B, Q>::Codec_LDPC(const factory::Encoder_LDPC& enc_params,
         dvbs2 = build_dvbs2(this->K, this->N);
         *H = build_H(*dvbs2);
     }
+    else if (enc_params.type == "LDPC_NR")
+    {
+        nr = build_nr(this->K, enc_params.NR_BG, enc_params.NR_bg_path);
+        *H = build_H(*nr);
+    }
 
     if (H->get_n_connections() == 0)
     {
         LDPC_matrix_handler::Positions_vector* ibp = nullptr;
         std::vector<bool>* pct = nullptr;
 
-        if (info_bits_pos->empty()) ibp = info_bits_pos.get();
+        // the "RU" method of the LDPC_H encoder chooses its own information bits
+        const auto enc_ibp = enc_params.type == "LDPC_H" && enc_params.G_method == "RU";
+        if (info_bits_pos->empty() && !enc_ibp) ibp = info_bits_pos.get();
 
         if (pct_params != nullptr && pct_params->pattern.empty()) pct = &pct_params->pattern;
 
@@ -107,7 +114,10 @@ Codec_LDPC<B, Q>::Codec_LDPC(const factory::Encoder_LDPC& enc_params,
     { // encoder not set when building encoder LDPC_H
         try
         {
-            this->set_encoder(enc_params.build<B>(*G, *H, *dvbs2));
+            if (nr != nullptr)
+                this->set_encoder(enc_params.build<B>(*G, *H, *nr));
+            else
+                this->set_encoder(enc_params.build<B>(*G, *H, *dvbs2));
         }
         catch (spu::tools::cannot_allocate const&)
         {
@@ -199,6 +209,20 @@ Codec_LDPC<B, Q>::get_DVBS2() const
     return *this->dvbs2.get();
 }
 
+template<typename B, typename Q>
+const nr_values&
+Codec_LDPC<B, Q>::get_NR() const
+{
+    if (this->nr == nullptr)
+    {
+        std::stringstream message;
+        message << "'nr' can't be nullptr.";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    return *this->nr.get();
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -23,7 +23,7 @@ Codec_polar<B, Q>::Codec_polar(const factory::Frozenbits_generator& fb_params,
   : Codec_SISO<B, Q>(enc_params.K, enc_params.N_cw, pct_params ? pct_params->N : enc_params.N_cw)
   , adaptive_fb(fb_params.noise == -1.f)
   , frozen_bits(new std::vector<bool>(fb_params.N_cw, true))
-  , generated_decoder((dec_params.implem.find("_SNR") != std::string::npos))
+  , generated_decoder(factory::Decoder_polar::is_generated(dec_params.implem))
   , puncturer_shortlast(nullptr)
   , fb_decoder(nullptr)
   , fb_encoder(nullptr)
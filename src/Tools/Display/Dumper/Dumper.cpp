@@ -116,8 +116,6 @@ Dumper ::dump(const std::string& base_path)
     for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
     {
         const auto size = this->registered_data_size[i];
-        const auto size_of = this->registered_data_sizeof[i];
-        const auto type = this->registered_data_type[i];
         const auto ext = this->registered_data_ext[i];
         const auto bin = this->registered_data_bin[i];
         const auto head = this->registered_data_head[i];
@@ -128,22 +126,34 @@ Dumper ::dump(const std::string& base_path)
         if (bin)
         {
             file.open(path, std::ofstream::out | std::ios_base::binary);
-
-            if (this->write_headers) this->write_header_binary(file, (unsigned)this->buffer[i].size(), size, head);
-            this->write_body_binary(file, this->buffer[i], size * size_of);
+            if (this->write_headers) this->write_header_binary(file, this->get_n_data(i), size, head);
         }
         else
         {
             file.open(path, std::ofstream::out);
-
-            if (this->write_headers) this->write_header_text(file, (unsigned)this->buffer[i].size(), size, head);
-            this->write_body_text(file, this->buffer[i], size, type);
+            if (this->write_headers) this->write_header_text(file, this->get_n_data(i), size, head);
         }
+        this->write_body(file, i);
 
         file.close();
     }
 }
 
+unsigned
+Dumper ::get_n_data(const unsigned i) const
+{
+    return (unsigned)this->buffer[i].size();
+}
+
+void
+Dumper ::write_body(std::ofstream& file, const unsigned i)
+{
+    if (this->registered_data_bin[i])
+        this->write_body_binary(file, this->buffer[i], this->registered_data_size[i] * this->registered_data_sizeof[i]);
+    else
+        this->write_body_text(file, this->buffer[i], this->registered_data_size[i], this->registered_data_type[i]);
+}
+
 void
 Dumper ::clear()
 {
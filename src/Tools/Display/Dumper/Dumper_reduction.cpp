@@ -7,9 +7,10 @@
 
 using namespace aff3ct::tools;
 
-Dumper_reduction ::Dumper_reduction(std::vector<std::unique_ptr<Dumper>>& dumpers)
+Dumper_reduction ::Dumper_reduction(std::vector<std::unique_ptr<Dumper>>& dumpers, const bool write_index)
   : Dumper()
   , dumpers(dumpers)
+  , write_index(write_index)
 {
     this->checks();
 }
@@ -145,13 +146,11 @@ Dumper_reduction ::dump(const std::string& base_path)
 
     for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
     {
-        unsigned n_data = (unsigned)this->buffer[i].size();
+        unsigned n_data = this->get_n_data(i);
         for (auto& d : this->dumpers)
-            n_data += (unsigned)d->buffer[i].size();
+            n_data += d->get_n_data(i);
 
         const auto size = this->registered_data_size[i];
-        const auto size_of = this->registered_data_sizeof[i];
-        const auto type = this->registered_data_type[i];
         const auto ext = this->registered_data_ext[i];
         const auto bin = this->registered_data_bin[i];
         const auto head = this->registered_data_head[i];
@@ -162,24 +161,40 @@ Dumper_reduction ::dump(const std::string& base_path)
         if (bin)
         {
             file.open(path, std::ofstream::out | std::ios_base::binary);
-
             if (this->write_headers) this->write_header_binary(file, n_data, size, head);
-            this->write_body_binary(file, this->buffer[i], size * size_of);
-            for (auto& d : this->dumpers)
-                this->write_body_binary(file, d->buffer[i], size * size_of);
         }
         else
         {
             file.open(path, std::ofstream::out);
-
             if (this->write_headers) this->write_header_text(file, n_data, size, head);
-            this->write_body_text(file, this->buffer[i], size, type);
-            for (auto& d : this->dumpers)
-                this->write_body_text(file, d->buffer[i], size, type);
         }
 
+        this->write_body(file, i);
+        for (auto& d : this->dumpers)
+            d->write_body(file, i);
+
         file.close();
     }
+
+    if (this->write_index) this->dump_index(base_path);
+}
+
+void
+Dumper_reduction ::dump_index(const std::string& base_path)
+{
+    std::ofstream file(base_path + ".idx", std::ofstream::out);
+
+    // the frames of the dumpers are merged in order: the dumper 'd' wrote the frames ['first', 'first' + 'n_frames')
+    file << "# dumper first n_frames" << std::endl;
+    unsigned first = 0;
+    for (size_t d = 0; d < this->dumpers.size(); d++)
+    {
+        const auto n_frames = this->registered_data_ptr.size() ? this->dumpers[d]->get_n_data(0) : 0;
+        file << d << " " << first << " " << n_frames << std::endl;
+        first += n_frames;
+    }
+
+    file.close();
 }
 
 void
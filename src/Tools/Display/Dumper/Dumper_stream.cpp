@@ -0,0 +1,244 @@
+#include <algorithm>
+#include <cstdio>
+#include <ios>
+#include <sstream>
+#include <streampu.hpp>
+
+#include "Tools/Display/Dumper/Dumper_stream.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Dumper_stream ::Dumper_stream(const std::string& part_path, const size_t buffer_bytes)
+  : Dumper()
+  , part_path(part_path)
+  , buffer_bytes(buffer_bytes)
+  , n_active(0)
+  , frames_per_block(0)
+  , writing(false)
+  , stop(false)
+{
+    if (part_path.empty())
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, "'part_path' can't be empty.");
+
+    if (buffer_bytes == 0)
+    {
+        std::stringstream message;
+        message << "'buffer_bytes' has to be greater than 0 ('buffer_bytes' = " << buffer_bytes << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->writer = std::thread(&Dumper_stream::writer_loop, this);
+}
+
+Dumper_stream ::~Dumper_stream()
+{
+    {
+        std::unique_lock<std::mutex> lock(this->mtx);
+        this->stop = true;
+    }
+    this->cv.notify_all();
+    this->writer.join();
+
+    for (size_t i = 0; i < this->parts.size(); i++)
+    {
+        this->parts[i]->close();
+        std::remove(this->get_part_path((unsigned)i).c_str());
+    }
+}
+
+std::string
+Dumper_stream ::get_part_path(const unsigned i) const
+{
+    return this->part_path + "." + this->registered_data_ext[i] + ".part";
+}
+
+void
+Dumper_stream ::open_parts(const bool truncate)
+{
+    const auto n_reg = this->registered_data_ptr.size();
+
+    if (this->parts.size() != n_reg)
+    {
+        this->parts.clear();
+        for (size_t i = 0; i < n_reg; i++)
+            this->parts.push_back(std::unique_ptr<std::ofstream>(new std::ofstream()));
+
+        this->active.resize(n_reg);
+        this->pending.resize(n_reg);
+        this->n_data.assign(n_reg, 0);
+
+        // all the registered data are written by blocks of the same number of frames
+        size_t frame_bytes = 0;
+        for (size_t i = 0; i < n_reg; i++)
+            frame_bytes += this->registered_data_size[i] * this->registered_data_sizeof[i];
+        this->frames_per_block = (unsigned)std::max((size_t)1, this->buffer_bytes / std::max((size_t)1, frame_bytes));
+
+        for (size_t i = 0; i < n_reg; i++)
+        {
+            const auto bytes = this->frames_per_block * this->registered_data_size[i] * this->registered_data_sizeof[i];
+            this->active[i].reserve(bytes);
+            this->pending[i].reserve(bytes);
+        }
+    }
+
+    for (size_t i = 0; i < n_reg; i++)
+    {
+        if (this->parts[i]->is_open()) this->parts[i]->close();
+
+        const auto path = this->get_part_path((unsigned)i);
+        const auto mode = std::ofstream::out | std::ios_base::binary |
+                          (truncate ? std::ios_base::trunc : std::ios_base::app);
+        this->parts[i]->open(path, mode);
+
+        if (!this->parts[i]->is_open())
+        {
+            std::stringstream message;
+            message << "Impossible to open the '" << path << "' file.";
+            throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+    }
+}
+
+void
+Dumper_stream ::add(const unsigned n_err, const size_t frame_id)
+{
+    if (n_err < this->add_threshold) return;
+
+    if (this->parts.size() != this->registered_data_ptr.size()) this->open_parts(true);
+
+    for (auto i = 0; i < (int)this->registered_data_ptr.size(); i++)
+    {
+        if ((unsigned)frame_id < this->registered_data_n_frames[i])
+        {
+            const auto ptr = this->registered_data_ptr[i];
+            const auto bytes = this->registered_data_size[i] * this->registered_data_sizeof[i];
+
+            this->active[i].insert(this->active[i].end(), ptr + bytes * (frame_id + 0), ptr + bytes * (frame_id + 1));
+            this->n_data[i]++;
+        }
+    }
+
+    if (++this->n_active >= this->frames_per_block) this->hand_over();
+}
+
+void
+Dumper_stream ::hand_over()
+{
+    // wait for the previous block, the memory is bounded to two blocks per registered data
+    std::unique_lock<std::mutex> lock(this->mtx);
+    this->cv.wait(lock, [this]() { return !this->writing; });
+
+    std::swap(this->active, this->pending);
+    this->n_active = 0;
+    this->writing = true;
+
+    lock.unlock();
+    this->cv.notify_all();
+}
+
+void
+Dumper_stream ::wait_writer()
+{
+    std::unique_lock<std::mutex> lock(this->mtx);
+    this->cv.wait(lock, [this]() { return !this->writing; });
+}
+
+void
+Dumper_stream ::writer_loop()
+{
+    std::unique_lock<std::mutex> lock(this->mtx);
+    while (true)
+    {
+        this->cv.wait(lock, [this]() { return this->writing || this->stop; });
+
+        if (this->writing)
+        {
+            lock.unlock();
+            for (size_t i = 0; i < this->pending.size(); i++)
+            {
+                this->parts[i]->write(this->pending[i].data(), this->pending[i].size());
+                this->pending[i].clear(); // the capacity is kept
+            }
+            lock.lock();
+
+            this->writing = false;
+            this->cv.notify_all();
+        }
+        else
+            break;
+    }
+}
+
+void
+Dumper_stream ::flush()
+{
+    if (this->n_active) this->hand_over();
+    this->wait_writer();
+
+    for (auto& p : this->parts)
+        p->flush();
+}
+
+unsigned
+Dumper_stream ::get_n_data(const unsigned i) const
+{
+    return i < this->n_data.size() ? this->n_data[i] : 0;
+}
+
+void
+Dumper_stream ::write_body(std::ofstream& file, const unsigned i)
+{
+    if (i >= this->parts.size()) return;
+
+    this->flush();
+
+    const auto path = this->get_part_path(i);
+    std::ifstream part(path, std::ifstream::in | std::ios_base::binary);
+    if (!part.is_open())
+    {
+        std::stringstream message;
+        message << "Impossible to open the '" << path << "' file.";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    // the part is read by blocks of frames, the merge uses the same amount of memory than the dump
+    const auto bytes = this->registered_data_size[i] * this->registered_data_sizeof[i];
+    std::vector<std::vector<char>> block;
+    for (unsigned f = 0; f < this->n_data[i]; f += (unsigned)block.size())
+    {
+        block.resize(std::min(this->frames_per_block, this->n_data[i] - f));
+        for (auto& b : block)
+        {
+            b.resize(bytes);
+            part.read(b.data(), bytes);
+        }
+
+        if (!part)
+        {
+            std::stringstream message;
+            message << "Not enough data in the '" << path << "' file (got less than " << (f + block.size())
+                    << " frames).";
+            throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        if (this->registered_data_bin[i])
+            this->write_body_binary(file, block, bytes);
+        else
+            this->write_body_text(file, block, this->registered_data_size[i], this->registered_data_type[i]);
+    }
+}
+
+void
+Dumper_stream ::clear()
+{
+    Dumper::clear();
+
+    this->wait_writer();
+    for (auto& a : this->active)
+        a.clear();
+    this->n_active = 0;
+    std::fill(this->n_data.begin(), this->n_data.end(), 0);
+
+    if (this->parts.size()) this->open_parts(true);
+}
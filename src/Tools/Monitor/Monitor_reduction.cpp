@@ -10,90 +10,95 @@
 using namespace aff3ct;
 using namespace aff3ct::tools;
 
-bool aff3ct::tools::Monitor_reduction_static::stop_loop = false;
-std::vector<aff3ct::tools::Monitor_reduction_static*> aff3ct::tools::Monitor_reduction_static::monitors;
-std::thread::id aff3ct::tools::Monitor_reduction_static::master_thread_id = std::this_thread::get_id();
-std::chrono::nanoseconds aff3ct::tools::Monitor_reduction_static::d_reduce_frequency = std::chrono::milliseconds(1000);
-std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds>
-  aff3ct::tools::Monitor_reduction_static::t_last_reduction;
-
-Monitor_reduction_static ::Monitor_reduction_static()
-{
-    Monitor_reduction_static::add_monitor(this);
-}
-
-Monitor_reduction_static ::~Monitor_reduction_static()
+constexpr size_t Monitor_reduction_engine::cache_line_size;
+
+Monitor_reduction_engine ::Monitor_reduction_engine()
+  : stop_loop(false)
+  , master_thread_id(std::this_thread::get_id())
+  , d_reduce_frequency(std::chrono::milliseconds(1000))
+  , t_last_reduction(std::chrono::steady_clock::now())
+  , n_counters(0)
+  , max_fe(0)
+  , max_n_frames(0)
+  , max_n_trials(0)
 {
-    Monitor_reduction_static::remove_monitor(this);
 }
 
 void
-Monitor_reduction_static ::add_monitor(Monitor_reduction_static* m)
+Monitor_reduction_engine ::add_monitor(Monitor_reduction_base* m)
 {
-    Monitor_reduction_static::monitors.push_back(m);
+    this->monitors.push_back(m);
 }
 
 void
-Monitor_reduction_static ::remove_monitor(Monitor_reduction_static* m)
+Monitor_reduction_engine ::remove_monitor(Monitor_reduction_base* m)
 {
-    for (size_t i = 0; i < Monitor_reduction_static::monitors.size(); i++)
-        if (m == Monitor_reduction_static::monitors[i])
+    for (size_t i = 0; i < this->monitors.size(); i++)
+        if (m == this->monitors[i])
         {
-            Monitor_reduction_static::monitors.erase(Monitor_reduction_static::monitors.begin() + i);
+            this->monitors.erase(this->monitors.begin() + i);
             break;
         }
 }
 
 void
-Monitor_reduction_static ::reset_all()
+Monitor_reduction_engine ::reset_all()
 {
-    Monitor_reduction_static::t_last_reduction = std::chrono::steady_clock::now();
-    Monitor_reduction_static::stop_loop = false;
+    this->t_last_reduction = std::chrono::steady_clock::now();
+    this->stop_loop.store(false);
 
-    for (auto& m : Monitor_reduction_static::monitors)
-        m->reset();
-}
+    for (size_t c = 0; c < this->n_counters; c++)
+    {
+        this->counters[c].n_fra.store(0, std::memory_order_relaxed);
+        this->counters[c].n_fe.store(0, std::memory_order_relaxed);
+        this->counters[c].n_trials.store(0, std::memory_order_relaxed);
+    }
 
-bool
-Monitor_reduction_static ::is_done()
-{
-    return this->_is_done();
+    for (auto& m : this->monitors)
+        m->reset();
 }
 
 bool
-Monitor_reduction_static ::is_done_all(bool fully)
+Monitor_reduction_engine ::is_done_all(bool fully)
 {
-    reduce_all(fully, false);
+    // the other threads do not touch the monitors, the master thread is in charge of the stop decision
+    if (std::this_thread::get_id() != this->master_thread_id) return this->get_stop_loop();
 
-    bool is_done = false;
+    // the stop decision only reads the counters of the replicas
+    if (this->counters_limit_achieved()) this->set_stop_loop();
 
-    for (auto& m : Monitor_reduction_static::monitors)
-        is_done |= m->_is_done();
-
-    if (is_done) set_stop_loop();
+    // the replicas are reduced only to refresh the displayed values (never if the period is null), the criteria of
+    // the reduced monitors that are not published in the counters are checked on the values of the last refresh
+    if (this->d_reduce_frequency.count() != 0 &&
+        (std::chrono::steady_clock::now() - this->t_last_reduction) >= this->d_reduce_frequency)
+    {
+        this->_reduce(fully, true);
+        for (auto& m : this->monitors)
+            if (m->_is_done()) this->set_stop_loop();
+    }
 
-    return get_stop_loop();
+    return this->get_stop_loop();
 }
 
 void
-Monitor_reduction_static ::reduce_all(bool fully, bool force)
+Monitor_reduction_engine ::reduce_all(bool fully, bool force)
 {
-    _reduce(fully, force);
+    this->_reduce(fully, force);
 }
 
 void
-Monitor_reduction_static ::last_reduce_all(bool fully)
+Monitor_reduction_engine ::last_reduce_all(bool fully)
 {
-    Monitor_reduction_static::set_stop_loop();
-    while (!_reduce(fully, true))
+    this->set_stop_loop();
+    while (!this->_reduce(fully, true))
         ;
 }
 
 void
-Monitor_reduction_static ::check_reducible()
+Monitor_reduction_engine ::check_reducible()
 {
 #ifdef AFF3CT_MPI
-    int n_monitor_send = Monitor_reduction_static::monitors.size(), n_monitor_recv;
+    int n_monitor_send = this->monitors.size(), n_monitor_recv;
     if (auto ret = MPI_Allreduce(&n_monitor_send, &n_monitor_recv, 1, MPI_INT, MPI_PROD, MPI_COMM_WORLD))
     {
         std::stringstream message;
@@ -130,10 +135,10 @@ Monitor_reduction_static ::check_reducible()
 }
 
 bool
-Monitor_reduction_static ::reduce_stop_loop()
+Monitor_reduction_engine ::reduce_stop_loop()
 {
 #ifdef AFF3CT_MPI
-    int n_stop_recv, stop_send = Monitor_reduction_static::get_stop_loop() ? 1 : 0;
+    int n_stop_recv, stop_send = this->get_stop_loop() ? 1 : 0;
     if (auto ret = MPI_Allreduce(&stop_send, &n_stop_recv, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD))
     {
         std::stringstream message;
@@ -141,7 +146,7 @@ Monitor_reduction_static ::reduce_stop_loop()
         throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
-    if (n_stop_recv > 0) Monitor_reduction_static::set_stop_loop();
+    if (n_stop_recv > 0) this->set_stop_loop();
 
     int np;
     if (auto ret = MPI_Comm_size(MPI_COMM_WORLD, &np))
@@ -158,46 +163,106 @@ Monitor_reduction_static ::reduce_stop_loop()
 }
 
 bool
-Monitor_reduction_static ::_reduce(bool fully, bool force)
+Monitor_reduction_engine ::_reduce(bool fully, bool force)
 {
     bool all_process_on_last = false;
 
     // only the master thread can do this
-    if (force || (std::this_thread::get_id() == Monitor_reduction_static::master_thread_id &&
-                  (std::chrono::steady_clock::now() - Monitor_reduction_static::t_last_reduction) >=
-                    Monitor_reduction_static::d_reduce_frequency))
+    if (force || (std::this_thread::get_id() == this->master_thread_id &&
+                  (std::chrono::steady_clock::now() - this->t_last_reduction) >= this->d_reduce_frequency))
     {
-        for (auto& m : Monitor_reduction_static::monitors)
+        for (auto& m : this->monitors)
             m->reduce(fully);
 
-        all_process_on_last = reduce_stop_loop();
+        all_process_on_last = this->reduce_stop_loop();
 
-        Monitor_reduction_static::t_last_reduction = std::chrono::steady_clock::now();
+        this->t_last_reduction = std::chrono::steady_clock::now();
     }
 
     return all_process_on_last;
 }
 
 void
-Monitor_reduction_static ::set_master_thread_id(std::thread::id t)
+Monitor_reduction_engine ::set_master_thread_id(std::thread::id t)
 {
-    Monitor_reduction_static::master_thread_id = t;
+    this->master_thread_id = t;
 }
 
 void
-Monitor_reduction_static ::set_reduce_frequency(std::chrono::nanoseconds d)
+Monitor_reduction_engine ::set_reduce_frequency(std::chrono::nanoseconds d)
+{
+    this->d_reduce_frequency = d;
+}
+
+void
+Monitor_reduction_engine ::init_counters(const size_t n_replicas,
+                                         const unsigned max_fe,
+                                         const unsigned max_n_frames,
+                                         const unsigned max_n_trials)
+{
+    this->counters.reset(new Counters[n_replicas]());
+    this->n_counters = n_replicas;
+    this->max_fe = max_fe;
+    this->max_n_frames = max_n_frames;
+    this->max_n_trials = max_n_trials;
+}
+
+Monitor_reduction_engine::Counters&
+Monitor_reduction_engine ::get_counters(const size_t replica_id)
+{
+    if (replica_id >= this->n_counters)
+    {
+        std::stringstream message;
+        message << "'replica_id' has to be smaller than 'n_counters' ('replica_id' = " << replica_id
+                << ", 'n_counters' = " << this->n_counters << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    return this->counters[replica_id];
+}
+
+bool
+Monitor_reduction_engine ::counters_limit_achieved() const
 {
-    Monitor_reduction_static::d_reduce_frequency = d;
+    if (this->max_fe == 0 && this->max_n_frames == 0 && this->max_n_trials == 0) return false;
+
+    unsigned long long n_fra = 0, n_fe = 0, n_trials = 0;
+    for (size_t c = 0; c < this->n_counters; c++)
+    {
+        n_fra += this->counters[c].n_fra.load(std::memory_order_relaxed);
+        n_fe += this->counters[c].n_fe.load(std::memory_order_relaxed);
+        n_trials += this->counters[c].n_trials.load(std::memory_order_relaxed);
+    }
+
+    return (this->max_fe != 0 && n_fe >= this->max_fe) || (this->max_n_frames != 0 && n_fra >= this->max_n_frames) ||
+           (this->max_n_trials != 0 && n_trials >= this->max_n_trials);
 }
 
 bool
-Monitor_reduction_static ::get_stop_loop()
+Monitor_reduction_engine ::get_stop_loop() const
 {
-    return Monitor_reduction_static::stop_loop;
+    return this->stop_loop.load(std::memory_order_relaxed);
 }
 
 void
-Monitor_reduction_static ::set_stop_loop()
+Monitor_reduction_engine ::set_stop_loop()
 {
-    Monitor_reduction_static::stop_loop = true;
-}
\ No newline at end of file
+    this->stop_loop.store(true, std::memory_order_relaxed);
+}
+
+Monitor_reduction_base ::Monitor_reduction_base(Monitor_reduction_engine& engine)
+  : engine(engine)
+{
+    this->engine.add_monitor(this);
+}
+
+Monitor_reduction_base ::~Monitor_reduction_base()
+{
+    this->engine.remove_monitor(this);
+}
+
+bool
+Monitor_reduction_base ::is_done()
+{
+    return this->_is_done();
+}
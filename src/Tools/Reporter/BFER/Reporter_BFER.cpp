@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iomanip>
 #include <ios>
 #include <sstream>
@@ -30,6 +31,13 @@ Reporter_BFER<B>::create_groups()
     BFER_cols.push_back(std::make_tuple("BER", "", 0));
     BFER_cols.push_back(std::make_tuple("FER", "", 0));
 
+    if (this->monitor.is_importance_sampling())
+    {
+        // bounds of the 95% confidence interval of the importance sampling FER estimate
+        BFER_cols.push_back(std::make_tuple("FER_LO", "", 0));
+        BFER_cols.push_back(std::make_tuple("FER_HI", "", 0));
+    }
+
     this->cols_groups.push_back(this->monitor_group);
 }
 
@@ -67,6 +75,19 @@ Reporter_BFER<B>::report(bool final)
     bfer_report.push_back(str_ber.str());
     bfer_report.push_back(str_fer.str());
 
+    if (this->monitor.is_importance_sampling())
+    {
+        const auto half_width = 1.96 * this->monitor.get_fer_stddev();
+        const auto fer = (double)this->monitor.get_fer();
+
+        std::stringstream str_fer_lo, str_fer_hi;
+        str_fer_lo << std::setprecision(2) << std::scientific << std::max(0., fer - half_width);
+        str_fer_hi << std::setprecision(2) << std::scientific << fer + half_width;
+
+        bfer_report.push_back(str_fer_lo.str());
+        bfer_report.push_back(str_fer_hi.str());
+    }
+
     return the_report;
 }
 
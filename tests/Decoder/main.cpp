@@ -0,0 +1,267 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <streampu.hpp>
+
+#include "Module/Channel/AWGN/Channel_AWGN_LLR.hpp"
+#include "Module/Decoder/Generic/ML/Decoder_maximum_likelihood_std.hpp"
+#include "Module/Decoder/Generic/OSD/Decoder_OSD_std.hpp"
+#include "Module/Encoder/LDPC/NR/Encoder_LDPC_NR.hpp"
+#include "Module/Encoder/Polar/Encoder_polar.hpp"
+#include "Tools/Code/LDPC/Standard/NR/NR_constants.hpp"
+#include "Tools/Display/rang_format/rang_format.h"
+
+using namespace aff3ct;
+
+/*
+ * Decoder checks: the decoders which have to give the same decisions on the same noisy frames are compared, the
+ * encoders are checked against their parity check matrix and the noise of the channels against its reproducibility.
+ * Each check prints one line, the program fails if one of them fails.
+ */
+
+// the OSD at the order K (all the test patterns) is a maximum likelihood decoder, the OSD is built with placeholder
+// frozen bits (as in the polar codec) and then receives the real ones
+static bool
+check_OSD_vs_ML(const bool hamming, const int n_frames, const int seed)
+{
+    const int K = 8, N = 16;
+    std::vector<bool> placeholder_bits(N, true), frozen_bits(N, true);
+    std::fill(placeholder_bits.begin(), placeholder_bits.begin() + K, false);
+    for (auto n : { 6, 7, 10, 11, 12, 13, 14, 15 })
+        frozen_bits[n] = false;
+
+    module::Encoder_polar<> placeholder_encoder(K, N, placeholder_bits);
+    module::Encoder_polar<> encoder(K, N, frozen_bits);
+
+    module::Decoder_OSD_std<> osd(K, N, placeholder_encoder, K, hamming);
+    module::Decoder_ML_std<> ml(K, N, encoder, hamming);
+    osd.set_frozen_bits(frozen_bits);
+
+    std::mt19937 prng(seed);
+    std::bernoulli_distribution bits;
+    std::normal_distribution<float> noise(0.f, 0.9f);
+
+    std::vector<int> U_K(K), X_N(N), V_K_osd(K), V_K_ml(K), V_N_osd(N), V_N_ml(N);
+    std::vector<float> Y_N(N);
+    int n_diffs = 0;
+    for (auto f = 0; f < n_frames; f++)
+    {
+        for (auto& u : U_K)
+            u = bits(prng);
+        encoder.encode(U_K.data(), X_N.data());
+        for (auto n = 0; n < N; n++)
+            Y_N[n] = (X_N[n] ? -1.f : 1.f) + noise(prng);
+
+        osd.decode_siho(Y_N.data(), V_K_osd.data());
+        ml.decode_siho(Y_N.data(), V_K_ml.data());
+        osd.decode_siho_cw(Y_N.data(), V_N_osd.data());
+        ml.decode_siho_cw(Y_N.data(), V_N_ml.data());
+
+        // with the Hamming distance several codewords can be at the minimum distance, only the distance is compared
+        if (hamming)
+        {
+            int d_osd = 0, d_ml = 0;
+            for (auto n = 0; n < N; n++)
+            {
+                d_osd += V_N_osd[n] != (Y_N[n] < 0.f);
+                d_ml += V_N_ml[n] != (Y_N[n] < 0.f);
+            }
+            n_diffs += d_osd != d_ml;
+        }
+        else
+            n_diffs += V_K_osd != V_K_ml || V_N_osd != V_N_ml;
+    }
+
+    std::cout << "OSD (order K) vs ML, polar (" << N << "," << K << "), " << (hamming ? "Hamming" : "Euclidean")
+              << " distance: " << n_diffs << " different decisions on " << n_frames << " frames" << std::endl;
+
+    return n_diffs == 0;
+}
+
+// base graph table with the 5G NR structure (TS 38.212 section 5.3.2): the double-diagonal core on the 4 first rows
+// and a single identity parity block on each extension row, the other blocks and the shift values are random
+static std::vector<std::array<int16_t, 10>>
+nr_structured_table(const int BG, const int seed)
+{
+    const int kb = BG == 1 ? 22 : 10, M_b = BG == 1 ? 46 : 42, n_blocks = BG == 1 ? 316 : 197;
+    const int Z_max[8] = { 256, 384, 320, 224, 288, 352, 208, 240 };
+
+    std::mt19937 prng(seed);
+    std::vector<std::array<int16_t, 10>> table;
+    auto add_block = [&](const int i, const int j, const int V)
+    {
+        std::array<int16_t, 10> block;
+        block[0] = (int16_t)i;
+        block[1] = (int16_t)j;
+        for (auto s = 0; s < 8; s++)
+            block[2 + s] = (int16_t)(V >= 0 ? V : std::uniform_int_distribution<int>(0, Z_max[s] - 1)(prng));
+        table.push_back(block);
+    };
+
+    // first parity block of the core rows: two identical shifts cancel out in the sum of the core rows
+    const std::vector<std::pair<int, int>> first_parity =
+      BG == 1 ? std::vector<std::pair<int, int>>{ { 0, 1 }, { 1, 0 }, { 3, 1 } }
+              : std::vector<std::pair<int, int>>{ { 0, 0 }, { 2, 1 }, { 3, 0 } };
+    for (auto& b : first_parity)
+        add_block(b.first, kb, b.second);
+    for (auto i = 0; i < 4; i++)
+    {
+        if (i > 0) add_block(i, kb + i, 0);
+        if (i < 3) add_block(i, kb + i + 1, 0);
+    }
+    for (auto i = 4; i < M_b; i++)
+        add_block(i, kb + i, 0);
+
+    // the remaining blocks: systematic blocks on the core rows, systematic and core parity blocks on the extension rows
+    std::vector<std::pair<int, int>> free_blocks;
+    for (auto i = 0; i < M_b; i++)
+        for (auto j = 0; j < (i < 4 ? kb : kb + 4); j++)
+            free_blocks.push_back(std::make_pair(i, j));
+    std::shuffle(free_blocks.begin(), free_blocks.end(), prng);
+    for (auto b = 0; (int)table.size() < n_blocks; b++)
+        add_block(free_blocks[b].first, free_blocks[b].second, -1);
+
+    return table;
+}
+
+// the NR encoder is checked with H.x^T = 0 for the smallest, a medium and the largest lifting size of each set
+static bool
+check_NR_encoder(const int BG, const int n_frames, const int seed)
+{
+    const auto table = nr_structured_table(BG, seed);
+    const int set_a[8] = { 2, 3, 5, 7, 9, 11, 13, 15 };
+
+    std::mt19937 prng(seed);
+    std::bernoulli_distribution bits;
+
+    int n_checks = 0, n_fails = 0;
+    for (auto i_LS = 0; i_LS < 8; i_LS++)
+    {
+        std::vector<int> lifting_sizes;
+        for (auto Z = set_a[i_LS]; Z <= 384; Z *= 2)
+            lifting_sizes.push_back(Z);
+
+        for (auto Z : { lifting_sizes.front(), lifting_sizes[lifting_sizes.size() / 2], lifting_sizes.back() })
+        {
+            // the largest K lifted by Z (with the BG2, the number of systematic columns used depends on K)
+            auto K = (BG == 1 ? 22 : 10) * Z;
+            while (tools::nr_lifting_size(K, BG) != Z)
+                K--;
+
+            auto nr = tools::build_nr(K, BG, table);
+            auto H = tools::build_H(*nr);
+            module::Encoder_LDPC_NR<> encoder(H, *nr);
+
+            std::vector<int> U_K(K), X_N(nr->N);
+            for (auto f = 0; f < n_frames; f++)
+            {
+                for (auto& u : U_K)
+                    u = bits(prng);
+                encoder.encode(U_K.data(), X_N.data());
+
+                auto syndrome = 0;
+                for (size_t c = 0; c < H.get_n_cols(); c++)
+                {
+                    auto parity = 0;
+                    for (auto v : H.get_rows_from_col(c))
+                        parity ^= X_N[v];
+                    syndrome |= parity;
+                }
+                n_fails += syndrome != 0;
+                n_checks++;
+            }
+        }
+    }
+
+    std::cout << "NR encoder, BG" << BG << ", 3 lifting sizes per set: " << n_fails << " codewords with H.x != 0 on "
+              << n_checks << " frames" << std::endl;
+
+    return n_fails == 0;
+}
+
+// the counter-based AWGN noise of a frame has to be the same with 1 replica and 1 frame per task as with several
+// replicas (in parallel threads) and several frames per task
+static bool
+check_AWGN_philox_replicas(const int n_replicas, const int n_frames, const int seed)
+{
+    const int N = 100, n_waves = 3;
+    const int n_total = n_replicas * n_waves * n_frames;
+
+    module::Channel_AWGN_LLR<float> ref(N, tools::Gaussian_noise_generator_implem::PHILOX, seed);
+    ref.set_replica(0, 1);
+
+    std::vector<float> CP(1, 0.8f), X_N(N, 1.f);
+    std::vector<std::vector<float>> ref_Y_N(n_total, std::vector<float>(N));
+    for (auto f = 0; f < n_total; f++)
+        ref.add_noise(CP, X_N, ref_Y_N[f]);
+
+    std::vector<std::unique_ptr<module::Channel_AWGN_LLR<float>>> replicas;
+    std::vector<std::vector<std::vector<float>>> Y_N(n_replicas, std::vector<std::vector<float>>(n_waves));
+    for (auto r = 0; r < n_replicas; r++)
+    {
+        replicas.push_back(std::unique_ptr<module::Channel_AWGN_LLR<float>>(ref.clone()));
+        replicas[r]->set_n_frames(n_frames);
+        replicas[r]->set_seed(seed);
+        replicas[r]->set_replica(r, n_replicas);
+    }
+
+    std::vector<std::thread> threads;
+    for (auto r = 0; r < n_replicas; r++)
+        threads.push_back(std::thread(
+          [&, r]()
+          {
+              std::vector<float> CP_r(n_frames, 0.8f), X_N_r(n_frames * N, 1.f);
+              for (auto w = 0; w < n_waves; w++)
+              {
+                  Y_N[r][w].resize(n_frames * N);
+                  replicas[r]->add_noise(CP_r, X_N_r, Y_N[r][w]);
+              }
+          }));
+    for (auto& t : threads)
+        t.join();
+
+    // the replica 'r' processes the frames (w * n_replicas + r) * n_frames + f of its wave 'w'
+    int n_diffs = 0;
+    for (auto r = 0; r < n_replicas; r++)
+        for (auto w = 0; w < n_waves; w++)
+            for (auto f = 0; f < n_frames; f++)
+            {
+                const auto& ref_frame = ref_Y_N[(w * n_replicas + r) * n_frames + f];
+                n_diffs += !std::equal(ref_frame.begin(), ref_frame.end(), Y_N[r][w].begin() + f * N);
+            }
+
+    std::cout << "AWGN (PHILOX), 1 replica vs " << n_replicas << " replicas with " << n_frames
+              << " frames per task: " << n_diffs << " different noisy frames on " << n_total << " frames" << std::endl;
+
+    return n_diffs == 0;
+}
+
+int
+main()
+{
+    int exit_code = EXIT_SUCCESS;
+    try
+    {
+        for (auto hamming : { false, true })
+            if (!check_OSD_vs_ML(hamming, 2000, 42)) exit_code = EXIT_FAILURE;
+        for (auto BG : { 1, 2 })
+            if (!check_NR_encoder(BG, 10, 42)) exit_code = EXIT_FAILURE;
+        for (auto n_frames : { 1, 4 })
+            if (!check_AWGN_philox_replicas(4, n_frames, 42)) exit_code = EXIT_FAILURE;
+    }
+    catch (std::exception const& e)
+    {
+        rang::format_on_each_line(std::cerr, std::string(e.what()) + "\n", rang::tag::error);
+        exit_code = EXIT_FAILURE;
+    }
+
+    return exit_code;
+}